@@ -1,5 +1,7 @@
 #include "Factory/Graph/NerveQuestGraphNodeMapper.h"
+#include "Objects/Nodes/Objective/NerveForkObjective.h"
 #include "Objects/Nodes/Objective/NerveSequenceRuntimeObjective.h"
+#include "UnrealED/Node/NerveQuestForkObjective.h"
 #include "UnrealED/Node/NerveQuestSequenceObjective.h"
 
 TSubclassOf<UNerveQuestObjectiveNodeBase> NerveQuestGraphNodeMapper::CreateNewGraphNodeForRuntimeInstance
@@ -12,6 +14,10 @@ TSubclassOf<UNerveQuestObjectiveNodeBase> NerveQuestGraphNodeMapper::CreateNewGr
 	{
 		return UNerveQuestSequenceObjective::StaticClass();
 	}
+	if (NewObjectiveInstance->IsChildOf(UNerveForkObjective::StaticClass()))
+	{
+		return UNerveQuestForkObjective::StaticClass();
+	}
 	
 	return UNerveQuestObjectiveNodeBase::StaticClass();
 }
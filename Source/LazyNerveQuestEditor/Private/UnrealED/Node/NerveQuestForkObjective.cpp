@@ -0,0 +1,49 @@
+// // Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+
+#include "UnrealED/Node/NerveQuestForkObjective.h"
+#include "EdGraphSchema_K2.h"
+#include "Objects/Nodes/Objective/NerveForkObjective.h"
+
+void UNerveQuestForkObjective::AllocateDefaultPins()
+{
+	// No Completed pin: the fork continues through its branches only
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Exec, TEXT("Exec"));
+	SyncBranchPins();
+}
+
+void UNerveQuestForkObjective::OnNodePropertyChange(const FPropertyChangedEvent& PropertyChangedEvent)
+{
+	SyncBranchPins();
+}
+
+void UNerveQuestForkObjective::SyncBranchPins()
+{
+	const UNerveForkObjective* Fork = Cast<UNerveForkObjective>(GetRuntimeObjectiveInstance());
+	const int32 BranchCount = IsValid(Fork) ? Fork->GetBranchCount() : 2;
+
+	TArray<UEdGraphPin*> BranchPins;
+	for (UEdGraphPin* Pin : Pins)
+	{
+		if (Pin != nullptr && Pin->Direction == EGPD_Output)
+		{
+			BranchPins.Add(Pin);
+		}
+	}
+
+	for (int32 Index = BranchPins.Num(); Index < BranchCount; Index++)
+	{
+		CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, FName(*FString::Printf(TEXT("Branch %d"), Index)));
+	}
+
+	for (int32 Index = BranchPins.Num() - 1; Index >= BranchCount; Index--)
+	{
+		BranchPins[Index]->BreakAllPinLinks();
+		RemovePin(BranchPins[Index]);
+	}
+
+	if (UEdGraph* Graph = GetGraph())
+	{
+		Graph->NotifyGraphChanged();
+	}
+}
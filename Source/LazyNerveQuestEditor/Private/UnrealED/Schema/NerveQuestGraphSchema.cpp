@@ -6,6 +6,7 @@
 #include "LazyNerveQuestEditor.h"
 #include "Factory/Graph/NerveQuestGraphNodeMapper.h"
 #include "Objects/Nodes/Objective/NerveEntryObjective.h"
+#include "Objects/Nodes/Objective/NerveJoinObjective.h"
 #include "Objects/Nodes/Objective/NerveQuestRuntimeObjectiveBase.h"
 #include "UnrealED/Node/NerveQuestObjectiveNodeBase.h"
 #include "UnrealED/Node/NerveQuestRootObjective.h"
@@ -135,6 +136,15 @@ const FPinConnectionResponse UNerveQuestGraphSchema::CanCreateConnection(const U
             return FPinConnectionResponse(CONNECT_RESPONSE_BREAK_OTHERS_AB, TEXT("Connect Optional Pin"));
         }
     }
+
+    // Join nodes gather several branches into their input, so only the output side drops its other links
+    const UEdGraphPin* InputSide = A->Direction == EGPD_Input ? A : B;
+    const UNerveQuestObjectiveNodeBase* InputNode = Cast<UNerveQuestObjectiveNodeBase>(InputSide->GetOwningNode());
+    if (IsValid(InputNode) && IsValid(InputNode->GetRuntimeObjectiveClass()) &&
+        InputNode->GetRuntimeObjectiveClass()->IsChildOf(UNerveJoinObjective::StaticClass()))
+    {
+        return FPinConnectionResponse(InputSide == A ? CONNECT_RESPONSE_BREAK_OTHERS_B : CONNECT_RESPONSE_BREAK_OTHERS_A, TEXT("Join Branch"));
+    }
     
     return FPinConnectionResponse(CONNECT_RESPONSE_BREAK_OTHERS_AB, TEXT("Connect Pin"));
 }
@@ -0,0 +1,24 @@
+// // Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NerveQuestObjectiveNodeBase.h"
+#include "NerveQuestForkObjective.generated.h"
+
+/**
+ * Graph node of a fork: one input and a Branch pin per branch of the runtime fork objective.
+ */
+UCLASS()
+class LAZYNERVEQUESTEDITOR_API UNerveQuestForkObjective : public UNerveQuestObjectiveNodeBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual void AllocateDefaultPins() override;
+	virtual void OnNodePropertyChange(const FPropertyChangedEvent& PropertyChangedEvent) override;
+
+private:
+	/** Adds or removes Branch pins until they match the branch count of the runtime fork */
+	void SyncBranchPins();
+};
@@ -38,7 +38,7 @@ public:
     /** Clean up the runtime objective instance */
     void UnInitObjectiveClassInstance();
     
-    void OnNodePropertyChange(const FPropertyChangedEvent& PropertyChangedEvent);
+    virtual void OnNodePropertyChange(const FPropertyChangedEvent& PropertyChangedEvent);
 
     virtual void RefreshOptionalPins();
     
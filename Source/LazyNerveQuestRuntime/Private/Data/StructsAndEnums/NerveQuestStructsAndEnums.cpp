@@ -34,3 +34,30 @@ float ConvertDistance(const float DistanceInUnrealUnits, const ENerveDistanceCon
 
 	return Settings->DistanceConversions.ConvertDistance(DistanceInUnrealUnits, ConversionMethod);
 }
+
+FString FormatPingDistance(const float ConvertedDistance, const ENerveDistanceConversionMethod ConversionMethod)
+{
+	// Determine the unit string based on the conversion method
+	const TCHAR* UnitString;
+	switch (ConversionMethod)
+	{
+		case ENerveDistanceConversionMethod::Centimeter:
+			UnitString = TEXT(" cm");
+			break;
+		case ENerveDistanceConversionMethod::Meter:
+			UnitString = TEXT(" m");
+			break;
+		case ENerveDistanceConversionMethod::Kilometer:
+			UnitString = TEXT(" km");
+			break;
+		case ENerveDistanceConversionMethod::Foot:
+			UnitString = TEXT(" ft");
+			break;
+		default:
+			UnitString = TEXT(""); // Fallback in case of invalid enum value
+			break;
+	}
+
+	// Rounded like UNervePingSubsystem::UpdatePingDistance, which reformats only when this value changes
+	return FString::Printf(TEXT("%lld%s"), FMath::RoundToInt64(ConvertedDistance), UnitString);
+}
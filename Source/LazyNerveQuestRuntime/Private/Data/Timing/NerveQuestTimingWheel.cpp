@@ -0,0 +1,436 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#include "Data/Timing/NerveQuestTimingWheel.h"
+
+FNerveQuestTimingWheel::FNerveQuestTimingWheel(const double InTickLength)
+    : TickLength(FMath::Max(InTickLength, 0.001))
+{
+    for (int32& Head : ListHeads)
+    {
+        Head = INDEX_NONE;
+    }
+}
+
+void FNerveQuestTimingWheel::SetTickLength(const double InTickLength)
+{
+    if (NumPending > 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FNerveQuestTimingWheel::SetTickLength - Ignored while %d timers are pending"), NumPending);
+        return;
+    }
+    TickLength = FMath::Max(InTickLength, 0.001);
+    Accumulator = 0.0;
+}
+
+FNerveQuestTimerHandle FNerveQuestTimingWheel::Add(FSimpleDelegate Callback, const double Delay, const double Interval, const ENerveQuestClock Clock, const int32 Group)
+{
+    FNerveQuestTimerHandle Handle;
+    if (!Callback.IsBound()) return Handle;
+
+    const int32 NodeIndex = FreeNodes.Num() > 0 ? FreeNodes.Pop() : Nodes.AddDefaulted();
+    FTimerNode& Node = Nodes[NodeIndex];
+    Node.Callback = MoveTemp(Callback);
+    Node.IntervalSeconds = FMath::Max(Interval, 0.0);
+    Node.bPending = true;
+    ++NumPending;
+
+    FTimerGroup& TimerGroup = Groups.FindOrAdd(Group);
+    Node.Group = Group;
+    Node.GroupPrev = INDEX_NONE;
+    Node.GroupNext = TimerGroup.Head;
+    if (Node.GroupNext != INDEX_NONE)
+    {
+        Nodes[Node.GroupNext].GroupPrev = NodeIndex;
+    }
+    TimerGroup.Head = NodeIndex;
+
+    if (TimerGroup.IsFrozen())
+    {
+        Node.ParkedSeconds = FMath::Max(Delay, 0.0);
+        Node.bParked = true;
+        ++NumParked;
+    }
+    else
+    {
+        Schedule(NodeIndex, FMath::Max(Delay, 0.0), TimerGroup.TimeScale);
+    }
+
+    Handle.Index = NodeIndex;
+    Handle.Generation = Node.Generation;
+    Handle.Clock = Clock;
+    return Handle;
+}
+
+bool FNerveQuestTimingWheel::Cancel(const FNerveQuestTimerHandle& Handle)
+{
+    if (!FindNode(Handle)) return false;
+
+    if (Nodes[Handle.Index].List != INDEX_NONE)
+    {
+        Unlink(Handle.Index);
+    }
+    ReleaseNode(Handle.Index);
+    return true;
+}
+
+bool FNerveQuestTimingWheel::IsActive(const FNerveQuestTimerHandle& Handle) const
+{
+    return FindNode(Handle) != nullptr;
+}
+
+double FNerveQuestTimingWheel::GetRemaining(const FNerveQuestTimerHandle& Handle) const
+{
+    const FTimerNode* Node = FindNode(Handle);
+    if (!Node) return -1.0;
+
+    return Node->bParked ? Node->ParkedSeconds : GetScheduledRemaining(*Node, Groups.FindChecked(Node->Group).TimeScale);
+}
+
+void FNerveQuestTimingWheel::SetGroupPaused(const int32 Group, const bool bPaused)
+{
+    FTimerGroup& TimerGroup = Groups.FindOrAdd(Group);
+    if (TimerGroup.bPaused == bPaused) return;
+
+    const bool bWasFrozen = TimerGroup.IsFrozen();
+    TimerGroup.bPaused = bPaused;
+    if (TimerGroup.IsFrozen() == bWasFrozen) return;
+
+    for (int32 NodeIndex = TimerGroup.Head; NodeIndex != INDEX_NONE; NodeIndex = Nodes[NodeIndex].GroupNext)
+    {
+        if (bWasFrozen)
+        {
+            Unpark(NodeIndex, TimerGroup.TimeScale);
+        }
+        else
+        {
+            Park(NodeIndex, TimerGroup.TimeScale);
+        }
+    }
+}
+
+void FNerveQuestTimingWheel::SetGroupTimeScale(const int32 Group, double TimeScale)
+{
+    TimeScale = FMath::Max(TimeScale, 0.0);
+
+    FTimerGroup& TimerGroup = Groups.FindOrAdd(Group);
+    if (TimerGroup.TimeScale == TimeScale) return;
+
+    const double OldTimeScale = TimerGroup.TimeScale;
+    const bool bWasFrozen = TimerGroup.IsFrozen();
+    TimerGroup.TimeScale = TimeScale;
+    const bool bFrozen = TimerGroup.IsFrozen();
+
+    // Parked time is kept on the group's own scale, so a frozen group has nothing to reschedule
+    if (bWasFrozen && bFrozen) return;
+
+    for (int32 NodeIndex = TimerGroup.Head; NodeIndex != INDEX_NONE; NodeIndex = Nodes[NodeIndex].GroupNext)
+    {
+        if (bFrozen)
+        {
+            Park(NodeIndex, OldTimeScale);
+        }
+        else if (bWasFrozen)
+        {
+            Unpark(NodeIndex, TimeScale);
+        }
+        else
+        {
+            // Unlinked means due this tick but not fired yet; it fires on the next one instead
+            FTimerNode& Node = Nodes[NodeIndex];
+            double Remaining = 0.0;
+            if (Node.List != INDEX_NONE)
+            {
+                Remaining = GetScheduledRemaining(Node, OldTimeScale);
+                Unlink(NodeIndex);
+            }
+            Schedule(NodeIndex, Remaining, TimeScale);
+        }
+    }
+}
+
+void FNerveQuestTimingWheel::ReleaseGroup(const int32 Group)
+{
+    const FTimerGroup* TimerGroup = Groups.Find(Group);
+    if (!TimerGroup) return;
+
+    int32 NodeIndex = TimerGroup->Head;
+    while (NodeIndex != INDEX_NONE)
+    {
+        const int32 Next = Nodes[NodeIndex].GroupNext;
+        if (Nodes[NodeIndex].List != INDEX_NONE)
+        {
+            Unlink(NodeIndex);
+        }
+        ReleaseNode(NodeIndex);
+        NodeIndex = Next;
+    }
+    Groups.Remove(Group);
+}
+
+void FNerveQuestTimingWheel::Advance(const double DeltaSeconds)
+{
+    if (DeltaSeconds <= 0.0) return;
+
+    if (NumActive() == 0)
+    {
+        // Nothing to fire; delays of new timers are measured from now anyway
+        Accumulator = 0.0;
+        return;
+    }
+
+    Accumulator += DeltaSeconds;
+    while (Accumulator >= TickLength)
+    {
+        Accumulator -= TickLength;
+        Step();
+
+        if (NumActive() == 0)
+        {
+            Accumulator = 0.0;
+            break;
+        }
+    }
+}
+
+void FNerveQuestTimingWheel::Reset()
+{
+    // Nodes are kept so their generations survive; handles to dropped timers must not match the next ones
+    FreeNodes.Reset(Nodes.Num());
+    for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+    {
+        FTimerNode& Node = Nodes[NodeIndex];
+        if (Node.bPending)
+        {
+            Node.Callback.Unbind();
+            Node.bPending = false;
+            ++Node.Generation;
+        }
+        Node.Prev = INDEX_NONE;
+        Node.Next = INDEX_NONE;
+        Node.List = INDEX_NONE;
+        Node.GroupPrev = INDEX_NONE;
+        Node.GroupNext = INDEX_NONE;
+        Node.bParked = false;
+        FreeNodes.Add(NodeIndex);
+    }
+    for (int32& Head : ListHeads)
+    {
+        Head = INDEX_NONE;
+    }
+    for (TPair<int32, FTimerGroup>& Pair : Groups)
+    {
+        Pair.Value.Head = INDEX_NONE;
+    }
+    Accumulator = 0.0;
+    NumPending = 0;
+    NumParked = 0;
+}
+
+const FNerveQuestTimingWheel::FTimerNode* FNerveQuestTimingWheel::FindNode(const FNerveQuestTimerHandle& Handle) const
+{
+    if (!Nodes.IsValidIndex(Handle.Index)) return nullptr;
+
+    const FTimerNode& Node = Nodes[Handle.Index];
+    return Node.bPending && Node.Generation == Handle.Generation ? &Node : nullptr;
+}
+
+uint64 FNerveQuestTimingWheel::SecondsToTicks(const double Seconds) const
+{
+    return static_cast<uint64>(FMath::CeilToDouble(Seconds / TickLength));
+}
+
+void FNerveQuestTimingWheel::Link(const int32 NodeIndex)
+{
+    FTimerNode& Node = Nodes[NodeIndex];
+    const uint64 Expire = Node.ExpireTick;
+    const uint64 Distance = Expire > CurrentTick ? Expire - CurrentTick : 0;
+
+    // The level follows the distance, the slot follows the absolute expiry bits of that level
+    int32 List = OverflowList;
+    for (int32 Level = 0; Level < NumLevels; ++Level)
+    {
+        if (Distance < (uint64(1) << (SlotBits * (Level + 1))))
+        {
+            List = Level * SlotsPerLevel + static_cast<int32>((Expire >> (SlotBits * Level)) & SlotMask);
+            break;
+        }
+    }
+
+    Node.List = List;
+    Node.Prev = INDEX_NONE;
+    Node.Next = ListHeads[List];
+    if (Node.Next != INDEX_NONE)
+    {
+        Nodes[Node.Next].Prev = NodeIndex;
+    }
+    ListHeads[List] = NodeIndex;
+}
+
+void FNerveQuestTimingWheel::Unlink(const int32 NodeIndex)
+{
+    FTimerNode& Node = Nodes[NodeIndex];
+    if (Node.Prev != INDEX_NONE)
+    {
+        Nodes[Node.Prev].Next = Node.Next;
+    }
+    else
+    {
+        ListHeads[Node.List] = Node.Next;
+    }
+    if (Node.Next != INDEX_NONE)
+    {
+        Nodes[Node.Next].Prev = Node.Prev;
+    }
+
+    Node.Prev = INDEX_NONE;
+    Node.Next = INDEX_NONE;
+    Node.List = INDEX_NONE;
+}
+
+void FNerveQuestTimingWheel::Cascade(const int32 ListIndex)
+{
+    int32 NodeIndex = ListHeads[ListIndex];
+    ListHeads[ListIndex] = INDEX_NONE;
+
+    while (NodeIndex != INDEX_NONE)
+    {
+        const int32 Next = Nodes[NodeIndex].Next;
+        Link(NodeIndex);
+        NodeIndex = Next;
+    }
+}
+
+void FNerveQuestTimingWheel::Step()
+{
+    ++CurrentTick;
+
+    // Higher levels first, so a slot cascading from level 2 can land in the level 1 slot cascaded right after
+    if ((CurrentTick & ((uint64(1) << (SlotBits * NumLevels)) - 1)) == 0)
+    {
+        Cascade(OverflowList);
+    }
+    for (int32 Level = NumLevels - 1; Level > 0; --Level)
+    {
+        if ((CurrentTick & ((uint64(1) << (SlotBits * Level)) - 1)) != 0) continue;
+        Cascade(Level * SlotsPerLevel + static_cast<int32>((CurrentTick >> (SlotBits * Level)) & SlotMask));
+    }
+
+    const int32 Slot = static_cast<int32>(CurrentTick & SlotMask);
+    if (ListHeads[Slot] == INDEX_NONE) return;
+
+    // Detach the due list first; callbacks may add or cancel timers, including ones due this tick
+    TArray<TPair<int32, uint32>, TInlineAllocator<16>> Due;
+    int32 NodeIndex = ListHeads[Slot];
+    ListHeads[Slot] = INDEX_NONE;
+    while (NodeIndex != INDEX_NONE)
+    {
+        FTimerNode& Node = Nodes[NodeIndex];
+        Due.Emplace(NodeIndex, Node.Generation);
+        const int32 Next = Node.Next;
+        Node.Prev = INDEX_NONE;
+        Node.Next = INDEX_NONE;
+        Node.List = INDEX_NONE;
+        NodeIndex = Next;
+    }
+
+    for (const TPair<int32, uint32>& Entry : Due)
+    {
+        FTimerNode& Node = Nodes[Entry.Key];
+        if (!Node.bPending || Node.Generation != Entry.Value) continue;
+
+        // An earlier callback paused or rescaled the node's group, which parked or rescheduled it
+        if (Node.bParked || Node.List != INDEX_NONE) continue;
+
+        FSimpleDelegate Callback = Node.Callback;
+        if (Node.IntervalTicks > 0)
+        {
+            Node.ExpireTick = FMath::Max(Node.ExpireTick + Node.IntervalTicks, CurrentTick + 1);
+            Link(Entry.Key);
+        }
+        else
+        {
+            ReleaseNode(Entry.Key);
+        }
+
+        // Node may be reallocated by timers added from the callback, so nothing is touched after this
+        Callback.ExecuteIfBound();
+    }
+}
+
+void FNerveQuestTimingWheel::ReleaseNode(const int32 NodeIndex)
+{
+    FTimerNode& Node = Nodes[NodeIndex];
+
+    FTimerGroup& TimerGroup = Groups.FindChecked(Node.Group);
+    if (Node.GroupPrev != INDEX_NONE)
+    {
+        Nodes[Node.GroupPrev].GroupNext = Node.GroupNext;
+    }
+    else
+    {
+        TimerGroup.Head = Node.GroupNext;
+    }
+    if (Node.GroupNext != INDEX_NONE)
+    {
+        Nodes[Node.GroupNext].GroupPrev = Node.GroupPrev;
+    }
+    Node.GroupPrev = INDEX_NONE;
+    Node.GroupNext = INDEX_NONE;
+
+    if (Node.bParked)
+    {
+        Node.bParked = false;
+        --NumParked;
+    }
+
+    Node.Callback.Unbind();
+    Node.bPending = false;
+    ++Node.Generation;
+    FreeNodes.Add(NodeIndex);
+    --NumPending;
+}
+
+double FNerveQuestTimingWheel::GetScheduledRemaining(const FTimerNode& Node, const double TimeScale) const
+{
+    const uint64 TicksLeft = Node.ExpireTick > CurrentTick ? Node.ExpireTick - CurrentTick : 0;
+    return FMath::Max(static_cast<double>(TicksLeft) * TickLength - Accumulator, 0.0) * TimeScale;
+}
+
+void FNerveQuestTimingWheel::Schedule(const int32 NodeIndex, const double RemainingSeconds, const double TimeScale)
+{
+    FTimerNode& Node = Nodes[NodeIndex];
+
+    // Due on the first tick at or after now + RemainingSeconds, never on the current one
+    Node.ExpireTick = CurrentTick + FMath::Max<uint64>(SecondsToTicks(Accumulator + RemainingSeconds / TimeScale), 1);
+    Node.IntervalTicks = Node.IntervalSeconds > 0.0
+        ? FMath::Max<uint64>(static_cast<uint64>(FMath::RoundToDouble(Node.IntervalSeconds / TimeScale / TickLength)), 1)
+        : 0;
+
+    Link(NodeIndex);
+}
+
+void FNerveQuestTimingWheel::Park(const int32 NodeIndex, const double TimeScale)
+{
+    FTimerNode& Node = Nodes[NodeIndex];
+    if (Node.bParked) return;
+
+    // Unlinked means due this tick but not fired yet, so it fires right after being unparked
+    Node.ParkedSeconds = 0.0;
+    if (Node.List != INDEX_NONE)
+    {
+        Node.ParkedSeconds = GetScheduledRemaining(Node, TimeScale);
+        Unlink(NodeIndex);
+    }
+    Node.bParked = true;
+    ++NumParked;
+}
+
+void FNerveQuestTimingWheel::Unpark(const int32 NodeIndex, const double TimeScale)
+{
+    FTimerNode& Node = Nodes[NodeIndex];
+    if (!Node.bParked) return;
+
+    Node.bParked = false;
+    --NumParked;
+    Schedule(NodeIndex, Node.ParkedSeconds, TimeScale);
+}
@@ -5,14 +5,16 @@
 
 UWorld* UNerveObjectiveModifier::GetWorld() const
 {
-	if (!IsValid(WorldContextObject)) return nullptr;
-
-	// In all other cases...
-	return WorldContextObject->GetWorld();
+	// Instanced on the objective, which resolves the world of its active run
+	const UObject* Outer = GetOuter();
+	return IsValid(Outer) ? Outer->GetWorld() : nullptr;
 }
 
-void UNerveObjectiveModifier::OnObjectiveStart(UNerveQuestRuntimeObjectiveBase* Objective)
+void UNerveObjectiveModifier::OnObjectiveStart(FNerveObjectiveRun& Run)
+{}
+
+void UNerveObjectiveModifier::OnObjectiveProgress(FNerveObjectiveRun& Run)
 {}
 
-void UNerveObjectiveModifier::OnObjectiveProgress(UNerveQuestRuntimeObjectiveBase* Objective)
+void UNerveObjectiveModifier::OnObjectiveEnd(FNerveObjectiveRun& Run)
 {}
@@ -3,16 +3,60 @@
 
 #include "Objects/Modifiers/TimeLimitModifier.h"
 #include "Objects/Nodes/Objective/NerveQuestRuntimeObjectiveBase.h"
+#include "Subsystem/NerveQuestTimerSubsystem.h"
 
-void UTimeLimitModifier::OnObjectiveStart(UNerveQuestRuntimeObjectiveBase* Objective)
+void UTimeLimitModifier::OnObjectiveStart(FNerveObjectiveRun& Run)
 {
-	if(!IsValid(Objective) || !IsValid(GetWorld())) return;
+	FTimeLimitModifierRunState& State = GetRunState<FTimeLimitModifierRunState>(Run);
+	State.bExpired = false;
+	if (TimeLimit <= 0.0f) return;
 
-	StartTime = GetWorld()->GetTimeSeconds();
+	UNerveQuestTimerSubsystem* TimerSubsystem = UNerveQuestTimerSubsystem::GetQuestTimerSubsystem(Run.WorldContextObject.Get());
+	if (!TimerSubsystem)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UTimeLimitModifier::OnObjectiveStart - Invalid QuestTimerSubsystem, time limit ignored"));
+		return;
+	}
+
+	// One deadline on the quest timing wheel instead of polling CheckCondition
+	const FSimpleDelegate Deadline = FSimpleDelegate::CreateUObject(this, &UTimeLimitModifier::HandleDeadline, TWeakPtr<FNerveObjectiveRun>(Run.AsShared()));
+	TimerSubsystem->SetTimer(State.DeadlineHandle, Deadline, TimeLimit, false, Clock, Run.TimerScope);
+	State.TimerSubsystem = TimerSubsystem;
+}
+
+bool UTimeLimitModifier::CheckCondition(FNerveObjectiveRun& Run)
+{
+	return !GetRunState<FTimeLimitModifierRunState>(Run).bExpired;
+}
+
+bool UTimeLimitModifier::ValidateCompletion(FNerveObjectiveRun& Run)
+{
+	// The deadline fires on the first wheel tick past the limit, so a pending deadline means time is left
+	return !GetRunState<FTimeLimitModifierRunState>(Run).bExpired;
 }
 
-bool UTimeLimitModifier::CheckCondition(UNerveQuestRuntimeObjectiveBase* Objective)
+void UTimeLimitModifier::OnObjectiveEnd(FNerveObjectiveRun& Run)
 {
-	const float CurrentTime = GetWorld()->GetTimeSeconds();
-	return (CurrentTime - StartTime) <= TimeLimit;
-}
\ No newline at end of file
+	FTimeLimitModifierRunState& State = GetRunState<FTimeLimitModifierRunState>(Run);
+	if (UNerveQuestTimerSubsystem* TimerSubsystem = State.TimerSubsystem.Get())
+	{
+		TimerSubsystem->ClearTimer(State.DeadlineHandle);
+	}
+	State.DeadlineHandle.Invalidate();
+}
+
+void UTimeLimitModifier::HandleDeadline(const TWeakPtr<FNerveObjectiveRun> WeakRun)
+{
+	const TSharedPtr<FNerveObjectiveRun> Run = WeakRun.Pin();
+	if (!Run.IsValid()) return;
+
+	FTimeLimitModifierRunState& State = GetRunState<FTimeLimitModifierRunState>(*Run);
+	State.bExpired = true;
+	State.DeadlineHandle.Invalidate();
+
+	if (UNerveQuestRuntimeObjectiveBase* Objective = Run->Objective.Get())
+	{
+		FNerveObjectiveRunScope Scope(*Run);
+		Objective->FailFromModifier(this);
+	}
+}
@@ -1,6 +1,9 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Objects/NerveQuest/NerveQuestAsset.h"
+#include "GameFramework/Actor.h"
+#include "Math/RandomStream.h"
+#include "Subsystem/NerveQuestTargetSubsystem.h"
 #include "UObject/ObjectSaveContext.h"
 
 TArray<UNerveQuestRuntimeObjectiveBase*> UNerveQuestAsset::GetQuestObjectives() const
@@ -19,6 +22,130 @@ TArray<UNerveQuestRuntimeObjectiveBase*> UNerveQuestAsset::GetQuestObjectives()
 	return Objectives;
 }
 
+bool UNerveQuestAsset::FindQuestParameter(const FName ParameterName, FString& OutValue) const
+{
+	// Instances only store what their row overrides, the rest comes from the template chain
+	for (const UNerveQuestAsset* Quest = this; IsValid(Quest); Quest = Quest->TemplateAsset)
+	{
+		if (const FString* Value = Quest->QuestParameters.Find(ParameterName))
+		{
+			OutValue = *Value;
+			return true;
+		}
+	}
+	return false;
+}
+
+UNerveQuestAsset* UNerveQuestAsset::CreateTemplateInstance(UObject* Outer, UNerveQuestAsset* Template, const FNerveQuestTemplateRow& Row, const FName InstanceName)
+{
+	if (!IsValid(Template) || !IsValid(Template->RuntimeGraph))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("CreateTemplateInstance: Template quest for %s has no graph"), *InstanceName.ToString());
+		return nullptr;
+	}
+
+	UNerveQuestAsset* Instance = NewObject<UNerveQuestAsset>(Outer, MakeUniqueObjectName(Outer, StaticClass(), InstanceName), RF_Transient);
+	Instance->TemplateAsset = Template;
+	Instance->QuestParameters = Row.Parameters;
+	Instance->QuestType = Template->QuestType;
+	Instance->bRepeatable = Template->bRepeatable;
+	Instance->QuestDifficulty = Template->QuestDifficulty;
+
+	// Texts may reference parameters as {Name}; row values win over template defaults
+	FStringFormatNamedArguments Arguments;
+	for (const UNerveQuestAsset* Quest = Template; IsValid(Quest); Quest = Quest->TemplateAsset)
+	{
+		for (const TPair<FName, FString>& Parameter : Quest->QuestParameters)
+		{
+			if (!Arguments.Contains(Parameter.Key.ToString()))
+			{
+				Arguments.Add(Parameter.Key.ToString(), Parameter.Value);
+			}
+		}
+	}
+	for (const TPair<FName, FString>& Parameter : Row.Parameters)
+	{
+		Arguments.Add(Parameter.Key.ToString(), Parameter.Value);
+	}
+
+	Instance->QuestTitle = FString::Format(*(Row.QuestTitle.IsEmpty() ? Template->QuestTitle : Row.QuestTitle), Arguments);
+	Instance->QuestDescription = FString::Format(*(Row.QuestDescription.IsEmpty() ? Template->QuestDescription : Row.QuestDescription), Arguments);
+
+	// Every instance runs the template's graph; nodes read their bound parameters from the running quest, and
+	// objective state lives in each quest's objective runs
+	Instance->RuntimeGraph = Template->RuntimeGraph;
+	return Instance;
+}
+
+UNerveQuestAsset* UNerveQuestAsset::CreateRadiantInstance(UObject* Outer, UNerveQuestAsset* Template, const int32 Seed, const UObject* WorldContextObject)
+{
+	if (!IsValid(Template)) return nullptr;
+
+	FNerveQuestTemplateRow Row;
+	Row.Template = Template;
+	Template->GenerateParameters(Seed, WorldContextObject, Row.Parameters);
+
+	UNerveQuestAsset* Instance = CreateTemplateInstance(Outer, Template, Row, *FString::Printf(TEXT("%s_Radiant"), *Template->GetName()));
+	if (IsValid(Instance))
+	{
+		Instance->RadiantSeed = Seed;
+		Instance->bIsRadiant = true;
+	}
+	return Instance;
+}
+
+void UNerveQuestAsset::GenerateParameters(const int32 Seed, const UObject* WorldContextObject, TMap<FName, FString>& OutParameters) const
+{
+	// Draws happen in generator order on one stream, so a seed maps to the same values every time
+	FRandomStream Stream(Seed);
+	UNerveQuestTargetSubsystem* TargetSubsystem = UNerveQuestTargetSubsystem::GetQuestTargetSubsystem(WorldContextObject);
+
+	for (const FNerveQuestParameterGenerator& Generator : ParameterGenerators)
+	{
+		switch (Generator.Source)
+		{
+		case ENerveQuestParameterSource::IntegerRange:
+			OutParameters.Add(Generator.ParameterName, FString::FromInt(Stream.RandRange(
+				FMath::RoundToInt(Generator.Range.X), FMath::RoundToInt(Generator.Range.Y))));
+			break;
+		case ENerveQuestParameterSource::FloatRange:
+			OutParameters.Add(Generator.ParameterName, FString::SanitizeFloat(Stream.FRandRange(Generator.Range.X, Generator.Range.Y)));
+			break;
+		case ENerveQuestParameterSource::Choice:
+			if (!Generator.Choices.IsEmpty())
+			{
+				OutParameters.Add(Generator.ParameterName, Generator.Choices[Stream.RandRange(0, Generator.Choices.Num() - 1)]);
+			}
+			break;
+		case ENerveQuestParameterSource::TargetActor:
+		case ENerveQuestParameterSource::TargetLocation:
+		{
+			TArray<AActor*> Candidates;
+			if (TargetSubsystem && Generator.TargetClass)
+			{
+				TargetSubsystem->RegisterTargetClass(Generator.TargetClass);
+				TargetSubsystem->GetActorsOfClass(Generator.TargetClass, Generator.TargetTag, Candidates);
+			}
+			if (Candidates.IsEmpty())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("GenerateParameters: No quest target for parameter %s of %s"),
+					*Generator.ParameterName.ToString(), *GetName());
+				break;
+			}
+
+			// Index order depends on spawn order, names do not
+			Candidates.Sort([](const AActor& A, const AActor& B) { return A.GetFName().LexicalLess(B.GetFName()); });
+			const AActor* Target = Candidates[Stream.RandRange(0, Candidates.Num() - 1)];
+			OutParameters.Add(Generator.ParameterName, Generator.Source == ENerveQuestParameterSource::TargetActor
+				? Target->GetPathName() : Target->GetActorLocation().ToString());
+			break;
+		}
+		default:
+			break;
+		}
+	}
+}
+
 #if WITH_EDITOR
 void UNerveQuestAsset::PreEditChange(FProperty* PropertyAboutToChange)
 {
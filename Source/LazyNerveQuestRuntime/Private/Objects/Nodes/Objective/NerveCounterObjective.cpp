@@ -0,0 +1,184 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+
+#include "Objects/Nodes/Objective/NerveCounterObjective.h"
+#include "Engine/World.h"
+#include "Subsystem/NerveQuestEventSubsystem.h"
+
+UNerveCounterObjective::UNerveCounterObjective()
+{}
+
+FText UNerveCounterObjective::GetObjectiveName_Implementation()
+{
+    return FText::FromString(TEXT("Counter"));
+}
+
+FText UNerveCounterObjective::GetObjectiveDescription_Implementation()
+{
+    return FText::Format(NSLOCTEXT("QuestObjectives", "CounterDescription", "Reach {0} of {1}."), FText::AsNumber(TargetCount),
+        CountedEvent.IsValid() ? FText::FromName(CountedEvent.GetTagName()) : FText::FromString(TEXT("the counted goal")));
+}
+
+FText UNerveCounterObjective::GetObjectiveCategory_Implementation()
+{
+    return FText::FromString(TEXT("Primitive Objectives"));
+}
+
+FSlateBrush UNerveCounterObjective::GetObjectiveBrush_Implementation() const
+{
+    return Super::GetObjectiveBrush_Implementation();
+}
+
+FNerveCounterObjectiveRun::~FNerveCounterObjectiveRun()
+{
+    StopCounting();
+}
+
+void FNerveCounterObjectiveRun::StopCounting()
+{
+    bCounting = false;
+
+    if (UNerveQuestEventSubsystem* Events = EventSubsystem.Get())
+    {
+        Events->UnregisterCounter(this);
+    }
+    if (TargetSubsystem.IsValid() && TargetWatcherHandle != INDEX_NONE)
+    {
+        TargetSubsystem->RemoveWatcher(TargetWatcherHandle);
+    }
+    TargetWatcherHandle = INDEX_NONE;
+}
+
+TSharedRef<FNerveObjectiveRun> UNerveCounterObjective::MakeRun() const
+{
+    return MakeShared<FNerveCounterObjectiveRun>();
+}
+
+void UNerveCounterObjective::ExecuteObjective_Implementation(UNerveQuestAsset* NerveQuestAsset)
+{
+    Super::ExecuteObjective_Implementation(NerveQuestAsset);
+
+    FNerveCounterObjectiveRun* Run = GetRun<FNerveCounterObjectiveRun>();
+    if (!Run) return;
+
+    Run->StopCounting();
+    Run->TargetCount = FMath::Max(ResolveProperty(GET_MEMBER_NAME_CHECKED(UNerveCounterObjective, TargetCount), TargetCount), 1);
+    Run->CurrentCount = 0;
+    Run->HeldCount = 0;
+    Run->bPaused = false;
+
+    UWorld* World = GetWorld();
+    if (!IsValid(World))
+    {
+        UE_LOG(LogTemp, Error, TEXT("UNerveCounterObjective::ExecuteObjective - Invalid World"));
+        FailObjective();
+        return;
+    }
+
+    Run->EventSubsystem = World->GetSubsystem<UNerveQuestEventSubsystem>();
+    if (!Run->EventSubsystem.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("UNerveCounterObjective::ExecuteObjective - No quest event subsystem"));
+        FailObjective();
+        return;
+    }
+
+    Run->bCounting = true;
+    Run->EventSubsystem->RegisterCounter(*Run, CountedEvent);
+
+    if (IsValid(CountedTargetClass))
+    {
+        Run->TargetSubsystem = World->GetSubsystem<UNerveQuestTargetSubsystem>();
+        if (Run->TargetSubsystem.IsValid())
+        {
+            Run->TargetWatcherHandle = Run->TargetSubsystem->AddWatcher(CountedTargetClass, CountedTargetTag,
+                FNerveQuestTargetChanged::CreateUObject(this, &UNerveCounterObjective::HandleTargetChanged, TWeakPtr<FNerveObjectiveRun>(Run->AsShared())));
+        }
+    }
+
+    ExecuteProgress(Run->CurrentCount, Run->TargetCount);
+}
+
+void UNerveCounterObjective::CleanUpObjective_Implementation()
+{
+    if (FNerveCounterObjectiveRun* Run = GetRun<FNerveCounterObjectiveRun>())
+    {
+        Run->StopCounting();
+    }
+    Super::CleanUpObjective_Implementation();
+}
+
+void UNerveCounterObjective::PauseObjective_Implementation()
+{
+    Super::PauseObjective_Implementation();
+    if (FNerveCounterObjectiveRun* Run = GetRun<FNerveCounterObjectiveRun>())
+    {
+        Run->bPaused = true;
+    }
+}
+
+void UNerveCounterObjective::ResumeObjective_Implementation()
+{
+    Super::ResumeObjective_Implementation();
+
+    FNerveCounterObjectiveRun* Run = GetRun<FNerveCounterObjectiveRun>();
+    if (!Run) return;
+
+    Run->bPaused = false;
+    const int32 Held = Run->HeldCount;
+    Run->HeldCount = 0;
+    ApplyCount(*Run, Held);
+}
+
+int32 UNerveCounterObjective::GetCurrentCount() const
+{
+    const FNerveCounterObjectiveRun* Run = GetRun<FNerveCounterObjectiveRun>();
+    return Run ? Run->CurrentCount : 0;
+}
+
+int32 UNerveCounterObjective::GetTargetCount() const
+{
+    const FNerveCounterObjectiveRun* Run = GetRun<FNerveCounterObjectiveRun>();
+    return Run ? Run->TargetCount : TargetCount;
+}
+
+void UNerveCounterObjective::AddCount(const int32 Amount)
+{
+    FNerveCounterObjectiveRun* Run = GetRun<FNerveCounterObjectiveRun>();
+    if (!Run || !Run->bCounting || !Run->EventSubsystem.IsValid()) return;
+    Run->EventSubsystem->QueueCount(*Run, Amount);
+}
+
+void UNerveCounterObjective::ApplyCount(FNerveObjectiveRun& InRun, const int32 Amount)
+{
+    FNerveCounterObjectiveRun& Run = static_cast<FNerveCounterObjectiveRun&>(InRun);
+    if (!Run.bCounting || Amount <= 0) return;
+
+    if (Run.bPaused)
+    {
+        Run.HeldCount += Amount;
+        return;
+    }
+
+    FNerveObjectiveRunScope Scope(Run);
+    Run.CurrentCount = FMath::Min(Run.CurrentCount + Amount, Run.TargetCount);
+    ExecuteProgress(Run.CurrentCount, Run.TargetCount);
+
+    if (Run.CurrentCount >= Run.TargetCount)
+    {
+        Run.StopCounting();
+        CompleteObjective();
+    }
+}
+
+void UNerveCounterObjective::HandleTargetChanged(AActor* Actor, const ENerveQuestTargetChange Change, const TWeakPtr<FNerveObjectiveRun> WeakRun)
+{
+    // Only destruction counts; queued so a wave of deaths lands as one update
+    if (Change != ENerveQuestTargetChange::Destroyed) return;
+
+    if (const TSharedPtr<FNerveObjectiveRun> Run = WeakRun.Pin())
+    {
+        FNerveObjectiveRunScope Scope(*Run);
+        AddCount(1);
+    }
+}
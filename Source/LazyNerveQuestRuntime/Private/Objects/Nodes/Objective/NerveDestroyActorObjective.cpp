@@ -2,7 +2,6 @@
 
 
 #include "Objects/Nodes/Objective/NerveDestroyActorObjective.h"
-#include "Kismet/GameplayStatics.h"
 
 UNerveDestroyActorObjective::UNerveDestroyActorObjective()
 {}
@@ -27,32 +26,63 @@ FSlateBrush UNerveDestroyActorObjective::GetObjectiveBrush_Implementation() cons
 	return Super::GetObjectiveBrush_Implementation();
 }
 
+FNerveDestroyActorObjectiveRun::~FNerveDestroyActorObjectiveRun()
+{
+	StopWatchingTargets();
+}
+
+void FNerveDestroyActorObjectiveRun::StopWatchingTargets()
+{
+	if (TargetSubsystem.IsValid() && TargetWatcherHandle != INDEX_NONE)
+	{
+		TargetSubsystem->RemoveWatcher(TargetWatcherHandle);
+	}
+	TargetWatcherHandle = INDEX_NONE;
+}
+
+TSharedRef<FNerveObjectiveRun> UNerveDestroyActorObjective::MakeRun() const
+{
+	return MakeShared<FNerveDestroyActorObjectiveRun>();
+}
+
 void UNerveDestroyActorObjective::ExecuteObjective_Implementation(UNerveQuestAsset* NerveQuestAsset)
 {
 	Super::ExecuteObjective_Implementation(NerveQuestAsset);
-	CurrentAmount = 0;
-	OutActors.Empty();
+
+	FNerveDestroyActorObjectiveRun* Run = GetRun<FNerveDestroyActorObjectiveRun>();
+	if (!Run) return;
+
+	Run->CurrentAmount = 0;
+	Run->StopWatchingTargets();
+	Run->ActorToDestroy = ResolveProperty(GET_MEMBER_NAME_CHECKED(UNerveDestroyActorObjective, ActorToDestroy), ActorToDestroy);
+	Run->AmountToDestroy = FMath::Max(ResolveProperty(GET_MEMBER_NAME_CHECKED(UNerveDestroyActorObjective, AmountToDestroy), AmountToDestroy), 1);
+	Run->ActorTag = ResolveProperty(GET_MEMBER_NAME_CHECKED(UNerveDestroyActorObjective, ActorTag), ActorTag);
 	
 	// Check if the World is valid
-	if (!IsValid(GetWorld()) || !IsValid(ActorToDestroy))
+	if (!IsValid(GetWorld()) || !IsValid(Run->ActorToDestroy))
 	{
 		UE_LOG(LogTemp, Error, TEXT("Invalid World in UNerveDestroyActorObjective::ExecuteObjective_Implementation"));
 		FailObjective();
 		return;
 	}
-	
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ActorToDestroy, OutActors);
-	if(OutActors.IsEmpty())
+
+	Run->TargetSubsystem = GetWorld()->GetSubsystem<UNerveQuestTargetSubsystem>();
+	if (!Run->TargetSubsystem.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("No actors to destroy found in UNerveDestroyActorObjective::ExecuteObjective_Implementation"));
+		UE_LOG(LogTemp, Error, TEXT("No quest target registry in UNerveDestroyActorObjective::ExecuteObjective_Implementation"));
 		FailObjective();
 		return;
 	}
 
-	for (AActor* OutActor : OutActors)
+	// Targets spawned later are counted too, so an empty world is only worth a warning
+	Run->TargetSubsystem->RegisterTargetClass(Run->ActorToDestroy);
+	if (Run->TargetSubsystem->CountActorsOfClass(Run->ActorToDestroy, Run->ActorTag) == 0)
 	{
-		OutActor->OnDestroyed.AddDynamic(this, &UNerveDestroyActorObjective::HandleActorDestroy);
+		UE_LOG(LogTemp, Warning, TEXT("UNerveDestroyActorObjective::ExecuteObjective - No %s present yet, waiting for spawns"), *Run->ActorToDestroy->GetName());
 	}
+
+	Run->TargetWatcherHandle = Run->TargetSubsystem->AddWatcher(Run->ActorToDestroy, Run->ActorTag,
+		FNerveQuestTargetChanged::CreateUObject(this, &UNerveDestroyActorObjective::HandleTargetChanged, TWeakPtr<FNerveObjectiveRun>(Run->AsShared())));
 }
 
 void UNerveDestroyActorObjective::MarkAsTracked_Implementation(const bool TrackValue)
@@ -60,23 +90,32 @@ void UNerveDestroyActorObjective::MarkAsTracked_Implementation(const bool TrackV
 	Super::MarkAsTracked_Implementation(TrackValue);
 }
 
-void UNerveDestroyActorObjective::HandleActorDestroy(AActor* DestroyedActor)
+void UNerveDestroyActorObjective::CleanUpObjective_Implementation()
 {
-	CurrentAmount ++;
-	ExecuteProgress(CurrentAmount, AmountToDestroy);
-	if(CurrentAmount >= AmountToDestroy)
+	if (FNerveDestroyActorObjectiveRun* Run = GetRun<FNerveDestroyActorObjectiveRun>())
 	{
-		CurrentAmount = 0;
+		Run->StopWatchingTargets();
+	}
+	Super::CleanUpObjective_Implementation();
+}
+
+void UNerveDestroyActorObjective::HandleTargetChanged(AActor* Actor, const ENerveQuestTargetChange Change, const TWeakPtr<FNerveObjectiveRun> WeakRun)
+{
+	// Spawns and streamed out levels don't count, only actual destruction
+	if (Change != ENerveQuestTargetChange::Destroyed) return;
 
-		for (AActor* OutActor : OutActors)
-		{
-			// AT THIS POINT THE ACTOR IS ALREADY DESTROYED BUT IF FOR SOME REASON THE DESTROY DELEGATE IS MANUALLY CALLED
-			// AND THE ACTOR ISN'T DESTROYED THEN WE UNBIND.
+	const TSharedPtr<FNerveObjectiveRun> PinnedRun = WeakRun.Pin();
+	if (!PinnedRun.IsValid()) return;
 
-			if(!IsValid(OutActor)) continue;
-			OutActor->OnDestroyed.RemoveDynamic(this, &UNerveDestroyActorObjective::HandleActorDestroy);
-		}
-		OutActors.Empty();
+	FNerveObjectiveRunScope Scope(*PinnedRun);
+	FNerveDestroyActorObjectiveRun& Run = static_cast<FNerveDestroyActorObjectiveRun&>(*PinnedRun);
+
+	Run.CurrentAmount ++;
+	ExecuteProgress(Run.CurrentAmount, Run.AmountToDestroy);
+	if(Run.CurrentAmount >= Run.AmountToDestroy)
+	{
+		Run.CurrentAmount = 0;
+		Run.StopWatchingTargets();
 		CompleteObjective();
 		return;
 	}
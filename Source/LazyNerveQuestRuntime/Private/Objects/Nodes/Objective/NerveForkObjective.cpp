@@ -0,0 +1,31 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+
+#include "Objects/Nodes/Objective/NerveForkObjective.h"
+
+UNerveForkObjective::UNerveForkObjective()
+{
+    bShowInUI = false;
+}
+
+FText UNerveForkObjective::GetObjectiveName_Implementation()
+{
+    return FText::FromString(TEXT("Fork"));
+}
+
+FText UNerveForkObjective::GetObjectiveDescription_Implementation()
+{
+    return FText::Format(NSLOCTEXT("QuestObjectives", "ForkDescription", "Runs {0} branches at the same time."), FText::AsNumber(GetBranchCount()));
+}
+
+FText UNerveForkObjective::GetObjectiveCategory_Implementation()
+{
+    return FText::FromString(TEXT("Flow"));
+}
+
+void UNerveForkObjective::ExecuteObjective_Implementation(UNerveQuestAsset* NerveQuestAsset)
+{
+    // Only reached when run as a plain objective; the quest follows the branches itself
+    Super::ExecuteObjective_Implementation(NerveQuestAsset);
+    CompleteObjective();
+}
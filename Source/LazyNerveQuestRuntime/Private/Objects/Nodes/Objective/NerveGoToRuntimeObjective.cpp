@@ -3,8 +3,10 @@
 #include "Objects/Nodes/Objective/NerveGoToRuntimeObjective.h"
 #include "LazyNerveRuntimeQuestStyle.h"
 #include "TimerManager.h"
-#include "Actors/GoToWorldPing.h"
+#include "Subsystem/NervePingSubsystem.h"
+#include "Subsystem/NerveQuestTimerSubsystem.h"
 #include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
 #include "Widget/WorldGotoPing.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -32,9 +34,45 @@ FSlateBrush UNerveGoToRuntimeObjective::GetObjectiveBrush_Implementation() const
 	return *Brush;
 }
 
+FNerveGoToObjectiveRun::~FNerveGoToObjectiveRun()
+{
+    StopTracking();
+    CleanupPing();
+}
+
+void FNerveGoToObjectiveRun::StopTracking()
+{
+    if (UNerveQuestTimerSubsystem* Timers = TimerSubsystem.Get())
+    {
+        Timers->ClearTimer(TimerHandle);
+    }
+    TimerHandle.Invalidate();
+}
+
+void FNerveGoToObjectiveRun::CleanupPing()
+{
+    if (PingSubsystem.IsValid() && CurrentPingID != -1)
+    {
+        PingSubsystem->RemovePing(CurrentPingID);
+    }
+    CurrentPingID = -1;
+}
+
+TSharedRef<FNerveObjectiveRun> UNerveGoToRuntimeObjective::MakeRun() const
+{
+    return MakeShared<FNerveGoToObjectiveRun>();
+}
+
 void UNerveGoToRuntimeObjective::ExecuteObjective_Implementation(UNerveQuestAsset* NerveQuestAsset)
 {
     UNerveQuestRuntimeObjectiveBase::ExecuteObjective_Implementation(NerveQuestAsset);
+
+    FNerveGoToObjectiveRun* Run = GetRun<FNerveGoToObjectiveRun>();
+    if (!Run) return;
+
+    Run->SpecificLocation = ResolveProperty(GET_MEMBER_NAME_CHECKED(UNerveGoToRuntimeObjective, SpecificLocation), SpecificLocation);
+    Run->LocationActor = ResolveProperty(GET_MEMBER_NAME_CHECKED(UNerveGoToRuntimeObjective, LocationActor), LocationActor);
+    Run->AcceptableRadialOffset = ResolveProperty(GET_MEMBER_NAME_CHECKED(UNerveGoToRuntimeObjective, AcceptableRadialOffset), AcceptableRadialOffset);
     
     // Check if the World is valid
     if (!IsValid(GetWorld()))
@@ -44,8 +82,8 @@ void UNerveGoToRuntimeObjective::ExecuteObjective_Implementation(UNerveQuestAsse
         return;
     }
 
-    // Get the player pawn
-    const APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+    // Track the pawn of the local player running this objective
+    const APlayerController* PlayerController = GetOwningPlayerController();
     if (!IsValid(PlayerController))
     {
         UE_LOG(LogTemp, Error, TEXT("Invalid PlayerController in UNerveGoToRuntimeObjective::ExecuteObjective_Implementation"));
@@ -53,34 +91,34 @@ void UNerveGoToRuntimeObjective::ExecuteObjective_Implementation(UNerveQuestAsse
         return;
     }
 
-    TrackingPlayer = PlayerController->GetPawn();
+    Run->TrackingPlayer = PlayerController->GetPawn();
 
-    if (!IsValid(TrackingPlayer))
+    if (!Run->TrackingPlayer.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("Invalid TrackingPlayer in UNerveGoToRuntimeObjective::ExecuteObjective_Implementation"));
         FailObjective();
         return;
     }
 
-    // Clear any existing timer
-    if (TimerHandle.IsValid())
+    UNerveQuestTimerSubsystem* TimerSubsystem = GetWorld()->GetSubsystem<UNerveQuestTimerSubsystem>();
+    if (!TimerSubsystem)
     {
-        GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
+        UE_LOG(LogTemp, Error, TEXT("Missing NerveQuestTimerSubsystem in UNerveGoToRuntimeObjective::ExecuteObjective_Implementation"));
+        FailObjective();
+        return;
     }
 
-    // Get or create the ping manager
-    if (!IsValid(PingManager))
+    // Clear any existing timer
+    Run->StopTracking();
+    Run->TimerSubsystem = TimerSubsystem;
+
+    // The ping subsystem lives with the world, so this is a direct lookup
+    Run->PingSubsystem = GetWorld()->GetSubsystem<UNervePingSubsystem>();
+    if (!Run->PingSubsystem.IsValid())
     {
-        // Try to find existing ping manager in the world
-        PingManager = APingManager::GetOrCreatePingManager(GetWorld());
-        
-        // If none exists, create one
-        if (!IsValid(PingManager))
-        {
-            UE_LOG(LogTemp, Error, TEXT("Failed to create PingManager"));
-            FailObjective();
-            return;
-        }
+        UE_LOG(LogTemp, Error, TEXT("Missing NervePingSubsystem in UNerveGoToRuntimeObjective::ExecuteObjective_Implementation"));
+        FailObjective();
+        return;
     }
 
     // Create the ping if we should apply world marker
@@ -97,8 +135,8 @@ void UNerveGoToRuntimeObjective::ExecuteObjective_Implementation(UNerveQuestAsse
                 TargetLocation = FindGroundLevel(GetWorld(), TargetLocation);
             }
             
-            CurrentPingID = PingManager->CreatePing(TargetLocation, PingWidgetClass);
-            if (CurrentPingID == -1)
+            Run->CurrentPingID = Run->PingSubsystem->CreatePing(TargetLocation, PingWidgetClass, GetOwningLocalPlayer());
+            if (Run->CurrentPingID == -1)
             {
                 UE_LOG(LogTemp, Error, TEXT("Failed to create ping"));
             }
@@ -106,28 +144,35 @@ void UNerveGoToRuntimeObjective::ExecuteObjective_Implementation(UNerveQuestAsse
     }
     
     // Set up the timer to periodically check player location
-    GetWorld()->GetTimerManager().SetTimer(TimerHandle, this, &UNerveGoToRuntimeObjective::ListenToPlayerLocation, TrackingRate, true);
+    TimerSubsystem->SetTimer(Run->TimerHandle, FSimpleDelegate::CreateUObject(this, &UNerveGoToRuntimeObjective::ListenToPlayerLocation, TWeakPtr<FNerveObjectiveRun>(Run->AsShared())),
+        TrackingRate, true, ENerveQuestClock::GameTime, GetTimerScope());
 }
 
 void UNerveGoToRuntimeObjective::MarkAsTracked_Implementation(const bool TrackValue)
 {
-    if (!IsValid(PingManager) || CurrentPingID == -1) return;
+    const FNerveGoToObjectiveRun* Run = GetRun<FNerveGoToObjectiveRun>();
+    if (!Run || !Run->PingSubsystem.IsValid() || Run->CurrentPingID == -1) return;
         
-    PingManager->SetPingVisibility(CurrentPingID, TrackValue);
+    Run->PingSubsystem->SetPingVisibility(Run->CurrentPingID, TrackValue);
+    Run->PingSubsystem->SetPingTracked(Run->CurrentPingID, TrackValue);
 }
 
-void UNerveGoToRuntimeObjective::ListenToPlayerLocation()
+void UNerveGoToRuntimeObjective::ListenToPlayerLocation(const TWeakPtr<FNerveObjectiveRun> WeakRun)
 {
+    const TSharedPtr<FNerveObjectiveRun> PinnedRun = WeakRun.Pin();
+    if (!PinnedRun.IsValid()) return;
+
+    FNerveObjectiveRunScope Scope(*PinnedRun);
+    FNerveGoToObjectiveRun& Run = static_cast<FNerveGoToObjectiveRun&>(*PinnedRun);
+
     // Check if the tracking player is still valid
+    const APawn* TrackingPlayer = Run.TrackingPlayer.Get();
     if (!IsValid(TrackingPlayer))
     {
         UE_LOG(LogTemp, Warning, TEXT("TrackingPlayer became invalid in UNerveGoToRuntimeObjective::ListenToPlayerLocation"));
-        if (IsValid(GetWorld()))
-        {
-            GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
+        Run.StopTracking();
 
-        CleanupPing();
+        Run.CleanupPing();
         FailObjective();
         return;
     }
@@ -152,36 +197,46 @@ void UNerveGoToRuntimeObjective::ListenToPlayerLocation()
     const float Distance = FVector::Distance(TrackingPlayer->GetActorLocation(), TargetLocation);
 
     // Update ping if it exists
-    if (IsValid(PingManager) && CurrentPingID != -1)
+    if (Run.PingSubsystem.IsValid() && Run.CurrentPingID != -1)
     {
-        PingManager->UpdatePingLocation(CurrentPingID, TargetLocation);
-        PingManager->UpdatePingDistance(CurrentPingID, ConvertDistance(Distance, DistanceConversion), DistanceConversion);
+        // Hand the target's velocity over so the marker moves smoothly between polls
+        FVector TargetVelocity = FVector::ZeroVector;
+        if (LocationType == EGoToQuestLocationType::ActorLocation && Run.LocationActor.IsValid())
+        {
+            TargetVelocity = Run.LocationActor->GetVelocity();
+            if (!bApplyAbsoluteZ)
+            {
+                TargetVelocity.Z = 0.0;
+            }
+        }
+        Run.PingSubsystem->UpdatePingMotion(Run.CurrentPingID, TargetLocation, TargetVelocity);
+        Run.PingSubsystem->UpdatePingDistance(Run.CurrentPingID, ConvertDistance(Distance, DistanceConversion), DistanceConversion);
     }
 
     // Check if the player is within the acceptable range
-    if (Distance <= AcceptableRadialOffset)
+    if (Distance <= Run.AcceptableRadialOffset)
     {
         UE_LOG(LogTemp, Log, TEXT("Player reached the target location. Completing objective."));
-        if (IsValid(GetWorld()))
-        {
-            GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
+        Run.StopTracking();
 
-        CleanupPing();
+        Run.CleanupPing();
         CompleteObjective();
     }
 }
 
 FVector UNerveGoToRuntimeObjective::GetTargetLocationByLocationType(bool& Success) const
 {
+    const FNerveGoToObjectiveRun* Run = GetRun<FNerveGoToObjectiveRun>();
+    const TSoftObjectPtr<AActor>& TargetActor = Run ? Run->LocationActor : LocationActor;
+
     Success = true;
     if (LocationType == EGoToQuestLocationType::SpecificLocation) 
     {
-        return SpecificLocation;
+        return Run ? Run->SpecificLocation : SpecificLocation;
     }
-    if (IsValid(LocationActor.LoadSynchronous()))
+    if (IsValid(TargetActor.LoadSynchronous()))
     {
-        return LocationActor.Get()->GetActorLocation();
+        return TargetActor.Get()->GetActorLocation();
     }
     Success = false;
     return {};
@@ -216,22 +271,12 @@ FVector UNerveGoToRuntimeObjective::FindGroundLevel(const UWorld* World, const F
 
 void UNerveGoToRuntimeObjective::CleanUpObjective_Implementation()
 {
-    CleanupPing();
-}
-
-void UNerveGoToRuntimeObjective::CleanupPing()
-{
-    if (IsValid(PingManager) && CurrentPingID != -1)
+    if (FNerveGoToObjectiveRun* Run = GetRun<FNerveGoToObjectiveRun>())
     {
-        PingManager->RemovePing(CurrentPingID);
-        CurrentPingID = -1;
+        Run->StopTracking();
+        Run->CleanupPing();
     }
-}
-
-void UNerveGoToRuntimeObjective::BeginDestroy()
-{
-    CleanupPing();
-    Super::BeginDestroy();
+    Super::CleanUpObjective_Implementation();
 }
 
 #if WITH_EDITOR
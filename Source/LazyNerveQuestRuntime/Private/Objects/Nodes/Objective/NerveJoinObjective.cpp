@@ -0,0 +1,60 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+
+#include "Objects/Nodes/Objective/NerveJoinObjective.h"
+#include "Objects/Pin/NerveQuestRuntimePin.h"
+
+UNerveJoinObjective::UNerveJoinObjective()
+{
+    bShowInUI = false;
+}
+
+FText UNerveJoinObjective::GetObjectiveName_Implementation()
+{
+    return FText::FromString(TEXT("Join"));
+}
+
+FText UNerveJoinObjective::GetObjectiveDescription_Implementation()
+{
+    switch (JoinPolicy)
+    {
+    case ENerveJoinPolicy::Any:
+        return NSLOCTEXT("QuestObjectives", "JoinAnyDescription", "Continues with the first branch to arrive.");
+    case ENerveJoinPolicy::Count:
+        return FText::Format(NSLOCTEXT("QuestObjectives", "JoinCountDescription", "Continues once {0} branches arrived."), FText::AsNumber(RequiredBranches));
+    default:
+        return NSLOCTEXT("QuestObjectives", "JoinAllDescription", "Continues once every branch arrived.");
+    }
+}
+
+FText UNerveJoinObjective::GetObjectiveCategory_Implementation()
+{
+    return FText::FromString(TEXT("Flow"));
+}
+
+void UNerveJoinObjective::ExecuteObjective_Implementation(UNerveQuestAsset* NerveQuestAsset)
+{
+    // Only reached when run as a plain objective; the quest counts arriving branches itself
+    Super::ExecuteObjective_Implementation(NerveQuestAsset);
+    CompleteObjective();
+}
+
+int32 UNerveJoinObjective::GetNumConnectedBranches() const
+{
+    return IsValid(InputPin) ? FMath::Max(InputPin->GetValidConnections().Num(), 1) : 1;
+}
+
+int32 UNerveJoinObjective::GetRequiredBranches(const int32 NumConnectedBranches) const
+{
+    const int32 NumBranches = FMath::Max(NumConnectedBranches, 1);
+
+    switch (JoinPolicy)
+    {
+    case ENerveJoinPolicy::Any:
+        return 1;
+    case ENerveJoinPolicy::Count:
+        return FMath::Clamp(RequiredBranches, 1, NumBranches);
+    default:
+        return NumBranches;
+    }
+}
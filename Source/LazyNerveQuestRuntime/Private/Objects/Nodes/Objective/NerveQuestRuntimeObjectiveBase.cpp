@@ -3,6 +3,9 @@
 
 #include "Objects/Nodes/Objective/NerveQuestRuntimeObjectiveBase.h"
 #include "BlueprintNodeHelpers.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "Objects/Modifiers/NerveObjectiveModifier.h"
 #include "Objects/NerveQuest/NerveQuestAsset.h"
 #include "Objects/Pin/NerveQuestRuntimePin.h"
 #include "Setting/NerveQuestRuntimeSetting.h"
@@ -15,21 +18,36 @@ UNerveQuestRuntimeObjectiveBase::UNerveQuestRuntimeObjectiveBase()
 	}
 }
 
+FNerveObjectiveRunScope::FNerveObjectiveRunScope(FNerveObjectiveRun& Run)
+	: Objective(Run.Objective.Get())
+	, PinnedRun(Run.AsShared())
+{
+	if (!Objective) return;
+
+	PreviousRun = Objective->ActiveRun;
+	Objective->ActiveRun = &Run;
+}
+
+FNerveObjectiveRunScope::~FNerveObjectiveRunScope()
+{
+	if (Objective) Objective->ActiveRun = PreviousRun;
+}
+
 UWorld* UNerveQuestRuntimeObjectiveBase::GetWorld() const
 {
-	// 1. Try stored world context object
-	if (const UObject* WorldContext = WorldContextObject.Get())
+	// 1. Try the world context of the active run
+	if (const UObject* WorldContext = GetWorldContextObject())
 	{
 		if (UWorld* World = WorldContext->GetWorld())
 		{
 			return World;
 		}
 	}
-	
-	// 2. Try parent quest asset's world
-	if (IsValid(ParentQuestAsset))
+
+	// 2. Try the running quest's world
+	if (const UNerveQuestAsset* QuestAsset = GetRunningQuestAsset())
 	{
-		if (UWorld* World = ParentQuestAsset->GetWorld())
+		if (UWorld* World = QuestAsset->GetWorld())
 		{
 			return World;
 		}
@@ -51,6 +69,51 @@ UWorld* UNerveQuestRuntimeObjectiveBase::GetWorld() const
 	return nullptr;
 }
 
+const UObject* UNerveQuestRuntimeObjectiveBase::GetWorldContextObject() const
+{
+	const FNerveObjectiveRun* Run = GetActiveRun();
+	return Run ? Run->WorldContextObject.Get() : nullptr;
+}
+
+int32 UNerveQuestRuntimeObjectiveBase::GetTimerScope() const
+{
+	const FNerveObjectiveRun* Run = GetActiveRun();
+	return Run ? Run->TimerScope : 0;
+}
+
+UNerveQuestAsset* UNerveQuestRuntimeObjectiveBase::GetRunningQuestAsset() const
+{
+	const FNerveObjectiveRun* Run = GetActiveRun();
+	return Run ? Run->QuestAsset.Get() : nullptr;
+}
+
+FNerveObjectiveRun* UNerveQuestRuntimeObjectiveBase::GetActiveRun() const
+{
+	if (ActiveRun) return ActiveRun;
+
+	// Owned by the objective's runtime data, so the pointer outlives the pin
+	return LatestRun.Pin().Get();
+}
+
+ULocalPlayer* UNerveQuestRuntimeObjectiveBase::GetOwningLocalPlayer() const
+{
+	const FNerveObjectiveRun* Run = GetActiveRun();
+	if (ULocalPlayer* LocalPlayer = Run ? Run->OwningLocalPlayer.Get() : nullptr)
+	{
+		return LocalPlayer;
+	}
+
+	// Objectives run outside a quest subsystem (previews, tests) fall back to the primary player
+	const UWorld* World = GetWorld();
+	return IsValid(World) ? World->GetFirstLocalPlayerFromController() : nullptr;
+}
+
+APlayerController* UNerveQuestRuntimeObjectiveBase::GetOwningPlayerController() const
+{
+	const ULocalPlayer* LocalPlayer = GetOwningLocalPlayer();
+	return LocalPlayer ? LocalPlayer->GetPlayerController(GetWorld()) : nullptr;
+}
+
 UNerveQuestRuntimePin* UNerveQuestRuntimeObjectiveBase::FindOutPinByCategory(const FName InCategory)
 {
 	if (OutPutPin.IsEmpty()) return nullptr;
@@ -93,9 +156,7 @@ FSlateBrush UNerveQuestRuntimeObjectiveBase::GetObjectiveBrush_Implementation()
 { return FSlateBrush(); }
 
 void UNerveQuestRuntimeObjectiveBase::ExecuteObjective_Implementation(UNerveQuestAsset* QuestManager)
-{
-	ParentQuestAsset = QuestManager;
-}
+{}
 
 void UNerveQuestRuntimeObjectiveBase::PauseObjective_Implementation()
 {}
@@ -111,17 +172,227 @@ void UNerveQuestRuntimeObjectiveBase::MarkAsTracked_Implementation(bool TrackVal
 
 void UNerveQuestRuntimeObjectiveBase::CompleteObjective()
 {
-	OnObjectiveCompleted.Broadcast(this);
+	FNerveObjectiveRun* Run = GetActiveRun();
+	if (!Run || !Run->bRunning || Run->bFailedByModifier) return;
+
+	// Completion only counts when every modifier agrees, e.g. the time limit was met
+	if (Run->bModifiersActive && (!CheckModifierConditions(*Run) || !ValidateModifierCompletion(*Run)))
+	{
+		FailFromModifier(nullptr);
+		return;
+	}
+
+	FinishRun(*Run, true);
 }
 
 void UNerveQuestRuntimeObjectiveBase::FailObjective()
 {
-	OnObjectiveFailed.Broadcast(this);
+	FNerveObjectiveRun* Run = GetActiveRun();
+	if (!Run) return;
+
+	FinishRun(*Run, false);
 }
 
 void UNerveQuestRuntimeObjectiveBase::ExecuteProgress(const float NewValue, const float MaxValue)
 {
+	FNerveObjectiveRun* Run = GetActiveRun();
+	if (!Run || !Run->bRunning || Run->bFailedByModifier) return;
+
+	if (Run->bModifiersActive)
+	{
+		for (UNerveObjectiveModifier* Modifier : Modifiers)
+		{
+			if (IsValid(Modifier)) Modifier->OnObjectiveProgress(*Run);
+		}
+
+		if (!CheckModifierConditions(*Run))
+		{
+			FailFromModifier(nullptr);
+			return;
+		}
+	}
+
 	OnProgressChanged.Broadcast(this, NewValue, MaxValue);
+	Run->OnProgress.ExecuteIfBound(*Run, NewValue, MaxValue);
+}
+
+void UNerveQuestRuntimeObjectiveBase::FailFromModifier(const UNerveObjectiveModifier* Modifier)
+{
+	FNerveObjectiveRun* Run = GetActiveRun();
+	if (!Run || !Run->bRunning || Run->bFailedByModifier) return;
+
+	UE_LOG(LogTemp, Log, TEXT("UNerveQuestRuntimeObjectiveBase::FailFromModifier - %s failed by %s"), *GetName(),
+		Modifier ? *Modifier->GetName() : TEXT("modifier condition"));
+
+	Run->bFailedByModifier = true;
+	FailObjective();
+}
+
+TSharedRef<FNerveObjectiveRun> UNerveQuestRuntimeObjectiveBase::MakeRun() const
+{
+	return MakeShared<FNerveObjectiveRun>();
+}
+
+TSharedRef<FNerveObjectiveRun> UNerveQuestRuntimeObjectiveBase::CreateRun(UNerveQuestAsset* QuestAsset, const UObject* WorldContextObject,
+	ULocalPlayer* LocalPlayer, const int32 TimerScope)
+{
+	TSharedRef<FNerveObjectiveRun> Run = MakeRun();
+	Run->Objective = this;
+	Run->QuestAsset = QuestAsset;
+	Run->WorldContextObject = WorldContextObject;
+	Run->OwningLocalPlayer = LocalPlayer;
+	Run->TimerScope = TimerScope;
+	return Run;
+}
+
+void UNerveQuestRuntimeObjectiveBase::BeginObjective(FNerveObjectiveRun& Run)
+{
+	FNerveObjectiveRunScope Scope(Run);
+	LatestRun = Run.AsShared();
+
+	Run.bRunning = true;
+	Run.bEnded = false;
+	StartModifiers(Run);
+	ExecuteObjective(Run.QuestAsset.Get());
+}
+
+void UNerveQuestRuntimeObjectiveBase::EndObjective(FNerveObjectiveRun& Run)
+{
+	if (Run.bEnded) return;
+	Run.bEnded = true;
+
+	FNerveObjectiveRunScope Scope(Run);
+
+	// Unbound first so a run cancelled by its owner does not report back while cleaning up
+	Run.OnFinished.Unbind();
+	Run.OnProgress.Unbind();
+
+	CleanUpObjective();
+	StopModifiers(Run);
+	Run.bRunning = false;
+}
+
+void UNerveQuestRuntimeObjectiveBase::PauseRun(FNerveObjectiveRun& Run)
+{
+	FNerveObjectiveRunScope Scope(Run);
+	PauseObjective();
+}
+
+void UNerveQuestRuntimeObjectiveBase::ResumeRun(FNerveObjectiveRun& Run)
+{
+	FNerveObjectiveRunScope Scope(Run);
+	ResumeObjective();
+}
+
+void UNerveQuestRuntimeObjectiveBase::TrackRun(FNerveObjectiveRun& Run, const bool bTracked)
+{
+	FNerveObjectiveRunScope Scope(Run);
+	MarkAsTracked(bTracked);
+}
+
+void UNerveQuestRuntimeObjectiveBase::FinishRun(FNerveObjectiveRun& Run, const bool bCompleted)
+{
+	if (!Run.bRunning) return;
+	Run.bRunning = false;
+
+	FNerveObjectiveRunScope Scope(Run);
+	StopModifiers(Run);
+
+	if (bCompleted)
+	{
+		OnObjectiveCompleted.Broadcast(this);
+	}
+	else
+	{
+		OnObjectiveFailed.Broadcast(this);
+	}
+	Run.OnFinished.ExecuteIfBound(Run, bCompleted);
+}
+
+void UNerveQuestRuntimeObjectiveBase::StartModifiers(FNerveObjectiveRun& Run)
+{
+	// A restarted run (sequences, retries) ends the previous attempt first
+	StopModifiers(Run);
+	Run.bFailedByModifier = false;
+
+	for (UNerveObjectiveModifier* Modifier : Modifiers)
+	{
+		if (!IsValid(Modifier)) continue;
+
+		Modifier->OnObjectiveStart(Run);
+		Run.bModifiersActive = true;
+	}
+}
+
+void UNerveQuestRuntimeObjectiveBase::StopModifiers(FNerveObjectiveRun& Run)
+{
+	if (!Run.bModifiersActive) return;
+	Run.bModifiersActive = false;
+
+	for (UNerveObjectiveModifier* Modifier : Modifiers)
+	{
+		if (IsValid(Modifier)) Modifier->OnObjectiveEnd(Run);
+	}
+}
+
+bool UNerveQuestRuntimeObjectiveBase::CheckModifierConditions(FNerveObjectiveRun& Run) const
+{
+	for (UNerveObjectiveModifier* Modifier : Modifiers)
+	{
+		if (IsValid(Modifier) && !Modifier->CheckCondition(Run)) return false;
+	}
+	return true;
+}
+
+bool UNerveQuestRuntimeObjectiveBase::ValidateModifierCompletion(FNerveObjectiveRun& Run) const
+{
+	for (UNerveObjectiveModifier* Modifier : Modifiers)
+	{
+		if (IsValid(Modifier) && !Modifier->ValidateCompletion(Run)) return false;
+	}
+	return true;
+}
+
+bool UNerveQuestRuntimeObjectiveBase::GetBoundParameter(const FName PropertyName, FString& OutValue) const
+{
+	const FName* ParameterName = ParameterBindings.Find(PropertyName);
+	const UNerveQuestAsset* QuestAsset = GetRunningQuestAsset();
+	if (!ParameterName || !IsValid(QuestAsset)) return false;
+
+	return QuestAsset->FindQuestParameter(*ParameterName, OutValue);
+}
+
+bool UNerveQuestRuntimeObjectiveBase::ImportBoundParameter(const FName PropertyName, void* Value, const int32 ValueSize) const
+{
+	// Nodes are shared by every quest running the graph, so the parameter is imported into the caller's copy
+	if (ParameterBindings.IsEmpty()) return false;
+
+	FString Text;
+	if (!GetBoundParameter(PropertyName, Text))
+	{
+		if (ParameterBindings.Contains(PropertyName) && GetRunningQuestAsset())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UNerveQuestRuntimeObjectiveBase::ImportBoundParameter - Quest %s has no parameter %s"),
+				*GetRunningQuestAsset()->GetName(), *ParameterBindings[PropertyName].ToString());
+		}
+		return false;
+	}
+
+	const FProperty* Property = FindFProperty<FProperty>(GetClass(), PropertyName);
+	if (!Property || Property->GetSize() != ValueSize)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UNerveQuestRuntimeObjectiveBase::ImportBoundParameter - %s has no property %s of the requested type"),
+			*GetClass()->GetName(), *PropertyName.ToString());
+		return false;
+	}
+
+	if (!Property->ImportText_Direct(*Text, Value, nullptr, PPF_None))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UNerveQuestRuntimeObjectiveBase::ImportBoundParameter - Cannot set %s from '%s'"),
+			*PropertyName.ToString(), *Text);
+		return false;
+	}
+	return true;
 }
 
 #if WITH_EDITOR
@@ -7,13 +7,17 @@
 #include "Objects/Pin/NerveQuestRuntimePin.h"
 #include "Subsystem/NerveQuestSubsystem.h"
 
-UNerveSequenceRuntimeObjective::UNerveSequenceRuntimeObjective():
-CurrentQuestAsset(nullptr), FailedChildCount(0)
+void FNerveSequenceObjectiveRun::AddReferencedObjects(FReferenceCollector& Collector, const UObject* Referencer)
+{
+    for (const TSharedPtr<FNerveObjectiveRun>& ChildRun : ChildRuns)
+    {
+        if (ChildRun.IsValid()) ChildRun->AddReferencedObjects(Collector, Referencer);
+    }
+}
+
+UNerveSequenceRuntimeObjective::UNerveSequenceRuntimeObjective()
 {
     ExecutionType = EObjectiveExecutionType::Parallel;
-    CurrentSequentialIndex = 0;
-    CompletedChildCount = 0;
-    bSequenceStarted = false;
 }
 
 FText UNerveSequenceRuntimeObjective::GetObjectiveName_Implementation()
@@ -23,9 +27,25 @@ FText UNerveSequenceRuntimeObjective::GetObjectiveName_Implementation()
 
 FText UNerveSequenceRuntimeObjective::GetObjectiveDescription_Implementation()
 {
-    FString Description = ExecutionType == EObjectiveExecutionType::Sequential 
-        ? TEXT("Complete objectives in order") 
-        : TEXT("Complete all objectives");
+    FString Description;
+    switch (ExecutionType)
+    {
+        case EObjectiveExecutionType::Sequential:
+            Description = TEXT("Complete objectives in order");
+            break;
+        case EObjectiveExecutionType::Quorum:
+            Description = FString::Printf(TEXT("Complete any %d objectives"), FMath::Max(RequiredChildCount, 1));
+            break;
+        case EObjectiveExecutionType::Race:
+            Description = TEXT("Complete any objective first");
+            break;
+        case EObjectiveExecutionType::WeightedThreshold:
+            Description = FString::Printf(TEXT("Complete objectives worth %g"), WeightThreshold);
+            break;
+        default:
+            Description = TEXT("Complete all objectives");
+            break;
+    }
     return FText::FromString(Description);
 }
 
@@ -39,66 +59,72 @@ FSlateBrush UNerveSequenceRuntimeObjective::GetObjectiveBrush_Implementation() c
     return FSlateBrush();
 }
 
+TSharedRef<FNerveObjectiveRun> UNerveSequenceRuntimeObjective::MakeRun() const
+{
+    return MakeShared<FNerveSequenceObjectiveRun>();
+}
+
 void UNerveSequenceRuntimeObjective::ExecuteObjective_Implementation(UNerveQuestAsset* QuestManager)
 {
     Super::ExecuteObjective_Implementation(QuestManager);
     
-    if (!IsValid(QuestManager))
+    FNerveSequenceObjectiveRun* Run = GetRun<FNerveSequenceObjectiveRun>();
+    if (!IsValid(QuestManager) || !Run)
     {
         UE_LOG(LogTemp, Error, TEXT("UNerveSequenceRuntimeObjective: Invalid QuestManager"));
         return;
     }
 
-    CurrentQuestAsset = QuestManager;
-    bSequenceStarted = true;
+    Run->bSequenceFinished = false;
     
-    // Collect all child objectives from output pins
-    const bool Success = CollectChildObjectives();
+    // Compiled on first execution, reused by every restart and every run afterwards
+    CompileSequencePlan();
+    ResetChildState(*Run);
     
-    if (Success && ChildObjectives.IsEmpty())
+    if (ChildObjectives.IsEmpty())
     {
         UE_LOG(LogTemp, Warning, TEXT("UNerveSequenceRuntimeObjective: No child objectives found"));
-        OnObjectiveCompleted.Broadcast(this);
+        FinishSequence(*Run, true);
         return;
     }
 
-    // Initialize counters
-    CurrentSequentialIndex = 0;
-    CompletedChildCount = 0;
-    FailedChildCount = 0;
-
-    // Execute based on type
-    switch (ExecutionType)
+    // Execute based on type; every mode but Sequential starts all children at once
+    if (ExecutionType == EObjectiveExecutionType::Sequential)
     {
-        case EObjectiveExecutionType::Sequential:
-            ExecuteSequential();
-            break;
-        case EObjectiveExecutionType::Parallel:
-            ExecuteParallel();
-            break;
+        ExecuteSequential(*Run);
+    }
+    else
+    {
+        ExecuteParallel(*Run);
     }
 }
 
 void UNerveSequenceRuntimeObjective::PauseObjective_Implementation()
 {
+    FNerveSequenceObjectiveRun* Run = GetRun<FNerveSequenceObjectiveRun>();
+    if (!Run) return;
+
     // Pause all active child objectives
-    for (UNerveQuestRuntimeObjectiveBase* Child : ChildObjectives)
+    for (TConstSetBitIterator<> It(Run->ActiveChildren); It; ++It)
     {
-        if (IsValid(Child) && ActiveChildObjectives.Contains(Child))
+        if (IsValid(ChildObjectives[It.GetIndex()]) && Run->ChildRuns[It.GetIndex()].IsValid())
         {
-            Child->PauseObjective();
+            ChildObjectives[It.GetIndex()]->PauseRun(*Run->ChildRuns[It.GetIndex()]);
         }
     }
 }
 
 void UNerveSequenceRuntimeObjective::ResumeObjective_Implementation()
 {
+    FNerveSequenceObjectiveRun* Run = GetRun<FNerveSequenceObjectiveRun>();
+    if (!Run) return;
+
     // Resume all active child objectives
-    for (UNerveQuestRuntimeObjectiveBase* Child : ChildObjectives)
+    for (TConstSetBitIterator<> It(Run->ActiveChildren); It; ++It)
     {
-        if (IsValid(Child) && ActiveChildObjectives.Contains(Child))
+        if (IsValid(ChildObjectives[It.GetIndex()]) && Run->ChildRuns[It.GetIndex()].IsValid())
         {
-            Child->ResumeObjective();
+            ChildObjectives[It.GetIndex()]->ResumeRun(*Run->ChildRuns[It.GetIndex()]);
         }
     }
 }
@@ -106,270 +132,431 @@ void UNerveSequenceRuntimeObjective::ResumeObjective_Implementation()
 void UNerveSequenceRuntimeObjective::MarkAsTracked_Implementation(bool TrackValue)
 {
     Super::MarkAsTracked_Implementation(TrackValue);
+
+    FNerveSequenceObjectiveRun* Run = GetRun<FNerveSequenceObjectiveRun>();
+    if (!Run) return;
     
     // Mark all active child objectives as tracked/untracked
-    for (UNerveQuestRuntimeObjectiveBase* Child : ActiveChildObjectives)
+    for (TConstSetBitIterator<> It(Run->ActiveChildren); It; ++It)
     {
-        if (IsValid(Child))
+        if (IsValid(ChildObjectives[It.GetIndex()]) && Run->ChildRuns[It.GetIndex()].IsValid())
         {
-            Child->MarkAsTracked(TrackValue);
+            ChildObjectives[It.GetIndex()]->TrackRun(*Run->ChildRuns[It.GetIndex()], TrackValue);
         }
     }
 }
 
 void UNerveSequenceRuntimeObjective::CleanUpObjective_Implementation()
 {
-    // Clean up all child objectives
-    for (UNerveQuestRuntimeObjectiveBase* Child : ChildObjectives)
+    if (FNerveSequenceObjectiveRun* Run = GetRun<FNerveSequenceObjectiveRun>())
     {
-        if (IsValid(Child))
+        // Clean up all child runs; the compiled plan itself is kept
+        for (int32 ChildIndex = 0; ChildIndex < Run->ChildRuns.Num(); ++ChildIndex)
         {
-            // Remove delegates
-            Child->OnObjectiveCompleted.RemoveAll(this);
-            Child->OnObjectiveFailed.RemoveAll(this);
-            Child->CleanUpObjective();
+            const TSharedPtr<FNerveObjectiveRun> ChildRun = Run->ChildRuns[ChildIndex];
+            if (ChildRun.IsValid() && IsValid(ChildObjectives[ChildIndex]))
+            {
+                ChildObjectives[ChildIndex]->EndObjective(*ChildRun);
+            }
         }
+
+        ResetChildState(*Run);
+        Run->ChildRuns.Reset();
+        Run->bSequenceFinished = true;
     }
     
-    ChildObjectives.Empty();
-    ActiveChildObjectives.Empty();
-    CompletedChildObjectives.Empty();
-    
     Super::CleanUpObjective_Implementation();
 }
 
-bool UNerveSequenceRuntimeObjective::CollectChildObjectives()
+bool UNerveSequenceRuntimeObjective::CompileSequencePlan()
 {
+    if (bPlanCompiled) return true;
     ChildObjectives.Empty();
 
     UNerveQuestRuntimePin* SequencePin = FindOutPinByCategory(FLazyNerveQuestRuntimeModule::NerveQuestSequencePinCategory);
     if (!IsValid(SequencePin)) return false;
 
-    if (SequencePin->Connection.IsEmpty()) return false;
-
     // This will maily be connected to one node so no need for a loop
-    const TWeakObjectPtr<UNerveQuestRuntimePin> ConnectedPin = SequencePin->Connection[0];
+    const TArray<UNerveQuestRuntimePin*> SequenceConnections = SequencePin->GetValidConnections();
+    if (SequenceConnections.IsEmpty()) return false;
 
-    if (!ConnectedPin.IsValid()) return false;
-    
-    AccumulateAllSequenceChildren(ConnectedPin.Get()->ParentNode.Get());
-    
-    UE_LOG(LogTemp, Log, TEXT("UNerveSequenceRuntimeObjective: Collected %d child objectives"), ChildObjectives.Num());
+    // Follow the first output of each child to the next one; the visited set guards against cycles in the graph
+    TSet<const UNerveQuestRuntimeObjectiveBase*> Visited;
+    UNerveQuestRuntimeObjectiveBase* Node = SequenceConnections[0]->GetParentNode();
+    while (IsValid(Node) && !Visited.Contains(Node))
+    {
+        Visited.Add(Node);
+        ChildObjectives.Add(Node);
+
+        const UNerveQuestRuntimePin* OutPin = Node->OutPutPin.IsEmpty() ? nullptr : Node->OutPutPin[0].Get();
+        const TArray<UNerveQuestRuntimePin*> NextConnections = IsValid(OutPin) ? OutPin->GetValidConnections() : TArray<UNerveQuestRuntimePin*>();
+        Node = NextConnections.IsEmpty() ? nullptr : NextConnections[0]->GetParentNode();
+    }
+
+    bPlanCompiled = true;
+    UE_LOG(LogTemp, Log, TEXT("UNerveSequenceRuntimeObjective: Compiled %d child objectives"), ChildObjectives.Num());
     return true;
 }
 
-void UNerveSequenceRuntimeObjective::AccumulateAllSequenceChildren(UNerveQuestRuntimeObjectiveBase* ParentNode)
+void UNerveSequenceRuntimeObjective::ResetChildState(FNerveSequenceObjectiveRun& Run) const
 {
-    if (!IsValid(ParentNode)) return;
-    ChildObjectives.Add(ParentNode);
-    
-    if (ParentNode->OutPutPin.IsEmpty()) return;
-    const UNerveQuestRuntimePin* ConnectedPin = ParentNode->OutPutPin[0];
+    const int32 NumChildren = ChildObjectives.Num();
+    Run.ChildRuns.SetNum(NumChildren);
+    Run.ActiveChildren.Init(false, NumChildren);
+    Run.CompletedChildren.Init(false, NumChildren);
+    Run.FailedChildren.Init(false, NumChildren);
 
-    AccumulateAllSequenceChildren(ConnectedPin->ParentNode.Get());
+    Run.ActiveChildCount = 0;
+    Run.ActiveChildWeight = 0.0f;
+    Run.CompletedChildWeight = 0.0f;
+    Run.CurrentSequentialIndex = 0;
+    Run.CompletedChildCount = 0;
+    Run.FailedChildCount = 0;
 }
 
-void UNerveSequenceRuntimeObjective::ExecuteSequential()
+void UNerveSequenceRuntimeObjective::ExecuteSequential(FNerveSequenceObjectiveRun& Run)
 {
-    if (CurrentSequentialIndex >= ChildObjectives.Num())
+    if (Run.CurrentSequentialIndex >= ChildObjectives.Num())
     {
         // All objectives completed
-        OnObjectiveCompleted.Broadcast(this);
+        FinishSequence(Run, true);
         return;
     }
     
-    UNerveQuestRuntimeObjectiveBase* CurrentChild = ChildObjectives[CurrentSequentialIndex];
-    if (!IsValid(CurrentChild))
+    if (!IsValid(ChildObjectives[Run.CurrentSequentialIndex]))
     {
-        UE_LOG(LogTemp, Error, TEXT("UNerveSequenceRuntimeObjective: Invalid child objective at index %d"), CurrentSequentialIndex);
-        OnObjectiveFailed.Broadcast(this);
+        UE_LOG(LogTemp, Error, TEXT("UNerveSequenceRuntimeObjective: Invalid child objective at index %d"), Run.CurrentSequentialIndex);
+        FinishSequence(Run, false);
         return;
     }
     
-    // Set up delegates for the current child
-    CurrentChild->OnObjectiveCompleted.AddDynamic(this, &UNerveSequenceRuntimeObjective::OnChildObjectiveCompleted);
-    CurrentChild->OnObjectiveFailed.AddDynamic(this, &UNerveSequenceRuntimeObjective::OnChildObjectiveFailed);
-    
-    // Add to active objectives and execute
-    ActiveChildObjectives.Empty(); // Only one active at a time for sequential
-    ActiveChildObjectives.Add(CurrentChild);
-    CurrentChild->ExecuteObjective(CurrentQuestAsset);
-    
     UE_LOG(LogTemp, Log, TEXT("UNerveSequenceRuntimeObjective: Executing sequential objective %d/%d"), 
-    CurrentSequentialIndex + 1, ChildObjectives.Num());
+    Run.CurrentSequentialIndex + 1, ChildObjectives.Num());
+
+    // Only one active at a time for sequential
+    StartChild(Run, Run.CurrentSequentialIndex);
 }
 
-void UNerveSequenceRuntimeObjective::ExecuteParallel()
+void UNerveSequenceRuntimeObjective::ExecuteParallel(FNerveSequenceObjectiveRun& Run)
 {
-    ActiveChildObjectives.Empty();
-    
     // Start all child objectives simultaneously
-    for (UNerveQuestRuntimeObjectiveBase* Child : ChildObjectives)
+    Run.bLaunchingChildren = true;
+    for (int32 ChildIndex = 0; ChildIndex < ChildObjectives.Num() && !Run.bSequenceFinished; ++ChildIndex)
     {
-        if (!IsValid(Child)) continue;
-            
-        // Set up delegates
-        Child->OnObjectiveCompleted.AddDynamic(this, &UNerveSequenceRuntimeObjective::OnChildObjectiveCompleted);
-        Child->OnObjectiveFailed.AddDynamic(this, &UNerveSequenceRuntimeObjective::OnChildObjectiveFailed);
-        
-        // Add to active and execute
-        ActiveChildObjectives.Add(Child);
-        Child->ExecuteObjective(CurrentQuestAsset);
+        if (!IsValid(ChildObjectives[ChildIndex]))
+        {
+            // Counts as failed right away instead of leaving the sequence waiting forever
+            Run.FailedChildren[ChildIndex] = true;
+            Run.FailedChildCount++;
+            continue;
+        }
+        StartChild(Run, ChildIndex);
     }
+    Run.bLaunchingChildren = false;
     
-    UE_LOG(LogTemp, Log, TEXT("UNerveSequenceRuntimeObjective: Executing %d parallel objectives"), ActiveChildObjectives.Num());
+    UE_LOG(LogTemp, Log, TEXT("UNerveSequenceRuntimeObjective: Executing %d parallel objectives"), Run.ActiveChildCount);
+    CheckParallelFinished(Run);
 }
 
-void UNerveSequenceRuntimeObjective::OnChildObjectiveCompleted(UNerveQuestRuntimeObjectiveBase* CompletedObjective)
+void UNerveSequenceRuntimeObjective::StartChild(FNerveSequenceObjectiveRun& Run, const int32 ChildIndex)
 {
-    if (!IsValid(CompletedObjective)) return;
-    
-    // Remove from active and add to completed
-    ActiveChildObjectives.Remove(CompletedObjective);
-    CompletedChildObjectives.AddUnique(CompletedObjective);
-    CompletedChildCount++;
-    
-    // Remove delegates
-    CompletedObjective->OnObjectiveCompleted.RemoveAll(this);
-    CompletedObjective->OnObjectiveFailed.RemoveAll(this);
-    
-    UE_LOG(LogTemp, Log, TEXT("UNerveSequenceRuntimeObjective: Child objective completed (%d/%d)"), 
-    CompletedChildCount, ChildObjectives.Num());
-    
-    // Handle completion based on execution type
-    if (ExecutionType == EObjectiveExecutionType::Sequential)
+    UNerveQuestRuntimeObjectiveBase* Child = ChildObjectives[ChildIndex];
+
+    // A restart replaces the child's previous run, which may still have to clean up
+    if (const TSharedPtr<FNerveObjectiveRun>& PreviousRun = Run.ChildRuns[ChildIndex])
+    {
+        Child->EndObjective(*PreviousRun);
+    }
+
+    Run.ActiveChildren[ChildIndex] = true;
+    Run.ActiveChildCount++;
+    Run.ActiveChildWeight += GetChildWeight(ChildIndex);
+
+    // Children run in the sequence's quest, world and timer scope; the index payload makes every child event O(1)
+    const TSharedRef<FNerveObjectiveRun> ChildRun = Child->CreateRun(Run.QuestAsset.Get(), Run.WorldContextObject.Get(), Run.OwningLocalPlayer.Get(), Run.TimerScope);
+    ChildRun->OnFinished.BindUObject(this, &UNerveSequenceRuntimeObjective::HandleChildFinished, TWeakPtr<FNerveObjectiveRun>(Run.AsShared()), ChildIndex);
+    Run.ChildRuns[ChildIndex] = ChildRun;
+    Child->BeginObjective(*ChildRun);
+}
+
+void UNerveSequenceRuntimeObjective::StopChild(FNerveSequenceObjectiveRun& Run, const int32 ChildIndex, const bool bCleanUp)
+{
+    if (!Run.ActiveChildren[ChildIndex]) return;
+
+    Run.ActiveChildren[ChildIndex] = false;
+    Run.ActiveChildCount--;
+    Run.ActiveChildWeight -= GetChildWeight(ChildIndex);
+
+    UNerveQuestRuntimeObjectiveBase* Child = ChildObjectives[ChildIndex];
+    const TSharedPtr<FNerveObjectiveRun> ChildRun = Run.ChildRuns[ChildIndex];
+    if (!IsValid(Child) || !ChildRun.IsValid()) return;
+
+    ChildRun->OnFinished.Unbind();
+    if (bCleanUp)
+    {
+        Child->EndObjective(*ChildRun);
+    }
+}
+
+void UNerveSequenceRuntimeObjective::FinishSequence(FNerveSequenceObjectiveRun& Run, const bool bCompleted)
+{
+    if (Run.bSequenceFinished) return;
+    Run.bSequenceFinished = true;
+
+    // Children still running can no longer change the outcome; iterate a copy since stopping clears bits
+    const TBitArray<> ChildrenToStop = Run.ActiveChildren;
+    for (TConstSetBitIterator<> It(ChildrenToStop); It; ++It)
+    {
+        StopChild(Run, It.GetIndex(), true);
+    }
+
+    if (bCompleted)
+    {
+        CompleteObjective();
+    }
+    else
+    {
+        FailObjective();
+    }
+}
+
+void UNerveSequenceRuntimeObjective::CheckParallelFinished(FNerveSequenceObjectiveRun& Run)
+{
+    if (Run.bSequenceFinished) return;
+
+    switch (ExecutionType)
     {
-        CurrentSequentialIndex++;
-        if (CurrentSequentialIndex >= ChildObjectives.Num())
+        case EObjectiveExecutionType::Quorum:
+        case EObjectiveExecutionType::Race:
         {
-            // All sequential objectives completed
-            OnObjectiveCompleted.Broadcast(this);
+            const int32 Required = GetRequiredChildCount();
+            if (Run.CompletedChildCount >= Required)
+            {
+                FinishSequence(Run, true);
+            }
+            else if (!Run.bLaunchingChildren && Run.CompletedChildCount + Run.ActiveChildCount < Required)
+            {
+                UE_LOG(LogTemp, Log, TEXT("UNerveSequenceRuntimeObjective: %d of %d required children can no longer complete"),
+                    Required - Run.CompletedChildCount, Required);
+                FinishSequence(Run, false);
+            }
+            break;
         }
-        else
+        case EObjectiveExecutionType::WeightedThreshold:
         {
-            // Execute next objective in sequence
-            ExecuteSequential();
+            const float Threshold = FMath::Max(WeightThreshold, 0.0f);
+            if (Run.CompletedChildWeight >= Threshold - KINDA_SMALL_NUMBER)
+            {
+                FinishSequence(Run, true);
+            }
+            else if (!Run.bLaunchingChildren && Run.CompletedChildWeight + Run.ActiveChildWeight < Threshold - KINDA_SMALL_NUMBER)
+            {
+                UE_LOG(LogTemp, Log, TEXT("UNerveSequenceRuntimeObjective: Weight threshold %g can no longer be reached"), Threshold);
+                FinishSequence(Run, false);
+            }
+            break;
         }
-    }
-    else // Parallel
-    {
-        if (CompletedChildCount >= ChildObjectives.Num())
+        default:
         {
-            // All parallel objectives completed
-            OnObjectiveCompleted.Broadcast(this);
+            if (Run.bLaunchingChildren || Run.ActiveChildCount > 0) return;
+
+            // Children that failed with ContinueToNextObjective do not block completion, as long as one child completed
+            FinishSequence(Run, Run.CompletedChildCount > 0 || Run.FailedChildCount == 0);
+            break;
         }
     }
-    
-    // Broadcast progress update
-    const float Progress = static_cast<float>(CompletedChildCount) / static_cast<float>(ChildObjectives.Num());
-    OnProgressChanged.Broadcast(this, Progress, 1.0f);
 }
 
-void UNerveSequenceRuntimeObjective::OnChildObjectiveFailed(UNerveQuestRuntimeObjectiveBase* FailedObjective)
+bool UNerveSequenceRuntimeObjective::IsThresholdMode() const
+{
+    return ExecutionType == EObjectiveExecutionType::Quorum
+        || ExecutionType == EObjectiveExecutionType::Race
+        || ExecutionType == EObjectiveExecutionType::WeightedThreshold;
+}
+
+int32 UNerveSequenceRuntimeObjective::GetRequiredChildCount() const
+{
+    if (ExecutionType == EObjectiveExecutionType::Race) return 1;
+    return FMath::Clamp(RequiredChildCount, 1, FMath::Max(ChildObjectives.Num(), 1));
+}
+
+float UNerveSequenceRuntimeObjective::GetChildWeight(const int32 ChildIndex) const
+{
+    const UNerveQuestRuntimeObjectiveBase* Child = ChildObjectives[ChildIndex];
+    return IsValid(Child) ? Child->GetObjectiveWeight() : 0.0f;
+}
+
+void UNerveSequenceRuntimeObjective::HandleChildFinished(FNerveObjectiveRun& ChildRun, const bool bCompleted,
+    const TWeakPtr<FNerveObjectiveRun> WeakSequenceRun, const int32 ChildIndex)
+{
+    const TSharedPtr<FNerveObjectiveRun> PinnedRun = WeakSequenceRun.Pin();
+    if (!PinnedRun.IsValid()) return;
+
+    FNerveSequenceObjectiveRun& Run = static_cast<FNerveSequenceObjectiveRun&>(*PinnedRun);
+    if (Run.bSequenceFinished || !Run.ActiveChildren.IsValidIndex(ChildIndex) || !Run.ActiveChildren[ChildIndex]) return;
+
+    FNerveObjectiveRunScope Scope(Run);
+    StopChild(Run, ChildIndex, false);
+    if (bCompleted)
+    {
+        OnChildObjectiveCompleted(Run, ChildIndex);
+    }
+    else
+    {
+        OnChildObjectiveFailed(Run, ChildIndex);
+    }
+}
+
+void UNerveSequenceRuntimeObjective::OnChildObjectiveCompleted(FNerveSequenceObjectiveRun& Run, const int32 ChildIndex)
 {
-    if (!IsValid(FailedObjective)) return;
+    Run.CompletedChildren[ChildIndex] = true;
+    Run.CompletedChildCount++;
+    Run.CompletedChildWeight += GetChildWeight(ChildIndex);
     
-    // Remove from active
-    ActiveChildObjectives.Remove(FailedObjective);
-    FailedChildCount++;
+    UE_LOG(LogTemp, Log, TEXT("UNerveSequenceRuntimeObjective: Child objective completed (%d/%d)"), 
+    Run.CompletedChildCount, ChildObjectives.Num());
     
-    // Remove delegates
-    FailedObjective->OnObjectiveCompleted.RemoveAll(this);
-    FailedObjective->OnObjectiveFailed.RemoveAll(this);
+    // Broadcast progress update
+    ExecuteProgress(GetSequenceProgress(Run), 1.0f);
+
+    // Handle completion based on execution type
+    if (ExecutionType == EObjectiveExecutionType::Sequential)
+    {
+        // Execute next objective in sequence, or complete after the last one
+        Run.CurrentSequentialIndex++;
+        ExecuteSequential(Run);
+    }
+    else // Parallel
+    {
+        CheckParallelFinished(Run);
+    }
+}
+
+void UNerveSequenceRuntimeObjective::OnChildObjectiveFailed(FNerveSequenceObjectiveRun& Run, const int32 ChildIndex)
+{
+    Run.FailedChildren[ChildIndex] = true;
+    Run.FailedChildCount++;
     
     UE_LOG(LogTemp, Warning, TEXT("UNerveSequenceRuntimeObjective: Child objective failed"));
     
     // Handle failure based on execution type and failure response
-    const EObjectiveFailureResponse ChildFailureResponse = FailedObjective->GetObjectiveFailureResponse();
+    const UNerveQuestRuntimeObjectiveBase* FailedObjective = ChildObjectives[ChildIndex];
+    const EObjectiveFailureResponse ChildFailureResponse = IsValid(FailedObjective)
+        ? FailedObjective->GetObjectiveFailureResponse()
+        : EObjectiveFailureResponse::FailQuest;
+
+    // Threshold modes expect some children to fail; a failure only matters once the threshold is out of reach
+    if (IsThresholdMode() && ChildFailureResponse != EObjectiveFailureResponse::RestartQuest)
+    {
+        CheckParallelFinished(Run);
+        return;
+    }
     
     switch (ChildFailureResponse)
     {
         case EObjectiveFailureResponse::FailQuest:
             // If any child fails with FailQuest, the entire sequence fails
-            OnObjectiveFailed.Broadcast(this);
+            FinishSequence(Run, false);
             break;
             
         case EObjectiveFailureResponse::ContinueToNextObjective:
             if (ExecutionType == EObjectiveExecutionType::Sequential)
             {
                 // Skip to next objective in sequence
-                CurrentSequentialIndex++;
-                if (CurrentSequentialIndex >= ChildObjectives.Num())
-                {
-                    OnObjectiveCompleted.Broadcast(this);
-                }
-                else
-                {
-                    ExecuteSequential();
-                }
+                Run.CurrentSequentialIndex++;
+                ExecuteSequential(Run);
             }
             else // Parallel
             {
                 // For parallel, continue with remaining objectives
-                // Complete the sequence if all remaining objectives are done
-                if (ActiveChildObjectives.IsEmpty())
-                {
-                    if (CompletedChildCount > 0)
-                    {
-                        OnObjectiveCompleted.Broadcast(this);
-                    }
-                    else
-                    {
-                        OnObjectiveFailed.Broadcast(this);
-                    }
-                }
+                CheckParallelFinished(Run);
             }
             break;
             
         case EObjectiveFailureResponse::RestartQuest:
             // Restart the entire sequence
-            RestartSequence();
+            RestartSequence(Run);
             break;
     }
 }
 
-void UNerveSequenceRuntimeObjective::RestartSequence()
+void UNerveSequenceRuntimeObjective::RestartSequence(FNerveSequenceObjectiveRun& Run)
 {
     // Clean up current state
-    for (UNerveQuestRuntimeObjectiveBase* Child : ActiveChildObjectives)
+    const TBitArray<> ChildrenToStop = Run.ActiveChildren;
+    for (TConstSetBitIterator<> It(ChildrenToStop); It; ++It)
     {
-        if (IsValid(Child))
-        {
-            Child->OnObjectiveCompleted.RemoveAll(this);
-            Child->OnObjectiveFailed.RemoveAll(this);
-            Child->CleanUpObjective();
-        }
+        StopChild(Run, It.GetIndex(), true);
     }
     
-    // Reset state
-    ActiveChildObjectives.Empty();
-    CompletedChildObjectives.Empty();
-    CurrentSequentialIndex = 0;
-    CompletedChildCount = 0;
-    FailedChildCount = 0;
-    
-    // Restart execution
-    ExecuteObjective_Implementation(CurrentQuestAsset);
+    // Restart execution; state is reset there
+    ExecuteObjective_Implementation(Run.QuestAsset.Get());
 }
 
 TArray<UNerveQuestRuntimeObjectiveBase*> UNerveSequenceRuntimeObjective::GetActiveChildObjectives() const
 {
+    TArray<UNerveQuestRuntimeObjectiveBase*> ActiveChildObjectives;
+    const FNerveSequenceObjectiveRun* Run = GetRun<FNerveSequenceObjectiveRun>();
+    if (!Run) return ActiveChildObjectives;
+
+    ActiveChildObjectives.Reserve(Run->ActiveChildCount);
+    for (TConstSetBitIterator<> It(Run->ActiveChildren); It; ++It)
+    {
+        ActiveChildObjectives.Add(ChildObjectives[It.GetIndex()]);
+    }
     return ActiveChildObjectives;
 }
 
 TArray<UNerveQuestRuntimeObjectiveBase*> UNerveSequenceRuntimeObjective::GetCompletedChildObjectives() const
 {
+    TArray<UNerveQuestRuntimeObjectiveBase*> CompletedChildObjectives;
+    const FNerveSequenceObjectiveRun* Run = GetRun<FNerveSequenceObjectiveRun>();
+    if (!Run) return CompletedChildObjectives;
+
+    CompletedChildObjectives.Reserve(Run->CompletedChildCount);
+    for (TConstSetBitIterator<> It(Run->CompletedChildren); It; ++It)
+    {
+        CompletedChildObjectives.Add(ChildObjectives[It.GetIndex()]);
+    }
     return CompletedChildObjectives;
 }
 
 float UNerveSequenceRuntimeObjective::GetSequenceProgress() const
+{
+    const FNerveSequenceObjectiveRun* Run = GetRun<FNerveSequenceObjectiveRun>();
+    return Run ? GetSequenceProgress(*Run) : 0.0f;
+}
+
+float UNerveSequenceRuntimeObjective::GetSequenceProgress(const FNerveSequenceObjectiveRun& Run) const
 {
     if (ChildObjectives.IsEmpty()) return 0.0f;
-    
-    return static_cast<float>(CompletedChildCount) / static_cast<float>(ChildObjectives.Num());
+
+    // Progress towards the threshold, so a quorum of 3 reads full after three children
+    switch (ExecutionType)
+    {
+        case EObjectiveExecutionType::Quorum:
+        case EObjectiveExecutionType::Race:
+            return FMath::Min(static_cast<float>(Run.CompletedChildCount) / static_cast<float>(GetRequiredChildCount()), 1.0f);
+        case EObjectiveExecutionType::WeightedThreshold:
+            return WeightThreshold > 0.0f ? FMath::Min(Run.CompletedChildWeight / WeightThreshold, 1.0f) : 1.0f;
+        default:
+            return static_cast<float>(Run.CompletedChildCount) / static_cast<float>(ChildObjectives.Num());
+    }
 }
 
 bool UNerveSequenceRuntimeObjective::IsSequenceComplete() const
 {
-    return CompletedChildCount >= ChildObjectives.Num();
-}
\ No newline at end of file
+    const FNerveSequenceObjectiveRun* Run = GetRun<FNerveSequenceObjectiveRun>();
+    if (!Run) return false;
+
+    switch (ExecutionType)
+    {
+        case EObjectiveExecutionType::Quorum:
+        case EObjectiveExecutionType::Race:
+            return Run->CompletedChildCount >= GetRequiredChildCount();
+        case EObjectiveExecutionType::WeightedThreshold:
+            return Run->CompletedChildWeight >= FMath::Max(WeightThreshold, 0.0f) - KINDA_SMALL_NUMBER;
+        default:
+            return Run->CompletedChildCount >= ChildObjectives.Num();
+    }
+}
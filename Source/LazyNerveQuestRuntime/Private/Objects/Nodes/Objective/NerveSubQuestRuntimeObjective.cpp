@@ -5,15 +5,17 @@
 #include "Objects/NerveQuest/NerveQuestAsset.h"
 #include "LazyNerveRuntimeQuestStyle.h"
 #include "TimerManager.h"
+#include "Engine/LocalPlayer.h"
 #include "Kismet/GameplayStatics.h"
 
+
+void FNerveSubQuestObjectiveRun::AddReferencedObjects(FReferenceCollector& Collector, const UObject* Referencer)
+{
+    Collector.AddReferencedObject(SubQuestRuntimeData, Referencer);
+}
+
 UNerveSubQuestRuntimeObjective::UNerveSubQuestRuntimeObjective()
 {
-    SubQuestRuntimeData = nullptr;
-    QuestSubsystem = nullptr;
-    CurrentRestartAttempts = 0;
-    bIsCurrentlyTracked = false;
-    
     // Set up default display information
     DisplayLabel = TEXT("Execute Sub-Quest");
     DisplayTip = TEXT("Run a nested quest sequence");
@@ -40,13 +42,21 @@ FSlateBrush UNerveSubQuestRuntimeObjective::GetObjectiveBrush_Implementation() c
     return Brush ? *Brush : FSlateBrush();
 }
 
+TSharedRef<FNerveObjectiveRun> UNerveSubQuestRuntimeObjective::MakeRun() const
+{
+    return MakeShared<FNerveSubQuestObjectiveRun>();
+}
+
 void UNerveSubQuestRuntimeObjective::ExecuteObjective_Implementation(UNerveQuestAsset* QuestManager)
 {
     UNerveQuestRuntimeObjectiveBase::ExecuteObjective_Implementation(QuestManager);
-    
+
+    FNerveSubQuestObjectiveRun* Run = GetRun<FNerveSubQuestObjectiveRun>();
+    if (!Run) return;
+
     // Get the quest subsystem
-    QuestSubsystem = GetQuestSubsystem();
-    if (!IsValid(QuestSubsystem))
+    Run->QuestSubsystem = GetQuestSubsystem();
+    if (!Run->QuestSubsystem.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("UNerveSubQuestRuntimeObjective: Could not get quest subsystem"));
         FailObjective();
@@ -62,24 +72,25 @@ void UNerveSubQuestRuntimeObjective::ExecuteObjective_Implementation(UNerveQuest
     }
 
     // Initialize and start the sub-quest
-    if (!InitializeSubQuest())
+    if (!InitializeSubQuest(*Run))
     {
         UE_LOG(LogTemp, Error, TEXT("UNerveSubQuestRuntimeObjective: Failed to initialize sub-quest"));
         FailObjective();
         return;
     }
 
-    StartSubQuest();
+    StartSubQuest(*Run);
 }
 
 void UNerveSubQuestRuntimeObjective::PauseObjective_Implementation()
 {
     UNerveQuestRuntimeObjectiveBase::PauseObjective_Implementation();
     
-    // Pause the sub-quest if it's running
-    if (IsValid(SubQuestRuntimeData) && IsValid(SubQuestRuntimeData->CurrentObjective))
+    // Pause the sub-quest if it's running, timers included
+    const FNerveSubQuestObjectiveRun* Run = GetRun<FNerveSubQuestObjectiveRun>();
+    if (Run && IsValid(Run->SubQuestRuntimeData))
     {
-        SubQuestRuntimeData->CurrentObjective->ParentObjective->PauseObjective();
+        Run->SubQuestRuntimeData->PauseQuest();
     }
 }
 
@@ -88,23 +99,31 @@ void UNerveSubQuestRuntimeObjective::ResumeObjective_Implementation()
     UNerveQuestRuntimeObjectiveBase::ResumeObjective_Implementation();
     
     // Resume the sub-quest if it's paused
-    if (IsValid(SubQuestRuntimeData) && IsValid(SubQuestRuntimeData->CurrentObjective))
+    const FNerveSubQuestObjectiveRun* Run = GetRun<FNerveSubQuestObjectiveRun>();
+    if (Run && IsValid(Run->SubQuestRuntimeData))
     {
-        SubQuestRuntimeData->CurrentObjective->ParentObjective->ResumeObjective();
+        Run->SubQuestRuntimeData->ResumeQuest();
     }
 }
 
 void UNerveSubQuestRuntimeObjective::MarkAsTracked_Implementation(bool TrackValue)
 {
     UNerveQuestRuntimeObjectiveBase::MarkAsTracked_Implementation(TrackValue);
-    
-    bIsCurrentlyTracked = TrackValue;
-    UpdateSubQuestTracking();
+
+    FNerveSubQuestObjectiveRun* Run = GetRun<FNerveSubQuestObjectiveRun>();
+    if (!Run) return;
+
+    Run->bIsCurrentlyTracked = TrackValue;
+    UpdateSubQuestTracking(*Run);
 }
 
 void UNerveSubQuestRuntimeObjective::CleanUpObjective_Implementation()
 {
-    CleanupSubQuest();
+    if (FNerveSubQuestObjectiveRun* Run = GetRun<FNerveSubQuestObjectiveRun>())
+    {
+        CleanupSubQuest(*Run);
+        Run->CurrentRestartAttempts = 0;
+    }
     UNerveQuestRuntimeObjectiveBase::CleanUpObjective_Implementation();
 }
 
@@ -113,23 +132,32 @@ bool UNerveSubQuestRuntimeObjective::IsSubQuestValid() const
     return SubQuestAsset.IsValid() && IsValid(SubQuestAsset.LoadSynchronous());
 }
 
+UNerveQuestRuntimeData* UNerveSubQuestRuntimeObjective::GetSubQuestRuntimeData() const
+{
+    const FNerveSubQuestObjectiveRun* Run = GetRun<FNerveSubQuestObjectiveRun>();
+    return Run ? Run->SubQuestRuntimeData.Get() : nullptr;
+}
+
 bool UNerveSubQuestRuntimeObjective::RestartSubQuest()
 {
-    if (CurrentRestartAttempts >= MaxRestartAttempts)
+    FNerveSubQuestObjectiveRun* Run = GetRun<FNerveSubQuestObjectiveRun>();
+    if (!Run) return false;
+
+    if (Run->CurrentRestartAttempts >= MaxRestartAttempts)
     {
         UE_LOG(LogTemp, Warning, TEXT("UNerveSubQuestRuntimeObjective: Maximum restart attempts reached"));
         return false;
     }
 
-    CurrentRestartAttempts++;
+    Run->CurrentRestartAttempts++;
     
     // Clean up current sub-quest
-    CleanupSubQuest();
+    CleanupSubQuest(*Run);
     
     // Initialize and start fresh
-    if (InitializeSubQuest())
+    if (InitializeSubQuest(*Run))
     {
-        StartSubQuest();
+        StartSubQuest(*Run);
         return true;
     }
     
@@ -138,7 +166,7 @@ bool UNerveSubQuestRuntimeObjective::RestartSubQuest()
 
 void UNerveSubQuestRuntimeObjective::ForceCompleteSubQuest()
 {
-    if (IsValid(SubQuestRuntimeData))
+    if (UNerveQuestRuntimeData* SubQuestRuntimeData = GetSubQuestRuntimeData())
     {
         SubQuestRuntimeData->MarkQuestComplete();
     }
@@ -146,45 +174,32 @@ void UNerveSubQuestRuntimeObjective::ForceCompleteSubQuest()
 
 float UNerveSubQuestRuntimeObjective::GetSubQuestProgress() const
 {
-    if (!IsValid(SubQuestRuntimeData) || SubQuestRuntimeData->GetAllObjectives().IsEmpty())
-    {
-        return 0.0f;
-    }
-
-    const TArray<UNerveObjectiveRuntimeData*>& Objectives = SubQuestRuntimeData->GetAllObjectives();
-    int32 CompletedObjectives = 0;
-    
-    for (const UNerveObjectiveRuntimeData* Objective : Objectives)
-    {
-        if (Objective && Objective->bIsCompleted)
-        {
-            CompletedObjectives++;
-        }
-    }
-    
-    return static_cast<float>(CompletedObjectives) / static_cast<float>(Objectives.Num());
+    // Kept up to date by the sub-quest as objectives finish, so polling it every frame costs nothing
+    const UNerveQuestRuntimeData* SubQuestRuntimeData = GetSubQuestRuntimeData();
+    return IsValid(SubQuestRuntimeData) ? SubQuestRuntimeData->GetCompletedObjectiveFraction() : 0.0f;
 }
 
 FText UNerveSubQuestRuntimeObjective::GetCurrentSubQuestObjectiveText() const
 {
-    if (IsValid(SubQuestRuntimeData) && IsValid(SubQuestRuntimeData->CurrentObjective) && 
-        IsValid(SubQuestRuntimeData->CurrentObjective->ParentObjective))
+    const UNerveQuestRuntimeData* SubQuestRuntimeData = GetSubQuestRuntimeData();
+    if (IsValid(SubQuestRuntimeData) && IsValid(SubQuestRuntimeData->CurrentObjective))
     {
-        return SubQuestRuntimeData->CurrentObjective->ParentObjective->GetObjectiveDisplayLabel();
+        return SubQuestRuntimeData->CurrentObjective->GetDisplayLabel();
     }
     
     return FText::GetEmpty();
 }
 
-bool UNerveSubQuestRuntimeObjective::InitializeSubQuest()
+bool UNerveSubQuestRuntimeObjective::InitializeSubQuest(FNerveSubQuestObjectiveRun& Run)
 {
+    UNerveQuestSubsystem* QuestSubsystem = Run.QuestSubsystem.Get();
     if (!IsSubQuestValid() || !IsValid(QuestSubsystem)) return false;
 
     UNerveQuestAsset* SubQuestAssetPtr = SubQuestAsset.LoadSynchronous();
     
     // Create sub-quest runtime data (not registered in main quest system)
-    SubQuestRuntimeData = NewObject<UNerveQuestRuntimeData>(this);
-    if (!IsValid(SubQuestRuntimeData))
+    Run.SubQuestRuntimeData = QuestSubsystem->AcquireQuestRuntimeData();
+    if (!IsValid(Run.SubQuestRuntimeData))
     {
         UE_LOG(LogTemp, Error, TEXT("UNerveSubQuestRuntimeObjective: Failed to create sub-quest runtime data"));
         return false;
@@ -192,40 +207,45 @@ bool UNerveSubQuestRuntimeObjective::InitializeSubQuest()
 
     // Initialize the sub-quest runtime data
     // We pass false for tracking initially - we'll handle tracking separately
-    SubQuestRuntimeData->Initialize(SubQuestAssetPtr, QuestSubsystem, false);
+    Run.SubQuestRuntimeData->Initialize(SubQuestAssetPtr, QuestSubsystem, false);
     
     // Set world context if inheriting from parent
-    if (bInheritWorldContext && GetWorldContextObject())
+    if (bInheritWorldContext && Run.WorldContextObject.IsValid())
     {
         // The sub-quest will inherit the world context through the subsystem
     }
 
-    // Bind to sub-quest events
-    SubQuestRuntimeData->OnQuestCompleted.AddDynamic(this, &UNerveSubQuestRuntimeObjective::OnSubQuestCompleted);
-    SubQuestRuntimeData->OnQuestFailed.AddDynamic(this, &UNerveSubQuestRuntimeObjective::OnSubQuestFailed);
+    // Bind to sub-quest events; the run rides along so the outcome reaches the run that started this sub-quest
+    Run.SubQuestRuntimeData->OnQuestFinishedNative.BindUObject(this, &UNerveSubQuestRuntimeObjective::OnSubQuestFinished,
+        TWeakPtr<FNerveObjectiveRun>(Run.AsShared()));
 
     return true;
 }
 
-void UNerveSubQuestRuntimeObjective::CleanupSubQuest()
+void UNerveSubQuestRuntimeObjective::CleanupSubQuest(FNerveSubQuestObjectiveRun& Run)
 {
-    if (IsValid(SubQuestRuntimeData))
+    if (IsValid(Run.SubQuestRuntimeData))
     {
         // Unbind delegates
-        SubQuestRuntimeData->OnQuestCompleted.RemoveAll(this);
-        SubQuestRuntimeData->OnQuestFailed.RemoveAll(this);
+        Run.SubQuestRuntimeData->OnQuestFinishedNative.Unbind();
+        for (UNerveObjectiveRuntimeData* Objective : Run.SubQuestRuntimeData->GetObjectiveView())
+        {
+            if (IsValid(Objective)) Objective->OnObjectiveFinishedNative.Unbind();
+        }
         
-        // Clean up sub-quest data
-        SubQuestRuntimeData->Uninitialize();
-        SubQuestRuntimeData = nullptr;
+        // Clean up sub-quest data and hand it back to the pool
+        Run.SubQuestRuntimeData->Uninitialize();
+        if (Run.QuestSubsystem.IsValid())
+        {
+            Run.QuestSubsystem->ReleaseQuestRuntimeData(Run.SubQuestRuntimeData);
+        }
+        Run.SubQuestRuntimeData = nullptr;
     }
-    
-    CurrentRestartAttempts = 0;
 }
 
-void UNerveSubQuestRuntimeObjective::StartSubQuest()
+void UNerveSubQuestRuntimeObjective::StartSubQuest(FNerveSubQuestObjectiveRun& Run)
 {
-    if (!IsValid(SubQuestRuntimeData))
+    if (!IsValid(Run.SubQuestRuntimeData))
     {
         UE_LOG(LogTemp, Error, TEXT("UNerveSubQuestRuntimeObjective: Cannot start invalid sub-quest"));
         FailObjective();
@@ -235,11 +255,11 @@ void UNerveSubQuestRuntimeObjective::StartSubQuest()
     // Set up objective-specific completion tracking
     if (CompletionBehavior == ESubQuestCompletionBehavior::CompleteOnSpecificObjective)
     {
-        const TArray<UNerveObjectiveRuntimeData*>& Objectives = SubQuestRuntimeData->GetAllObjectives();
+        const TConstArrayView<TObjectPtr<UNerveObjectiveRuntimeData>> Objectives = Run.SubQuestRuntimeData->GetObjectiveView();
         if (Objectives.IsValidIndex(SpecificObjectiveIndex) && IsValid(Objectives[SpecificObjectiveIndex]))
         {
-            Objectives[SpecificObjectiveIndex]->OnObjectiveCompleted.AddDynamic(
-                this, &UNerveSubQuestRuntimeObjective::OnSubQuestObjectiveCompleted);
+            Objectives[SpecificObjectiveIndex]->OnObjectiveFinishedNative.BindUObject(
+                this, &UNerveSubQuestRuntimeObjective::OnSubQuestObjectiveFinished, TWeakPtr<FNerveObjectiveRun>(Run.AsShared()));
         }
         else
         {
@@ -249,41 +269,46 @@ void UNerveSubQuestRuntimeObjective::StartSubQuest()
     }
 
     // Update tracking behavior
-    UpdateSubQuestTracking();
+    UpdateSubQuestTracking(Run);
     
     // Start the sub-quest
-    SubQuestRuntimeData->StartQuest();
+    Run.SubQuestRuntimeData->StartQuest();
     
     UE_LOG(LogTemp, Log, TEXT("UNerveSubQuestRuntimeObjective: Started sub-quest '%s'"), 
-    SubQuestRuntimeData->QuestAsset ? *SubQuestRuntimeData->QuestAsset->QuestTitle : TEXT("Unknown"));
+    Run.SubQuestRuntimeData->QuestAsset ? *Run.SubQuestRuntimeData->QuestAsset->QuestTitle : TEXT("Unknown"));
 }
 
-void UNerveSubQuestRuntimeObjective::OnSubQuestCompleted(UNerveQuestRuntimeData* CompletedQuest)
+void UNerveSubQuestRuntimeObjective::OnSubQuestFinished(UNerveQuestRuntimeData* FinishedQuest, const bool bCompleted,
+    const TWeakPtr<FNerveObjectiveRun> WeakRun)
 {
-    if (CompletedQuest != SubQuestRuntimeData) return;
+    const TSharedPtr<FNerveObjectiveRun> PinnedRun = WeakRun.Pin();
+    if (!PinnedRun.IsValid()) return;
 
-    UE_LOG(LogTemp, Log, TEXT("UNerveSubQuestRuntimeObjective: Sub-quest completed"));
-    
-    // Handle completion based on behavior setting
-    switch (CompletionBehavior)
+    FNerveSubQuestObjectiveRun& Run = static_cast<FNerveSubQuestObjectiveRun&>(*PinnedRun);
+    if (FinishedQuest != Run.SubQuestRuntimeData) return;
+
+    FNerveObjectiveRunScope Scope(Run);
+    if (bCompleted)
     {
-        case ESubQuestCompletionBehavior::CompleteOnSubQuestComplete:
-            CompleteObjective();
-            break;
-            
-        case ESubQuestCompletionBehavior::CompleteOnSpecificObjective:
-            // This is handled by OnSubQuestObjectiveCompleted
-            break;
-            
-        case ESubQuestCompletionBehavior::Manual:
-            // Do nothing - manual completion required
-            break;
+        UE_LOG(LogTemp, Log, TEXT("UNerveSubQuestRuntimeObjective: Sub-quest completed"));
+        
+        // Handle completion based on behavior setting
+        switch (CompletionBehavior)
+        {
+            case ESubQuestCompletionBehavior::CompleteOnSubQuestComplete:
+                CompleteObjective();
+                break;
+                
+            case ESubQuestCompletionBehavior::CompleteOnSpecificObjective:
+                // This is handled by OnSubQuestObjectiveFinished
+                break;
+                
+            case ESubQuestCompletionBehavior::Manual:
+                // Do nothing - manual completion required
+                break;
+        }
+        return;
     }
-}
-
-void UNerveSubQuestRuntimeObjective::OnSubQuestFailed(UNerveQuestRuntimeData* FailedQuest)
-{
-    if (FailedQuest != SubQuestRuntimeData) return;
 
     UE_LOG(LogTemp, Log, TEXT("UNerveSubQuestRuntimeObjective: Sub-quest failed"));
     
@@ -308,18 +333,23 @@ void UNerveSubQuestRuntimeObjective::OnSubQuestFailed(UNerveQuestRuntimeData* Fa
     }
 }
 
-void UNerveSubQuestRuntimeObjective::OnSubQuestObjectiveCompleted(UNerveQuestRuntimeObjectiveBase* CompletedObjective)
+void UNerveSubQuestRuntimeObjective::OnSubQuestObjectiveFinished(UNerveObjectiveRuntimeData* FinishedObjective,
+    const bool bCompleted, const TWeakPtr<FNerveObjectiveRun> WeakRun)
 {
-    if (CompletionBehavior == ESubQuestCompletionBehavior::CompleteOnSpecificObjective)
-    {
-        UE_LOG(LogTemp, Log, TEXT("UNerveSubQuestRuntimeObjective: Specific objective completed"));
-        CompleteObjective();
-    }
+    if (!bCompleted || CompletionBehavior != ESubQuestCompletionBehavior::CompleteOnSpecificObjective) return;
+
+    const TSharedPtr<FNerveObjectiveRun> PinnedRun = WeakRun.Pin();
+    if (!PinnedRun.IsValid()) return;
+
+    FNerveObjectiveRunScope Scope(*PinnedRun);
+    UE_LOG(LogTemp, Log, TEXT("UNerveSubQuestRuntimeObjective: Specific objective completed"));
+    CompleteObjective();
 }
 
-void UNerveSubQuestRuntimeObjective::UpdateSubQuestTracking()
+void UNerveSubQuestRuntimeObjective::UpdateSubQuestTracking(const FNerveSubQuestObjectiveRun& Run) const
 {
-    if (!IsValid(SubQuestRuntimeData) || !IsValid(QuestSubsystem)) return;
+    UNerveQuestRuntimeData* SubQuestRuntimeData = Run.SubQuestRuntimeData;
+    if (!IsValid(SubQuestRuntimeData) || !Run.QuestSubsystem.IsValid()) return;
 
     bool bShouldTrack = false;
     
@@ -330,7 +360,7 @@ void UNerveSubQuestRuntimeObjective::UpdateSubQuestTracking()
             break;
             
         case ESubQuestTrackingBehavior::TrackWithParent:
-            bShouldTrack = bIsCurrentlyTracked;
+            bShouldTrack = Run.bIsCurrentlyTracked;
             break;
             
         case ESubQuestTrackingBehavior::AlwaysTrack:
@@ -355,10 +385,7 @@ UNerveQuestSubsystem* UNerveSubQuestRuntimeObjective::GetQuestSubsystem() const
 {
     if (!IsValid(GetWorld())) return nullptr;
 
-    const APlayerController* NewPlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
-    if (!IsValid(NewPlayerController)) return nullptr;
-
-    const ULocalPlayer* LocalPlayer = NewPlayerController->GetLocalPlayer();
+    const ULocalPlayer* LocalPlayer = GetOwningLocalPlayer();
     if (!IsValid(LocalPlayer)) return nullptr;
     
     return LocalPlayer->GetSubsystem<UNerveQuestSubsystem>();
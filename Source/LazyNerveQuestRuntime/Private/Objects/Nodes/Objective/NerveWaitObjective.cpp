@@ -2,11 +2,12 @@
 
 
 #include "Objects/Nodes/Objective/NerveWaitObjective.h"
-#include "TimerManager.h"
 #include "LazyNerveRuntimeQuestStyle.h"
 #include "Components/SlateWrapperTypes.h"
+#include "Engine/LocalPlayer.h"
 #include "Kismet/GameplayStatics.h"
 #include "Subsystem/NerveQuestSubsystem.h"
+#include "Subsystem/NerveQuestTimerSubsystem.h"
 #include "Widget/QuestScreen.h"
 
 UNerveWaitObjective::UNerveWaitObjective()
@@ -39,12 +40,37 @@ FSlateBrush UNerveWaitObjective::GetObjectiveBrush_Implementation() const
     return Brush ? *Brush : FSlateBrush();
 }
 
+FNerveWaitObjectiveRun::~FNerveWaitObjectiveRun()
+{
+    ClearWaitTimer();
+}
+
+void FNerveWaitObjectiveRun::ClearWaitTimer()
+{
+    if (UNerveQuestTimerSubsystem* Timers = TimerSubsystem.Get())
+    {
+        Timers->ClearTimer(WaitTimerHandle);
+    }
+    WaitTimerHandle.Invalidate();
+}
+
+TSharedRef<FNerveObjectiveRun> UNerveWaitObjective::MakeRun() const
+{
+    return MakeShared<FNerveWaitObjectiveRun>();
+}
+
 void UNerveWaitObjective::ExecuteObjective_Implementation(UNerveQuestAsset* NerveQuestAsset)
 {
     Super::ExecuteObjective_Implementation(NerveQuestAsset);
 
+    FNerveWaitObjectiveRun* Run = GetRun<FNerveWaitObjectiveRun>();
+    if (!Run) return;
+
+    Run->CurrentWaitDuration = 0;
+    Run->WaitDuration = ResolveProperty(GET_MEMBER_NAME_CHECKED(UNerveWaitObjective, WaitDuration), WaitDuration);
+
     // Complete immediately if wait duration is invalid (zero or negative)
-    if (WaitDuration <= 0.0f)
+    if (Run->WaitDuration <= 0.0f)
     {
         CompleteObjective();
         return;
@@ -56,15 +82,40 @@ void UNerveWaitObjective::ExecuteObjective_Implementation(UNerveQuestAsset* Nerv
         UpdateUI(false);
     }
 
-    const float InTimerRate = AllowGenerateProgressTracker()? ProgressInterval : WaitDuration;
-    if (AllowGenerateProgressTracker()) ExecuteProgress(CurrentWaitDuration, WaitDuration);
+    const float InTimerRate = AllowGenerateProgressTracker()? ProgressInterval : Run->WaitDuration;
+    if (AllowGenerateProgressTracker()) ExecuteProgress(Run->CurrentWaitDuration, Run->WaitDuration);
+
+    UNerveQuestTimerSubsystem* TimerSubsystem = UNerveQuestTimerSubsystem::GetQuestTimerSubsystem(this);
+    if (!TimerSubsystem)
+    {
+        UE_LOG(LogTemp, Error, TEXT("UNerveWaitObjective::ExecuteObjective_Implementation - Invalid QuestTimerSubsystem"));
+        FailObjective();
+        return;
+    }
 
     // Set up a timer to trigger completion after the wait duration
-    GetWorld()->GetTimerManager().SetTimer(WaitTimerHandle, this, &UNerveWaitObjective::OnWaitComplete, InTimerRate, AllowGenerateProgressTracker());
+    Run->TimerSubsystem = TimerSubsystem;
+    TimerSubsystem->SetTimer(Run->WaitTimerHandle, FSimpleDelegate::CreateUObject(this, &UNerveWaitObjective::OnWaitComplete, TWeakPtr<FNerveObjectiveRun>(Run->AsShared())),
+        InTimerRate, AllowGenerateProgressTracker(), WaitClock, GetTimerScope());
 }
 
-void UNerveWaitObjective::OnWaitComplete()
+void UNerveWaitObjective::CleanUpObjective_Implementation()
 {
+    if (FNerveWaitObjectiveRun* Run = GetRun<FNerveWaitObjectiveRun>())
+    {
+        Run->ClearWaitTimer();
+    }
+    Super::CleanUpObjective_Implementation();
+}
+
+void UNerveWaitObjective::OnWaitComplete(const TWeakPtr<FNerveObjectiveRun> WeakRun)
+{
+    const TSharedPtr<FNerveObjectiveRun> PinnedRun = WeakRun.Pin();
+    if (!PinnedRun.IsValid()) return;
+
+    FNerveObjectiveRunScope Scope(*PinnedRun);
+    FNerveWaitObjectiveRun& Run = static_cast<FNerveWaitObjectiveRun&>(*PinnedRun);
+
     if (!AllowGenerateProgressTracker())
     {
         UpdateUI(true);
@@ -72,10 +123,12 @@ void UNerveWaitObjective::OnWaitComplete()
         return;
     }
 
-    CurrentWaitDuration += ProgressInterval;
-    ExecuteProgress(CurrentWaitDuration, WaitDuration);
-    if (CurrentWaitDuration >= WaitDuration)
+    Run.CurrentWaitDuration += ProgressInterval;
+    ExecuteProgress(Run.CurrentWaitDuration, Run.WaitDuration);
+    if (Run.CurrentWaitDuration >= Run.WaitDuration)
     {
+        Run.ClearWaitTimer();
+
         // Complete the objective when the timer expires
         UpdateUI(true);
         CompleteObjective();
@@ -86,15 +139,15 @@ void UNerveWaitObjective::OnWaitComplete()
 
 void UNerveWaitObjective::UpdateUI(bool Visible)
 {
-    APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
-    if (!PlayerController)
+    const ULocalPlayer* LocalPlayer = GetOwningLocalPlayer();
+    if (!LocalPlayer)
     {
-        UE_LOG(LogTemp, Error, TEXT("UNerveWaitObjective::ExecuteObjective_Implementation - Invalid PlayerController"));
+        UE_LOG(LogTemp, Error, TEXT("UNerveWaitObjective::ExecuteObjective_Implementation - Invalid LocalPlayer"));
         FailObjective();
         return;
     }
     
-    UNerveQuestSubsystem* QuestSubsystem = PlayerController->GetLocalPlayer()->GetSubsystem<UNerveQuestSubsystem>();
+    UNerveQuestSubsystem* QuestSubsystem = LocalPlayer->GetSubsystem<UNerveQuestSubsystem>();
     if (!QuestSubsystem)
     {
         UE_LOG(LogTemp, Error, TEXT("UNerveWaitObjective::ExecuteObjective_Implementation - Invalid QuestSubsystem"));
@@ -2,8 +2,13 @@
 
 
 #include "Setting/NerveQuestRuntimeSetting.h"
+#include "Styling/CoreStyle.h"
 
 UNerveQuestRuntimeSetting::UNerveQuestRuntimeSetting(const FObjectInitializer& ObjectInitializer)
 {
 	CategoryName = TEXT("Lazy Nerve");
+
+	OverlayMarkerBrush.ImageSize = FVector2D(32.0f, 32.0f);
+	OverlayEdgeMarkerBrush.ImageSize = FVector2D(24.0f, 24.0f);
+	OverlayLabelFont = FCoreStyle::GetDefaultFontStyle("Regular", 12);
 }
@@ -0,0 +1,1094 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#include "Subsystem/NervePingSubsystem.h"
+#include "Components/WidgetComponent.h"
+#include "Widget/WorldGotoPing.h"
+#include "Widget/SNervePingOverlay.h"
+#include "Setting/NerveQuestRuntimeSetting.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/GameInstance.h"
+#include "Engine/WorldSettings.h"
+#include "Engine/GameViewportClient.h"
+#include "SceneView.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+void UNervePingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    const UNerveQuestRuntimeSetting* Settings = GetDefault<UNerveQuestRuntimeSetting>();
+    RenderMode = Settings->PingRenderMode;
+    DefaultPingWidgetClass = Settings->DefaultPingWidgetClass;
+    EdgeMargin = Settings->PingEdgeMargin;
+    UpdateRate = Settings->PingUpdateRate;
+    MaxPooledWidgetsPerClass = Settings->MaxPooledPingWidgetsPerClass;
+    TimeSinceLastUpdate = 0.0f;
+
+    TArray<FNervePingLodTier> LodTiers = Settings->PingLodTiers;
+    LodTiers.Sort([](const FNervePingLodTier& A, const FNervePingLodTier& B) { return A.MinDistance < B.MinDistance; });
+
+    LodTierDistancesSquared.Reset(LodTiers.Num());
+    LodTierIntervals.Reset(LodTiers.Num());
+    for (const FNervePingLodTier& Tier : LodTiers)
+    {
+        LodTierDistancesSquared.Add(FMath::Square(static_cast<double>(Tier.MinDistance)));
+        LodTierIntervals.Add(Tier.UpdateInterval);
+    }
+
+    LodInterpSpeed = Settings->PingLodInterpSpeed;
+    MaxRenderedPings = Settings->MaxRenderedPings;
+    bClusterOffScreenPings = Settings->bClusterOffScreenPings;
+    OffScreenClusterAngle = FMath::DegreesToRadians(Settings->OffScreenClusterAngle);
+
+    bPredictPingMotion = Settings->bPredictPingMotion;
+    MaxPingExtrapolationTime = Settings->MaxPingExtrapolationTime;
+    PingCorrectionSpeed = Settings->PingCorrectionSpeed;
+    PingSnapDistanceSquared = FMath::Square(static_cast<double>(Settings->PingSnapDistance));
+
+    bTracePingOcclusion = Settings->bTracePingOcclusion;
+    PingOcclusionChannel = Settings->PingOcclusionChannel;
+    MaxOcclusionTracesPerUpdate = FMath::Max(Settings->MaxOcclusionTracesPerUpdate, 1);
+    OcclusionTargetTolerance = Settings->OcclusionTargetTolerance;
+    OcclusionCursor = 0;
+    OcclusionTraceDelegate.BindUObject(this, &UNervePingSubsystem::OnOcclusionTraceDone);
+}
+
+void UNervePingSubsystem::Deinitialize()
+{
+    // Clean up all ping components before the world tears down
+    RemoveAllPings();
+    DestroyPooledWidgetComponents();
+    RemoveAllPingOverlays();
+    PlayerViews.Empty();
+    OcclusionTraceDelegate.Unbind();
+
+    Super::Deinitialize();
+}
+
+bool UNervePingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    // Pings only exist while playing, including every PIE instance
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UNervePingSubsystem::Tick(const float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    TimeSinceLastUpdate += DeltaTime;
+    if (TimeSinceLastUpdate < UpdateRate) return;
+
+    const float ElapsedTime = TimeSinceLastUpdate;
+    TimeSinceLastUpdate = 0.0f;
+    UpdateAllPings(ElapsedTime);
+}
+
+bool UNervePingSubsystem::IsTickable() const
+{
+    if (ArePingUpdatesSuspended()) return false;
+
+    // Idle worlds pay nothing; tick once more after the last ping to take the overlays down
+    return !ActivePingSlots.IsEmpty() || PlayerViews.ContainsByPredicate([](const FPingPlayerView& View) { return View.Overlay.IsValid(); });
+}
+
+TStatId UNervePingSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNervePingSubsystem, STATGROUP_Tickables);
+}
+
+UNervePingSubsystem* UNervePingSubsystem::GetPingSubsystem(const UObject* WorldContextObject)
+{
+    const UWorld* World = IsValid(WorldContextObject) ? WorldContextObject->GetWorld() : nullptr;
+    return IsValid(World) ? World->GetSubsystem<UNervePingSubsystem>() : nullptr;
+}
+
+void UNervePingSubsystem::SuspendPingUpdates(const UObject* Requester)
+{
+    if (!IsValid(Requester)) return;
+    UpdateSuspenders.AddUnique(Requester);
+}
+
+void UNervePingSubsystem::ResumePingUpdates(const UObject* Requester)
+{
+    UpdateSuspenders.Remove(Requester);
+    UpdateSuspenders.RemoveAll([](const TWeakObjectPtr<const UObject>& Suspender) { return !Suspender.IsValid(); });
+
+    // Elapsed suspended time must not count as one huge update
+    if (!ArePingUpdatesSuspended())
+    {
+        TimeSinceLastUpdate = 0.0f;
+    }
+}
+
+bool UNervePingSubsystem::ArePingUpdatesSuspended() const
+{
+    return UpdateSuspenders.ContainsByPredicate([](const TWeakObjectPtr<const UObject>& Suspender) { return Suspender.IsValid(); });
+}
+
+int32 UNervePingSubsystem::CreatePing(const FVector& WorldLocation, const TSubclassOf<UUserWidget> WidgetClass, ULocalPlayer* OwningPlayer)
+{
+    if (!IsValid(GetWorld()))
+    {
+        UE_LOG(LogTemp, Error, TEXT("UNervePingSubsystem::CreatePing - Invalid World"));
+        return -1;
+    }
+
+    // Pings without an explicit owner belong to the primary player
+    if (!OwningPlayer)
+    {
+        OwningPlayer = GetWorld()->GetFirstLocalPlayerFromController();
+    }
+
+    // The overlay draws every ping itself, so no per-ping widget is needed
+    if (UsesPingOverlay())
+    {
+        const int32 SlotIndex = AllocatePingSlot();
+        if (SlotIndex == INDEX_NONE)
+        {
+            UE_LOG(LogTemp, Error, TEXT("UNervePingSubsystem::CreatePing - Ping capacity exhausted"));
+            return -1;
+        }
+
+        FPingComponent& NewPingComponent = PingComponents[SlotIndex];
+        NewPingComponent.PingID = MakePingHandle(SlotIndex, NewPingComponent.Generation);
+        NewPingComponent.PingData = FPingData();
+        NewPingComponent.PingData.WorldLocation = WorldLocation;
+        NewPingComponent.OwningPlayer = OwningPlayer;
+        ApplyPingSample(NewPingComponent, WorldLocation, FVector::ZeroVector);
+        return NewPingComponent.PingID;
+    }
+
+    // Use provided widget class or fall back to default
+    const TSubclassOf<UUserWidget> ActualWidgetClass = WidgetClass ? WidgetClass : DefaultPingWidgetClass;
+    if (!IsValid(ActualWidgetClass))
+    {
+        UE_LOG(LogTemp, Error, TEXT("UNervePingSubsystem::CreatePing - No valid widget class provided"));
+        return -1;
+    }
+
+    // Acquire a pooled widget component, or create one if the pool is empty
+    UWidgetComponent* WidgetComponent = AcquireWidgetComponent(ActualWidgetClass);
+    if (!IsValid(WidgetComponent))
+    {
+        UE_LOG(LogTemp, Error, TEXT("UNervePingSubsystem::CreatePing - Failed to create widget component"));
+        return -1;
+    }
+
+    UWorldGotoPing* PingWidget = Cast<UWorldGotoPing>(WidgetComponent->GetUserWidgetObject());
+    if (!IsValid(PingWidget))
+    {
+        UE_LOG(LogTemp, Error, TEXT("UNervePingSubsystem::CreatePing - Failed to cast to UWorldGotoPing"));
+        ReleaseWidgetComponent(WidgetComponent);
+        return -1;
+    }
+
+    // Claim a slot and stamp the handle with its current generation
+    const int32 SlotIndex = AllocatePingSlot();
+    if (SlotIndex == INDEX_NONE)
+    {
+        UE_LOG(LogTemp, Error, TEXT("UNervePingSubsystem::CreatePing - Ping capacity exhausted"));
+        ReleaseWidgetComponent(WidgetComponent);
+        return -1;
+    }
+
+    FPingComponent& NewPingComponent = PingComponents[SlotIndex];
+    NewPingComponent.PingID = MakePingHandle(SlotIndex, NewPingComponent.Generation);
+    NewPingComponent.PingData = FPingData();
+    NewPingComponent.PingData.WorldLocation = WorldLocation;
+    NewPingComponent.WidgetComponent = WidgetComponent;
+    NewPingComponent.PingWidget = PingWidget;
+    NewPingComponent.OwningPlayer = OwningPlayer;
+    ApplyPingSample(NewPingComponent, WorldLocation, FVector::ZeroVector);
+
+    // Screen-space widget components draw only into their owner's split-screen view
+    WidgetComponent->SetOwnerPlayer(OwningPlayer);
+    
+    UE_LOG(LogTemp, Log, TEXT("UNervePingSubsystem::CreatePing - Created ping with ID: %d"), NewPingComponent.PingID);
+    return NewPingComponent.PingID;
+}
+
+bool UNervePingSubsystem::UpdatePingLocation(const int32 PingID, const FVector& NewWorldLocation)
+{
+    FPingComponent* PingComponent = FindPingByID(PingID);
+    if (!PingComponent) return false;
+
+    // Estimate velocity from the previous sample so callers without one still get smooth motion
+    FVector Velocity = FVector::ZeroVector;
+    const double Now = GetWorld()->GetTimeSeconds();
+    if (bPredictPingMotion && PingComponent->bHasSample && Now > PingComponent->SampleTime)
+    {
+        Velocity = (NewWorldLocation - PingComponent->SampleLocation) / (Now - PingComponent->SampleTime);
+    }
+
+    ApplyPingSample(*PingComponent, NewWorldLocation, Velocity);
+    return true;
+}
+
+bool UNervePingSubsystem::UpdatePingMotion(const int32 PingID, const FVector& NewWorldLocation, const FVector& Velocity)
+{
+    FPingComponent* PingComponent = FindPingByID(PingID);
+    if (!PingComponent) return false;
+
+    ApplyPingSample(*PingComponent, NewWorldLocation, Velocity);
+    return true;
+}
+
+void UNervePingSubsystem::ApplyPingSample(FPingComponent& PingComponent, const FVector& Location, const FVector& Velocity)
+{
+    const bool bHadSample = PingComponent.bHasSample;
+    PingComponent.SampleLocation = Location;
+    PingComponent.SampleTime = GetWorld()->GetTimeSeconds();
+    PingComponent.bHasSample = true;
+
+    // First sample, prediction off, or a teleport: jump straight to the reported location
+    const double ErrorSquared = FVector::DistSquared(PingComponent.PingData.WorldLocation, Location);
+    if (!bPredictPingMotion || !bHadSample || ErrorSquared > PingSnapDistanceSquared)
+    {
+        PingComponent.PingData.WorldLocation = Location;
+        PingComponent.SampleVelocity = bPredictPingMotion && bHadSample ? Velocity : FVector::ZeroVector;
+        PingComponent.CorrectionOffset = FVector::ZeroVector;
+        PingComponent.bPredicting = !PingComponent.SampleVelocity.IsNearlyZero();
+        return;
+    }
+
+    // Keep drawing where we are and bleed the error off over the next updates
+    PingComponent.SampleVelocity = Velocity;
+    PingComponent.CorrectionOffset = PingComponent.PingData.WorldLocation - Location;
+    PingComponent.bPredicting = true;
+}
+
+void UNervePingSubsystem::AdvancePredictedPings(const float DeltaTime)
+{
+    if (!bPredictPingMotion) return;
+
+    const double Now = GetWorld()->GetTimeSeconds();
+    const float CorrectionDecay = FMath::Exp(-PingCorrectionSpeed * DeltaTime);
+
+    for (const int32 SlotIndex : ActivePingSlots)
+    {
+        FPingComponent& PingComponent = PingComponents[SlotIndex];
+        if (!PingComponent.bPredicting) continue;
+
+        // Extrapolate a bounded time past the last sample so a stalled source does not run away
+        const double TimeAhead = FMath::Clamp(Now - PingComponent.SampleTime, 0.0, static_cast<double>(MaxPingExtrapolationTime));
+        const FVector PredictedLocation = PingComponent.SampleLocation + PingComponent.SampleVelocity * TimeAhead;
+
+        PingComponent.CorrectionOffset *= CorrectionDecay;
+        PingComponent.PingData.WorldLocation = PredictedLocation + PingComponent.CorrectionOffset;
+
+        // Settle stationary targets once the correction has faded
+        if (PingComponent.SampleVelocity.IsNearlyZero() && PingComponent.CorrectionOffset.IsNearlyZero(0.1))
+        {
+            PingComponent.PingData.WorldLocation = PredictedLocation;
+            PingComponent.CorrectionOffset = FVector::ZeroVector;
+            PingComponent.bPredicting = false;
+        }
+    }
+}
+
+bool UNervePingSubsystem::UpdatePingDistance(const int32 PingID, const float NewDistance, const ENerveDistanceConversionMethod ConversionMethod)
+{
+    FPingComponent* PingComponent = FindPingByID(PingID);
+    if (!PingComponent) return false;
+
+    // The label shows whole units, so only a change of the rounded value is worth formatting
+    FPingData& PingData = PingComponent->PingData;
+    const bool bDistanceChanged = PingData.DistanceLabel.IsEmpty()
+        || FMath::RoundToInt64(PingData.Distance) != FMath::RoundToInt64(NewDistance)
+        || PingData.DistanceConversion != ConversionMethod;
+
+    PingData.Distance = NewDistance;
+    PingData.DistanceConversion = ConversionMethod;
+    if (!bDistanceChanged) return true;
+
+    // Format once here so the overlay never rebuilds strings while painting
+    PingData.DistanceLabel = FormatPingDistance(NewDistance, ConversionMethod);
+    
+    // Update the widget
+    if (IsValid(PingComponent->PingWidget))
+    {
+        PingComponent->PingWidget->UpdateDistance(NewDistance, ConversionMethod);
+    }
+    return true;
+}
+
+bool UNervePingSubsystem::SetPingVisibility(const int32 PingID, const bool bVisible)
+{
+    FPingComponent* PingComponent = FindPingByID(PingID);
+    if (!PingComponent) return false;
+
+    PingComponent->PingData.bIsVisible = bVisible;
+    if (IsValid(PingComponent->WidgetComponent))
+    {
+        PingComponent->WidgetComponent->SetVisibility(bVisible);
+    }
+    return true;
+}
+
+bool UNervePingSubsystem::SetPingTracked(const int32 PingID, const bool bTracked)
+{
+    FPingComponent* PingComponent = FindPingByID(PingID);
+    if (!PingComponent) return false;
+
+    PingComponent->PingData.bIsTracked = bTracked;
+    return true;
+}
+
+bool UNervePingSubsystem::RemovePing(const int32 PingID)
+{
+    FPingComponent* PingComponent = FindPingByID(PingID);
+    if (!PingComponent) return false;
+
+    CleanupPingComponent(*PingComponent);
+    ReleasePingSlot(PingID & PingHandleIndexMask);
+    UE_LOG(LogTemp, Log, TEXT("UNervePingSubsystem::RemovePing - Removed ping with ID: %d"), PingID);
+    return true;
+}
+
+void UNervePingSubsystem::RemoveAllPings()
+{
+    while (!ActivePingSlots.IsEmpty())
+    {
+        const int32 SlotIndex = ActivePingSlots.Last();
+        CleanupPingComponent(PingComponents[SlotIndex]);
+        ReleasePingSlot(SlotIndex);
+    }
+    UE_LOG(LogTemp, Log, TEXT("UNervePingSubsystem::RemoveAllPings - Removed all pings"));
+}
+
+bool UNervePingSubsystem::IsPingValid(const int32 PingID) const
+{
+    return FindPingByID(PingID) != nullptr;
+}
+
+FPingData UNervePingSubsystem::GetPingData(const int32 PingID) const
+{
+    if (const FPingComponent* PingComponent = FindPingByID(PingID))
+    {
+        return PingComponent->PingData;
+    }
+    return FPingData();
+}
+
+void UNervePingSubsystem::UpdateAllPings(const float DeltaTime)
+{
+    if (!IsValid(GetWorld())) return;
+
+    if (ActivePingSlots.IsEmpty())
+    {
+        // Drop the overlays so the subsystem stops ticking until the next ping
+        RemoveAllPingOverlays();
+        return;
+    }
+
+    // Move predicted targets before anything reads their location
+    AdvancePredictedPings(DeltaTime);
+
+    // Fetch every local player's view-projection once for the whole update
+    RefreshPlayerViews();
+
+    // Collect drawable pings, and batch only those whose LOD tier is due for a projection
+    RenderCandidates.Reset(ActivePingSlots.Num());
+    ProjectionBatch.Reset(ActivePingSlots.Num());
+    for (const int32 SlotIndex : ActivePingSlots)
+    {
+        FPingComponent& PingComponent = PingComponents[SlotIndex];
+        PingComponent.bRendered = false;
+        PingComponent.ViewIndex = FindPlayerView(PingComponent.OwningPlayer.Get());
+
+        if (!PingComponent.PingData.bIsVisible) continue;
+
+        if (PingComponent.ViewIndex == INDEX_NONE || !PlayerViews[PingComponent.ViewIndex].bValid)
+        {
+            // Owner left or has no view this update; make sure nothing lingers on screen
+            if (IsValid(PingComponent.WidgetComponent) && PingComponent.WidgetComponent->IsVisible())
+            {
+                PingComponent.WidgetComponent->SetVisibility(false);
+            }
+            continue;
+        }
+        if (!UsesPingOverlay() && !IsValid(PingComponent.WidgetComponent)) continue;
+
+        const FPingPlayerView& PlayerView = PlayerViews[PingComponent.ViewIndex];
+        PingComponent.ViewDistanceSquared = FVector::DistSquared(PlayerView.ViewOrigin, PingComponent.PingData.WorldLocation);
+        RenderCandidates.Add(SlotIndex);
+
+        // Far overlay markers coast on their last projection and glide to the next one; widget components are
+        // placed at the predicted location every update, so they are never throttled
+        if (UsesPingOverlay())
+        {
+            PingComponent.LodTimeUntilUpdate -= DeltaTime;
+            if (PingComponent.LodTimeUntilUpdate > 0.0f) continue;
+
+            PingComponent.LodTier = GetLodTier(PingComponent.ViewDistanceSquared, PingComponent.LodTimeUntilUpdate);
+        }
+
+        ProjectionBatch.SlotIndices.Add(SlotIndex);
+        ProjectionBatch.ViewIndices.Add(PingComponent.ViewIndex);
+        ProjectionBatch.WorldX.Add(PingComponent.PingData.WorldLocation.X);
+        ProjectionBatch.WorldY.Add(PingComponent.PingData.WorldLocation.Y);
+        ProjectionBatch.WorldZ.Add(PingComponent.PingData.WorldLocation.Z);
+    }
+
+    if (!ProjectionBatch.SlotIndices.IsEmpty())
+    {
+        ProjectPingBatch();
+        ApplyPingBatch();
+    }
+
+    SelectRenderedPings();
+
+    if (bTracePingOcclusion)
+    {
+        IssueOcclusionTraces();
+    }
+
+    if (UsesPingOverlay())
+    {
+        UpdatePingOverlays(DeltaTime);
+    }
+    else
+    {
+        ApplyWidgetRenderState();
+    }
+}
+
+void UNervePingSubsystem::IssueOcclusionTraces()
+{
+    UWorld* World = GetWorld();
+    const int32 NumActive = ActivePingSlots.Num();
+    if (NumActive == 0) return;
+
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(NervePingOcclusion), false);
+
+    int32 TracesIssued = 0;
+    for (int32 Step = 0; Step < NumActive && TracesIssued < MaxOcclusionTracesPerUpdate; ++Step)
+    {
+        OcclusionCursor = (OcclusionCursor + 1) % NumActive;
+        FPingComponent& PingComponent = PingComponents[ActivePingSlots[OcclusionCursor]];
+        if (!PingComponent.bRendered || PingComponent.bOcclusionTracePending) continue;
+
+        const FPingPlayerView& PlayerView = PlayerViews[PingComponent.ViewIndex];
+        const FVector Start = PlayerView.ViewOrigin;
+        const FVector ToTarget = PingComponent.PingData.WorldLocation - Start;
+        const double Distance = ToTarget.Size();
+        if (Distance <= OcclusionTargetTolerance)
+        {
+            PingComponent.PingData.bIsOccluded = false;
+            continue;
+        }
+
+        // Ignore the viewer's own pawn; the trace ends short of the target so its collision is not a hit
+        QueryParams.ClearIgnoredActors();
+        if (const ULocalPlayer* LocalPlayer = PlayerView.LocalPlayer.Get())
+        {
+            if (const APlayerController* PlayerController = LocalPlayer->GetPlayerController(World))
+            {
+                QueryParams.AddIgnoredActor(PlayerController->GetPawn());
+            }
+        }
+
+        const FVector End = Start + ToTarget * ((Distance - OcclusionTargetTolerance) / Distance);
+        World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, End, PingOcclusionChannel, QueryParams,
+            FCollisionResponseParams::DefaultResponseParam, &OcclusionTraceDelegate, static_cast<uint32>(PingComponent.PingID));
+
+        PingComponent.bOcclusionTracePending = true;
+        ++TracesIssued;
+    }
+}
+
+void UNervePingSubsystem::OnOcclusionTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+    FPingComponent* PingComponent = FindPingByID(static_cast<int32>(TraceDatum.UserData));
+    if (!PingComponent) return;
+
+    PingComponent->bOcclusionTracePending = false;
+
+    const bool bIsOccluded = TraceDatum.OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+    if (PingComponent->PingData.bIsOccluded == bIsOccluded) return;
+
+    PingComponent->PingData.bIsOccluded = bIsOccluded;
+    if (IsValid(PingComponent->PingWidget))
+    {
+        PingComponent->PingWidget->SetIsOccluded(bIsOccluded);
+    }
+}
+
+void UNervePingSubsystem::RefreshPlayerViews()
+{
+    const UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+    if (!IsValid(GameInstance))
+    {
+        for (FPingPlayerView& PlayerView : PlayerViews)
+        {
+            PlayerView.bValid = false;
+        }
+        return;
+    }
+
+    const TArray<ULocalPlayer*>& LocalPlayers = GameInstance->GetLocalPlayers();
+
+    // Forget players that left split-screen, taking their overlays with them
+    for (int32 Index = PlayerViews.Num() - 1; Index >= 0; --Index)
+    {
+        if (!LocalPlayers.Contains(PlayerViews[Index].LocalPlayer.Get()))
+        {
+            RemovePingOverlay(PlayerViews[Index]);
+            PlayerViews.RemoveAt(Index);
+        }
+    }
+
+    for (ULocalPlayer* LocalPlayer : LocalPlayers)
+    {
+        const int32 ExistingIndex = FindPlayerView(LocalPlayer);
+        FPingPlayerView& PlayerView = ExistingIndex != INDEX_NONE ? PlayerViews[ExistingIndex] : PlayerViews.AddDefaulted_GetRef();
+        PlayerView.LocalPlayer = LocalPlayer;
+        PlayerView.bValid = false;
+
+        if (!LocalPlayer || !LocalPlayer->ViewportClient || !LocalPlayer->ViewportClient->Viewport) continue;
+
+        FSceneViewProjectionData ProjectionData;
+        if (!LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData)) continue;
+
+        const FIntRect ViewRect = ProjectionData.GetConstrainedViewRect();
+        PlayerView.ViewProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
+        PlayerView.ViewOrigin = ProjectionData.ViewOrigin;
+        PlayerView.ViewportSize = FVector2D(ViewRect.Width(), ViewRect.Height());
+        PlayerView.bValid = true;
+    }
+}
+
+int32 UNervePingSubsystem::FindPlayerView(const ULocalPlayer* LocalPlayer) const
+{
+    if (!LocalPlayer) return INDEX_NONE;
+
+    return PlayerViews.IndexOfByPredicate([LocalPlayer](const FPingPlayerView& PlayerView)
+    {
+        return PlayerView.LocalPlayer.Get() == LocalPlayer;
+    });
+}
+
+void UNervePingSubsystem::ProjectPingBatch()
+{
+    const int32 Num = ProjectionBatch.SlotIndices.Num();
+    ProjectionBatch.SetOutputNum(Num);
+
+    const int32* RESTRICT InView = ProjectionBatch.ViewIndices.GetData();
+    const double* RESTRICT InX = ProjectionBatch.WorldX.GetData();
+    const double* RESTRICT InY = ProjectionBatch.WorldY.GetData();
+    const double* RESTRICT InZ = ProjectionBatch.WorldZ.GetData();
+    float* RESTRICT OutScreenX = ProjectionBatch.ScreenX.GetData();
+    float* RESTRICT OutScreenY = ProjectionBatch.ScreenY.GetData();
+    float* RESTRICT OutFinalX = ProjectionBatch.FinalX.GetData();
+    float* RESTRICT OutFinalY = ProjectionBatch.FinalY.GetData();
+    uint8* RESTRICT OutProjected = ProjectionBatch.bProjected.GetData();
+    uint8* RESTRICT OutOnScreen = ProjectionBatch.bOnScreen.GetData();
+
+    // Per-view constants, looked up by index so every player's pings share one loop
+    struct FViewConstants
+    {
+        FMatrix Matrix;
+        float Width;
+        float Height;
+        float CenterX;
+        float CenterY;
+        float HalfInnerX;
+        float HalfInnerY;
+    };
+
+    TArray<FViewConstants, TInlineAllocator<4>> Views;
+    Views.SetNumUninitialized(PlayerViews.Num());
+    for (int32 ViewIndex = 0; ViewIndex < PlayerViews.Num(); ++ViewIndex)
+    {
+        const FPingPlayerView& PlayerView = PlayerViews[ViewIndex];
+        FViewConstants& View = Views[ViewIndex];
+        View.Matrix = PlayerView.ViewProjectionMatrix;
+        View.Width = PlayerView.ViewportSize.X;
+        View.Height = PlayerView.ViewportSize.Y;
+        View.CenterX = View.Width * 0.5f;
+        View.CenterY = View.Height * 0.5f;
+        View.HalfInnerX = FMath::Max(View.CenterX - EdgeMargin, 0.0f);
+        View.HalfInnerY = FMath::Max(View.CenterY - EdgeMargin, 0.0f);
+    }
+
+    // Straight-line loop over SoA data; no per-ping engine calls
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const FViewConstants& View = Views[InView[Index]];
+        const FMatrix& M = View.Matrix;
+        const float Width = View.Width;
+        const float Height = View.Height;
+        const float CenterX = View.CenterX;
+        const float CenterY = View.CenterY;
+        const float HalfInnerX = View.HalfInnerX;
+        const float HalfInnerY = View.HalfInnerY;
+
+        const double X = InX[Index];
+        const double Y = InY[Index];
+        const double Z = InZ[Index];
+
+        const double ClipX = X * M.M[0][0] + Y * M.M[1][0] + Z * M.M[2][0] + M.M[3][0];
+        const double ClipY = X * M.M[0][1] + Y * M.M[1][1] + Z * M.M[2][1] + M.M[3][1];
+        const double ClipW = X * M.M[0][3] + Y * M.M[1][3] + Z * M.M[2][3] + M.M[3][3];
+
+        const bool bInFront = ClipW > 0.0;
+        const double RHW = 1.0 / FMath::Max(ClipW, UE_SMALL_NUMBER);
+
+        // Same mapping as FSceneView::ProjectWorldToScreen, relative to the player viewport
+        const float ScreenX = static_cast<float>((ClipX * RHW * 0.5 + 0.5) * Width);
+        const float ScreenY = static_cast<float>((0.5 - ClipY * RHW * 0.5) * Height);
+
+        const float DeltaX = ScreenX - CenterX;
+        const float DeltaY = ScreenY - CenterY;
+        const float AbsDeltaX = FMath::Abs(DeltaX);
+        const float AbsDeltaY = FMath::Abs(DeltaY);
+        const bool bInside = AbsDeltaX <= HalfInnerX && AbsDeltaY <= HalfInnerY;
+
+        // Scale the centre-to-ping ray so it touches the margin rectangle
+        const float EdgeScale = FMath::Min(
+            HalfInnerX / FMath::Max(AbsDeltaX, UE_KINDA_SMALL_NUMBER),
+            HalfInnerY / FMath::Max(AbsDeltaY, UE_KINDA_SMALL_NUMBER));
+
+        OutScreenX[Index] = ScreenX;
+        OutScreenY[Index] = ScreenY;
+        OutFinalX[Index] = bInside ? ScreenX : CenterX + DeltaX * EdgeScale;
+        OutFinalY[Index] = bInside ? ScreenY : CenterY + DeltaY * EdgeScale;
+        OutProjected[Index] = bInFront;
+        OutOnScreen[Index] = bInFront && bInside;
+    }
+}
+
+void UNervePingSubsystem::ApplyPingBatch()
+{
+    const int32 Num = ProjectionBatch.SlotIndices.Num();
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        FPingComponent& PingComponent = PingComponents[ProjectionBatch.SlotIndices[Index]];
+        FPingData& PingData = PingComponent.PingData;
+
+        PingComponent.bProjected = ProjectionBatch.bProjected[Index] != 0;
+        if (!PingComponent.bProjected) continue;
+
+        const bool bIsOnScreen = ProjectionBatch.bOnScreen[Index] != 0;
+        const bool bScreenStateChanged = PingData.bIsOnScreen != bIsOnScreen;
+
+        PingData.ScreenPosition = FVector2D(ProjectionBatch.ScreenX[Index], ProjectionBatch.ScreenY[Index]);
+        PingData.bIsOnScreen = bIsOnScreen;
+        if (!bIsOnScreen)
+        {
+            PingData.EdgePosition = FVector2D(ProjectionBatch.FinalX[Index], ProjectionBatch.FinalY[Index]);
+        }
+
+        // Overlay pings have no component; the overlay reads the data directly
+        UWidgetComponent* WidgetComponent = PingComponent.WidgetComponent;
+        if (!WidgetComponent) continue;
+
+        // Only touch the component when its state actually differs
+        if (!WidgetComponent->GetComponentLocation().Equals(PingData.WorldLocation))
+        {
+            WidgetComponent->SetWorldLocation(PingData.WorldLocation);
+        }
+        if (bScreenStateChanged && IsValid(PingComponent.PingWidget))
+        {
+            PingComponent.PingWidget->SetIsOnScreen(bIsOnScreen);
+        }
+    }
+}
+
+void UNervePingSubsystem::SelectRenderedPings()
+{
+    // Group by player view, then tracked quests first, then nearest to that viewer
+    RenderCandidates.Sort([this](const int32 A, const int32 B)
+    {
+        const FPingComponent& PingA = PingComponents[A];
+        const FPingComponent& PingB = PingComponents[B];
+        if (PingA.ViewIndex != PingB.ViewIndex)
+        {
+            return PingA.ViewIndex < PingB.ViewIndex;
+        }
+        if (PingA.PingData.bIsTracked != PingB.PingData.bIsTracked)
+        {
+            return PingA.PingData.bIsTracked;
+        }
+        return PingA.ViewDistanceSquared < PingB.ViewDistanceSquared;
+    });
+
+    // Each player clusters and caps only their own markers
+    int32 Begin = 0;
+    while (Begin < RenderCandidates.Num())
+    {
+        const int32 ViewIndex = PingComponents[RenderCandidates[Begin]].ViewIndex;
+        int32 End = Begin + 1;
+        while (End < RenderCandidates.Num() && PingComponents[RenderCandidates[End]].ViewIndex == ViewIndex)
+        {
+            ++End;
+        }
+
+        SelectRenderedPingsForView(Begin, End, PlayerViews[ViewIndex].ViewportSize);
+        Begin = End;
+    }
+}
+
+void UNervePingSubsystem::SelectRenderedPingsForView(const int32 Begin, const int32 End, const FVector2D& ViewportSize)
+{
+    for (int32 Rank = Begin; Rank < End; ++Rank)
+    {
+        PingComponents[RenderCandidates[Rank]].PingData.ClusterCount = 1;
+    }
+
+    // Merge off-screen markers pointing the same way; the first, highest-priority member represents the cluster
+    if (bClusterOffScreenPings && OffScreenClusterAngle > 0.0f)
+    {
+        const FVector2D Center = ViewportSize * 0.5;
+
+        OffScreenClusterScratch.Reset();
+        for (int32 Rank = Begin; Rank < End; ++Rank)
+        {
+            const FPingComponent& PingComponent = PingComponents[RenderCandidates[Rank]];
+            if (!PingComponent.bProjected || PingComponent.PingData.bIsOnScreen) continue;
+
+            const FVector2D Direction = PingComponent.PingData.EdgePosition - Center;
+            OffScreenClusterScratch.Emplace(static_cast<float>(FMath::Atan2(Direction.Y, Direction.X)), Rank);
+        }
+
+        OffScreenClusterScratch.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+
+        int32 ClusterStart = 0;
+        const int32 NumOffScreen = OffScreenClusterScratch.Num();
+        while (ClusterStart < NumOffScreen)
+        {
+            const float StartAngle = OffScreenClusterScratch[ClusterStart].Key;
+            int32 ClusterEnd = ClusterStart + 1;
+            while (ClusterEnd < NumOffScreen && OffScreenClusterScratch[ClusterEnd].Key - StartAngle <= OffScreenClusterAngle)
+            {
+                ++ClusterEnd;
+            }
+
+            if (ClusterEnd - ClusterStart > 1)
+            {
+                // Lowest rank wins; RenderCandidates is already in priority order
+                int32 RepresentativeRank = MAX_int32;
+                for (int32 Member = ClusterStart; Member < ClusterEnd; ++Member)
+                {
+                    const int32 Rank = OffScreenClusterScratch[Member].Value;
+                    PingComponents[RenderCandidates[Rank]].PingData.ClusterCount = 0;
+                    RepresentativeRank = FMath::Min(RepresentativeRank, Rank);
+                }
+                PingComponents[RenderCandidates[RepresentativeRank]].PingData.ClusterCount = ClusterEnd - ClusterStart;
+            }
+
+            ClusterStart = ClusterEnd;
+        }
+    }
+
+    // Apply the marker cap in priority order; clustered pings count once
+    int32 RenderedMarkers = 0;
+    for (int32 Rank = Begin; Rank < End; ++Rank)
+    {
+        FPingComponent& PingComponent = PingComponents[RenderCandidates[Rank]];
+        PingComponent.bRendered = PingComponent.bProjected
+            && PingComponent.PingData.ClusterCount > 0
+            && (MaxRenderedPings <= 0 || RenderedMarkers < MaxRenderedPings);
+
+        if (PingComponent.bRendered)
+        {
+            ++RenderedMarkers;
+        }
+    }
+}
+
+void UNervePingSubsystem::ApplyWidgetRenderState()
+{
+    for (const int32 SlotIndex : RenderCandidates)
+    {
+        FPingComponent& PingComponent = PingComponents[SlotIndex];
+        UWidgetComponent* WidgetComponent = PingComponent.WidgetComponent;
+
+        if (WidgetComponent->IsVisible() != PingComponent.bRendered)
+        {
+            WidgetComponent->SetVisibility(PingComponent.bRendered);
+        }
+
+        const int32 ClusterCount = FMath::Max(PingComponent.PingData.ClusterCount, 1);
+        if (PingComponent.bRendered && PingComponent.AppliedClusterCount != ClusterCount && IsValid(PingComponent.PingWidget))
+        {
+            PingComponent.PingWidget->SetClusterCount(ClusterCount);
+            PingComponent.AppliedClusterCount = ClusterCount;
+        }
+    }
+}
+
+void UNervePingSubsystem::UpdatePingOverlays(const float DeltaTime)
+{
+    for (int32 ViewIndex = 0; ViewIndex < PlayerViews.Num(); ++ViewIndex)
+    {
+        FPingPlayerView& PlayerView = PlayerViews[ViewIndex];
+        if (!PlayerView.bValid) continue;
+
+        EnsurePingOverlay(PlayerView);
+        if (!PlayerView.Overlay.IsValid()) continue;
+
+        const FVector2D InvViewportSize(
+            1.0 / FMath::Max(PlayerView.ViewportSize.X, 1.0),
+            1.0 / FMath::Max(PlayerView.ViewportSize.Y, 1.0));
+
+        TArray<FNervePingOverlayItem>& Items = PlayerView.Overlay->ModifyItems();
+        Items.Reset();
+
+        // Walk lowest priority first so tracked and near markers paint on top
+        for (int32 Index = RenderCandidates.Num() - 1; Index >= 0; --Index)
+        {
+            FPingComponent& PingComponent = PingComponents[RenderCandidates[Index]];
+            if (PingComponent.ViewIndex != ViewIndex) continue;
+
+            if (!PingComponent.bRendered)
+            {
+                PingComponent.bHasDisplayedPosition = false;
+                continue;
+            }
+
+            const FPingData& PingData = PingComponent.PingData;
+            const FVector2D TargetPosition = PingData.bIsOnScreen ? PingData.ScreenPosition : PingData.EdgePosition;
+
+            // Near pings snap; throttled tiers glide between their sparse projections
+            PingComponent.DisplayedPosition = PingComponent.bHasDisplayedPosition && PingComponent.LodTier > 0
+                ? FMath::Vector2DInterpTo(PingComponent.DisplayedPosition, TargetPosition, DeltaTime, LodInterpSpeed)
+                : TargetPosition;
+            PingComponent.bHasDisplayedPosition = true;
+
+            FNervePingOverlayItem& Item = Items.AddDefaulted_GetRef();
+            Item.NormalizedPosition = PingComponent.DisplayedPosition * InvViewportSize;
+            Item.Label = PingData.ClusterCount > 1 ? GetClusterLabel(PingData.ClusterCount) : PingData.DistanceLabel;
+            Item.bOnScreen = PingData.bIsOnScreen;
+            Item.bOccluded = PingData.bIsOccluded;
+        }
+
+        PlayerView.Overlay->CommitItems();
+    }
+}
+
+const FString& UNervePingSubsystem::GetClusterLabel(const int32 ClusterCount)
+{
+    for (int32 Count = ClusterLabels.Num(); Count <= ClusterCount; ++Count)
+    {
+        ClusterLabels.Add(FString::Printf(TEXT("x%d"), Count));
+    }
+    return ClusterLabels[ClusterCount];
+}
+
+int32 UNervePingSubsystem::GetLodTier(const double DistanceSquared, float& OutInterval) const
+{
+    int32 Tier = 0;
+    OutInterval = 0.0f;
+    for (int32 Index = 0; Index < LodTierDistancesSquared.Num() && DistanceSquared >= LodTierDistancesSquared[Index]; ++Index)
+    {
+        Tier = Index + 1;
+        OutInterval = LodTierIntervals[Index];
+    }
+    return Tier;
+}
+
+FPingComponent* UNervePingSubsystem::FindPingByID(const int32 PingID)
+{
+    return const_cast<FPingComponent*>(static_cast<const UNervePingSubsystem*>(this)->FindPingByID(PingID));
+}
+
+const FPingComponent* UNervePingSubsystem::FindPingByID(const int32 PingID) const
+{
+    if (PingID < 0) return nullptr;
+
+    // Decode the handle and reject it if the slot was released since
+    const int32 SlotIndex = PingID & PingHandleIndexMask;
+    if (!PingComponents.IsValidIndex(SlotIndex)) return nullptr;
+
+    const FPingComponent& PingComponent = PingComponents[SlotIndex];
+    if (!PingComponent.IsInUse() || PingComponent.PingID != PingID) return nullptr;
+
+    return &PingComponent;
+}
+
+int32 UNervePingSubsystem::MakePingHandle(const int32 SlotIndex, const int32 Generation)
+{
+    return ((Generation & PingHandleGenerationMask) << PingHandleIndexBits) | (SlotIndex & PingHandleIndexMask);
+}
+
+int32 UNervePingSubsystem::AllocatePingSlot()
+{
+    int32 SlotIndex;
+    if (!FreePingSlots.IsEmpty())
+    {
+        SlotIndex = FreePingSlots.Pop();
+    }
+    else
+    {
+        if (PingComponents.Num() > PingHandleIndexMask) return INDEX_NONE;
+        SlotIndex = PingComponents.AddDefaulted();
+    }
+
+    PingComponents[SlotIndex].ActiveIndex = ActivePingSlots.Add(SlotIndex);
+    PingComponents[SlotIndex].ResetRuntimeState();
+    return SlotIndex;
+}
+
+void UNervePingSubsystem::ReleasePingSlot(const int32 SlotIndex)
+{
+    FPingComponent& PingComponent = PingComponents[SlotIndex];
+    if (!PingComponent.IsInUse()) return;
+
+    // Swap-remove from the dense list and patch the moved slot's back index
+    const int32 ActiveIndex = PingComponent.ActiveIndex;
+    ActivePingSlots.RemoveAtSwap(ActiveIndex);
+    if (ActivePingSlots.IsValidIndex(ActiveIndex))
+    {
+        PingComponents[ActivePingSlots[ActiveIndex]].ActiveIndex = ActiveIndex;
+    }
+
+    PingComponent.ActiveIndex = INDEX_NONE;
+    PingComponent.PingID = -1;
+    PingComponent.Generation = (PingComponent.Generation % PingHandleGenerationMask) + 1;
+    FreePingSlots.Add(SlotIndex);
+}
+
+UWidgetComponent* UNervePingSubsystem::AcquireWidgetComponent(const TSubclassOf<UUserWidget>& WidgetClass)
+{
+    if (FPingWidgetComponentPool* Pool = WidgetComponentPools.Find(WidgetClass.Get()))
+    {
+        while (!Pool->Components.IsEmpty())
+        {
+            UWidgetComponent* PooledComponent = Pool->Components.Pop();
+            if (IsValid(PooledComponent))
+            {
+                return PooledComponent;
+            }
+        }
+    }
+
+    UWidgetComponent* WidgetComponent = CreateWidgetComponent(WidgetClass);
+    if (IsValid(WidgetComponent))
+    {
+        // Initialize the widget once; pooled components keep theirs
+        WidgetComponent->InitWidget();
+    }
+    return WidgetComponent;
+}
+
+void UNervePingSubsystem::ReleaseWidgetComponent(UWidgetComponent* WidgetComponent)
+{
+    if (!IsValid(WidgetComponent)) return;
+
+    UClass* WidgetClass = WidgetComponent->GetWidgetClass();
+    if (!IsValid(WidgetClass))
+    {
+        WidgetComponent->DestroyComponent();
+        return;
+    }
+
+    FPingWidgetComponentPool& Pool = WidgetComponentPools.FindOrAdd(WidgetClass);
+    if (Pool.Components.Num() >= MaxPooledWidgetsPerClass)
+    {
+        WidgetComponent->DestroyComponent();
+        return;
+    }
+
+    // Park the component hidden until the next ping of the same class needs it
+    WidgetComponent->SetVisibility(false);
+    if (UWorldGotoPing* PingWidget = Cast<UWorldGotoPing>(WidgetComponent->GetUserWidgetObject()))
+    {
+        PingWidget->SetIsOnScreen(true);
+        PingWidget->SetClusterCount(1);
+        PingWidget->SetIsOccluded(false);
+    }
+    Pool.Components.Add(WidgetComponent);
+}
+
+UWidgetComponent* UNervePingSubsystem::CreateWidgetComponent(const TSubclassOf<UUserWidget>& WidgetClass)
+{
+    if (!WidgetClass)  return nullptr;
+
+    UWorld* World = GetWorld();
+    if (!IsValid(World)) return nullptr;
+
+    // Ownerless components live in the world settings actor, like other world-spawned effects
+    UObject* Outer = World->GetWorldSettings() ? static_cast<UObject*>(World->GetWorldSettings()) : World;
+
+    // Create a unique name for the widget component
+    const FName ComponentName = MakeUniqueObjectName(Outer, UWidgetComponent::StaticClass(), TEXT("PingWidget"));
+    
+    // Use NewObject instead of CreateDefaultSubobject for runtime creation
+    UWidgetComponent* WidgetComponent = NewObject<UWidgetComponent>(Outer, ComponentName);
+    if (!IsValid(WidgetComponent)) return nullptr;
+
+    // Configure the widget component
+    WidgetComponent->SetWidgetSpace(EWidgetSpace::Screen);
+    WidgetComponent->SetDrawAtDesiredSize(true);
+    WidgetComponent->SetWidgetClass(WidgetClass);
+    
+    // Register directly with the world; there is no owning actor to attach to
+    WidgetComponent->RegisterComponentWithWorld(World);
+    
+    return WidgetComponent;
+}
+
+void UNervePingSubsystem::CleanupPingComponent(FPingComponent& PingComponent)
+{
+    ReleaseWidgetComponent(PingComponent.WidgetComponent);
+    PingComponent.WidgetComponent = nullptr;
+    PingComponent.PingWidget = nullptr;
+}
+
+void UNervePingSubsystem::DestroyPooledWidgetComponents()
+{
+    for (TPair<TObjectPtr<UClass>, FPingWidgetComponentPool>& Pair : WidgetComponentPools)
+    {
+        for (UWidgetComponent* PooledComponent : Pair.Value.Components)
+        {
+            if (IsValid(PooledComponent))
+            {
+                PooledComponent->DestroyComponent();
+            }
+        }
+    }
+    WidgetComponentPools.Empty();
+}
+
+void UNervePingSubsystem::EnsurePingOverlay(FPingPlayerView& PlayerView)
+{
+    if (PlayerView.Overlay.IsValid()) return;
+
+    UGameViewportClient* ViewportClient = GetWorld() ? GetWorld()->GetGameViewport() : nullptr;
+    ULocalPlayer* LocalPlayer = PlayerView.LocalPlayer.Get();
+    if (!IsValid(ViewportClient) || !LocalPlayer) return;
+
+    const UNerveQuestRuntimeSetting* Settings = GetDefault<UNerveQuestRuntimeSetting>();
+    PlayerView.Overlay = SNew(SNervePingOverlay)
+        .MarkerBrush(&Settings->OverlayMarkerBrush)
+        .EdgeMarkerBrush(&Settings->OverlayEdgeMarkerBrush)
+        .LabelFont(Settings->OverlayLabelFont)
+        .LabelColor(Settings->OverlayLabelColor)
+        .OccludedTint(Settings->OverlayOccludedTint);
+
+    // Added per player so split-screen overlays are laid out inside that player's view
+    ViewportClient->AddViewportWidgetForPlayer(LocalPlayer, PlayerView.Overlay.ToSharedRef(), Settings->OverlayZOrder);
+}
+
+void UNervePingSubsystem::RemovePingOverlay(FPingPlayerView& PlayerView)
+{
+    if (!PlayerView.Overlay.IsValid()) return;
+
+    UGameViewportClient* ViewportClient = GetWorld() ? GetWorld()->GetGameViewport() : nullptr;
+    if (IsValid(ViewportClient) && PlayerView.LocalPlayer.IsValid())
+    {
+        ViewportClient->RemoveViewportWidgetForPlayer(PlayerView.LocalPlayer.Get(), PlayerView.Overlay.ToSharedRef());
+    }
+
+    PlayerView.Overlay.Reset();
+}
+
+void UNervePingSubsystem::RemoveAllPingOverlays()
+{
+    for (FPingPlayerView& PlayerView : PlayerViews)
+    {
+        RemovePingOverlay(PlayerView);
+    }
+}
@@ -0,0 +1,121 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#include "Subsystem/NerveQuestEventSubsystem.h"
+#include "Objects/Nodes/Objective/NerveCounterObjective.h"
+#include "Engine/World.h"
+
+void UNerveQuestEventSubsystem::Deinitialize()
+{
+    PendingEvents.Empty();
+    PendingCounts.Empty();
+    CountersByTag.Empty();
+
+    Super::Deinitialize();
+}
+
+void UNerveQuestEventSubsystem::Tick(const float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+    FlushPendingCounts();
+}
+
+bool UNerveQuestEventSubsystem::IsTickable() const
+{
+    return !PendingEvents.IsEmpty() || !PendingCounts.IsEmpty();
+}
+
+TStatId UNerveQuestEventSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNerveQuestEventSubsystem, STATGROUP_Tickables);
+}
+
+bool UNerveQuestEventSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    // Events only matter while playing, including every PIE instance
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UNerveQuestEventSubsystem* UNerveQuestEventSubsystem::GetQuestEventSubsystem(const UObject* WorldContextObject)
+{
+    const UWorld* World = IsValid(WorldContextObject) ? WorldContextObject->GetWorld() : nullptr;
+    return IsValid(World) ? World->GetSubsystem<UNerveQuestEventSubsystem>() : nullptr;
+}
+
+void UNerveQuestEventSubsystem::ReportQuestEvent(const FGameplayTag EventTag, const int32 Amount)
+{
+    if (!EventTag.IsValid() || Amount <= 0) return;
+
+    // Nobody listens, nothing to remember
+    if (CountersByTag.IsEmpty()) return;
+
+    PendingEvents.FindOrAdd(EventTag) += Amount;
+}
+
+void UNerveQuestEventSubsystem::RegisterCounter(FNerveObjectiveRun& CounterRun, const FGameplayTag& EventTag)
+{
+    if (!EventTag.IsValid()) return;
+
+    TArray<TWeakPtr<FNerveObjectiveRun>>& Listeners = CountersByTag.FindOrAdd(EventTag);
+    if (!Listeners.ContainsByPredicate([&CounterRun](const TWeakPtr<FNerveObjectiveRun>& Listener) { return Listener.HasSameObject(&CounterRun); }))
+    {
+        Listeners.Add(CounterRun.AsShared());
+    }
+}
+
+void UNerveQuestEventSubsystem::UnregisterCounter(const FNerveObjectiveRun* CounterRun)
+{
+    PendingCounts.Remove(CounterRun);
+
+    // Compared by address only, the run may already be destroying
+    for (auto It = CountersByTag.CreateIterator(); It; ++It)
+    {
+        It.Value().RemoveAllSwap([CounterRun](const TWeakPtr<FNerveObjectiveRun>& Listener) { return Listener.HasSameObject(CounterRun); });
+        if (It.Value().IsEmpty()) It.RemoveCurrent();
+    }
+}
+
+void UNerveQuestEventSubsystem::QueueCount(FNerveObjectiveRun& CounterRun, const int32 Amount)
+{
+    if (Amount <= 0) return;
+
+    FPendingCount& Pending = PendingCounts.FindOrAdd(&CounterRun);
+    Pending.Run = CounterRun.AsShared();
+    Pending.Amount += Amount;
+}
+
+void UNerveQuestEventSubsystem::FlushPendingCounts()
+{
+    // Distribute the frame's event totals; Quest.Event.Kill.Goblin also feeds counters of Quest.Event.Kill
+    for (const TPair<FGameplayTag, int32>& Event : PendingEvents)
+    {
+        for (const TPair<FGameplayTag, TArray<TWeakPtr<FNerveObjectiveRun>>>& Listeners : CountersByTag)
+        {
+            if (!Event.Key.MatchesTag(Listeners.Key)) continue;
+
+            for (const TWeakPtr<FNerveObjectiveRun>& Listener : Listeners.Value)
+            {
+                if (const TSharedPtr<FNerveObjectiveRun> Run = Listener.Pin())
+                {
+                    FPendingCount& Pending = PendingCounts.FindOrAdd(Run.Get());
+                    Pending.Run = Listener;
+                    Pending.Amount += Event.Value;
+                }
+            }
+        }
+    }
+    PendingEvents.Reset();
+
+    // Counters may complete and unregister, or report new events, while applying
+    TMap<const FNerveObjectiveRun*, FPendingCount> CountsToApply = MoveTemp(PendingCounts);
+    PendingCounts.Reset();
+
+    for (const TPair<const FNerveObjectiveRun*, FPendingCount>& Count : CountsToApply)
+    {
+        const TSharedPtr<FNerveObjectiveRun> Run = Count.Value.Run.Pin();
+        UNerveCounterObjective* Counter = Run.IsValid() ? Cast<UNerveCounterObjective>(Run->Objective.Get()) : nullptr;
+        if (Counter)
+        {
+            Counter->ApplyCount(*Run, Count.Value.Amount);
+        }
+    }
+}
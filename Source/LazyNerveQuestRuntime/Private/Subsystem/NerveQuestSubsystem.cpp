@@ -8,10 +8,106 @@
 #include "Setting/NerveQuestRuntimeSetting.h"
 #include "Objects/NerveQuest/NerveQuestAsset.h"
 #include "Objects/Nodes/Objective/NerveEntryObjective.h"
+#include "Objects/Nodes/Objective/NerveForkObjective.h"
+#include "Objects/Nodes/Objective/NerveJoinObjective.h"
 #include "Objects/Pin/NerveQuestRuntimePin.h"
 #include "Objects/Rewards/NerveQuestRewardBase.h"
+#include "Subsystem/NervePingSubsystem.h"
+#include "Subsystem/NerveQuestTimerSubsystem.h"
+#include "Widget/NerveQuestJournalItem.h"
 #include "Widget/QuestScreen.h"
 
+namespace
+{
+	/** Adds the indices of the objectives that directly follow a node, looking through forks and joins */
+	void GatherObjectiveSuccessors(const UNerveQuestRuntimeObjectiveBase* Node, const TMap<const UNerveQuestRuntimeObjectiveBase*, int32>& NodeIndices, TArray<int32>& OutSuccessors)
+	{
+		TArray<const UNerveQuestRuntimeObjectiveBase*, TInlineAllocator<8>> Pending;
+		TSet<const UNerveQuestRuntimeObjectiveBase*, DefaultKeyFuncs<const UNerveQuestRuntimeObjectiveBase*>, TInlineSetAllocator<8>> Visited;
+		Pending.Add(Node);
+
+		while (!Pending.IsEmpty())
+		{
+			const UNerveQuestRuntimeObjectiveBase* Current = Pending.Pop();
+			const int32 NumPins = Current->IsA<UNerveForkObjective>() ? Current->OutPutPin.Num() : FMath::Min(Current->OutPutPin.Num(), 1);
+
+			for (int32 PinIndex = 0; PinIndex < NumPins; PinIndex++)
+			{
+				if (!IsValid(Current->OutPutPin[PinIndex])) continue;
+
+				for (const UNerveQuestRuntimePin* Connection : Current->OutPutPin[PinIndex]->GetValidConnections())
+				{
+					const UNerveQuestRuntimeObjectiveBase* Next = Connection->GetParentNode();
+					if (!IsValid(Next) || Visited.Contains(Next)) continue;
+					Visited.Add(Next);
+
+					if (const int32* Index = NodeIndices.Find(Next))
+					{
+						OutSuccessors.Add(*Index);
+					}
+					else if (Next->IsA<UNerveForkObjective>() || Next->IsA<UNerveJoinObjective>())
+					{
+						Pending.Add(Next);
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 * Adds the joins a fork's branches meet again at: the first join on each path that is not matched
+	 * by a fork opened further down the path. Branches that end without a join add nothing.
+	 */
+	void GatherClosingJoins(const TConstArrayView<const UNerveQuestRuntimePin*> BranchPins, TArray<const UNerveJoinObjective*, TInlineAllocator<4>>& OutJoins)
+	{
+		TArray<TPair<const UNerveQuestRuntimeObjectiveBase*, int32>, TInlineAllocator<8>> Pending;
+		TSet<const UNerveQuestRuntimeObjectiveBase*, DefaultKeyFuncs<const UNerveQuestRuntimeObjectiveBase*>, TInlineSetAllocator<8>> Visited;
+
+		// Several links on one pin of a plain node fork like a fork node; the links of a fork are its branches
+		auto AddConnections = [&Pending, &Visited](const UNerveQuestRuntimePin* Pin, const int32 Depth, const bool bLinksFork)
+		{
+			if (!IsValid(Pin)) return;
+
+			const TArray<UNerveQuestRuntimePin*> Connections = Pin->GetValidConnections();
+			for (const UNerveQuestRuntimePin* Connection : Connections)
+			{
+				const UNerveQuestRuntimeObjectiveBase* Next = Connection->GetParentNode();
+				if (!IsValid(Next) || Visited.Contains(Next)) continue;
+				Visited.Add(Next);
+				Pending.Emplace(Next, bLinksFork && Connections.Num() > 1 ? Depth + 1 : Depth);
+			}
+		};
+
+		for (const UNerveQuestRuntimePin* BranchPin : BranchPins)
+		{
+			AddConnections(BranchPin, 0, false);
+		}
+
+		while (!Pending.IsEmpty())
+		{
+			const TPair<const UNerveQuestRuntimeObjectiveBase*, int32> Current = Pending.Pop();
+			const UNerveQuestRuntimeObjectiveBase* Node = Current.Key;
+
+			if (const UNerveJoinObjective* Join = Cast<UNerveJoinObjective>(Node))
+			{
+				if (Current.Value == 0)
+				{
+					OutJoins.AddUnique(Join);
+					continue;
+				}
+				AddConnections(Join->OutPutPin.IsValidIndex(0) ? Join->OutPutPin[0].Get() : nullptr, Current.Value - 1, true);
+				continue;
+			}
+
+			const bool bIsFork = Node->IsA<UNerveForkObjective>();
+			for (const UNerveQuestRuntimePin* OutPin : Node->OutPutPin)
+			{
+				AddConnections(OutPin, bIsFork ? Current.Value + 1 : Current.Value, !bIsFork);
+			}
+		}
+	}
+}
+
 void UNerveQuestSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
@@ -27,6 +123,10 @@ void UNerveQuestSubsystem::Deinitialize()
 	
 	// Use existing comprehensive cleanup
 	ResetAllQuests();
+	PendingProgressObjectives.Empty();
+	TrimRuntimeDataPools();
+	LiveObjectiveRuntimeData.Empty();
+	TableQuests.Empty();
 	
 	// Clear any remaining references
 	QuestRuntimeSetting = nullptr;
@@ -37,6 +137,39 @@ void UNerveQuestSubsystem::Deinitialize()
 	UE_LOG(LogTemp, Log, TEXT("NerveQuestSubsystem: Shutdown cleanup completed"));
 }
 
+void UNerveQuestSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UNerveQuestSubsystem* This = CastChecked<UNerveQuestSubsystem>(InThis);
+
+	// One pass over plain arrays instead of a reflected walk of every runtime data object
+	Collector.AddReferencedObjects(This->LiveObjectiveRuntimeData, This);
+	for (UNerveObjectiveRuntimeData* Objective : This->LiveObjectiveRuntimeData)
+	{
+		if (Objective)
+		{
+			Objective->AddStateReferences(Collector);
+		}
+	}
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+void UNerveQuestSubsystem::Tick(float DeltaTime)
+{
+	FlushPendingProgress();
+}
+
+bool UNerveQuestSubsystem::IsTickable() const
+{
+	// Progress stays queued while paused and is delivered on resume
+	return !HasAnyFlags(RF_ClassDefaultObject) && !bAllQuestsPaused && !PendingProgressObjectives.IsEmpty();
+}
+
+TStatId UNerveQuestSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNerveQuestSubsystem, STATGROUP_Tickables);
+}
+
 void UNerveQuestSubsystem::SetupQuestScreen()
 {
 	// Validate settings and screen class
@@ -144,7 +277,7 @@ bool UNerveQuestSubsystem::AddQuestInternal(UNerveQuestAsset* LoadedQuest, const
 	}
 
 	// Create and initialize quest runtime data
-	UNerveQuestRuntimeData* NewQuestRuntimeData = NewObject<UNerveQuestRuntimeData>(this);
+	UNerveQuestRuntimeData* NewQuestRuntimeData = AcquireQuestRuntimeData();
 	if (!IsValid(NewQuestRuntimeData))
 	{
 		UE_LOG(LogTemp, Error, TEXT("AddQuest: Failed to create quest runtime data"));
@@ -156,6 +289,7 @@ bool UNerveQuestSubsystem::AddQuestInternal(UNerveQuestAsset* LoadedQuest, const
 
 	// Rest of your code...
 	NewQuestRuntimeData->OnQuestCompleted.AddDynamic(this, &UNerveQuestSubsystem::QuestCompleted);
+	NewQuestRuntimeData->RefreshPauseState();
 	NewQuestRuntimeData->StartQuest();
 
 	if (bTrackQuest)
@@ -170,6 +304,121 @@ bool UNerveQuestSubsystem::AddQuestInternal(UNerveQuestAsset* LoadedQuest, const
 	return true;
 }
 
+bool UNerveQuestSubsystem::AddQuestFromTable(const UDataTable* QuestTable, const FName RowName, const bool bTrackQuest, UObject* WorldContextObject)
+{
+	UNerveQuestAsset* Quest = GetQuestFromTable(QuestTable, RowName);
+	if (!IsValid(Quest))
+	{
+		UE_LOG(LogTemp, Error, TEXT("AddQuestFromTable: No quest for row %s"), *RowName.ToString());
+		return false;
+	}
+
+	return AddQuestInternal(Quest, bTrackQuest, WorldContextObject);
+}
+
+UNerveQuestAsset* UNerveQuestSubsystem::GetQuestFromTable(const UDataTable* QuestTable, const FName RowName)
+{
+	if (!IsValid(QuestTable))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GetQuestFromTable: Invalid data table"));
+		return nullptr;
+	}
+
+	FNerveQuestTableInstances& Instances = TableQuests.FindOrAdd(QuestTable);
+	if (const TObjectPtr<UNerveQuestAsset>* Existing = Instances.Quests.Find(RowName))
+	{
+		return *Existing;
+	}
+
+	const FNerveQuestTemplateRow* Row = QuestTable->FindRow<FNerveQuestTemplateRow>(RowName, TEXT("GetQuestFromTable"));
+	if (!Row) return nullptr;
+
+	UNerveQuestAsset* Template = Row->Template.LoadSynchronous();
+	UNerveQuestAsset* Quest = UNerveQuestAsset::CreateTemplateInstance(this, Template, *Row, RowName);
+	if (IsValid(Quest))
+	{
+		Instances.Quests.Add(RowName, Quest);
+	}
+	return Quest;
+}
+
+int32 UNerveQuestSubsystem::PreloadQuestTable(const UDataTable* QuestTable)
+{
+	if (!IsValid(QuestTable)) return 0;
+
+	int32 NumQuests = 0;
+	for (const FName& RowName : QuestTable->GetRowNames())
+	{
+		if (IsValid(GetQuestFromTable(QuestTable, RowName)))
+		{
+			NumQuests++;
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("PreloadQuestTable: %d quests available from %s"), NumQuests, *QuestTable->GetName());
+	return NumQuests;
+}
+
+UNerveQuestAsset* UNerveQuestSubsystem::GenerateRadiantQuest(UNerveQuestAsset* Template, const int32 Seed, UObject* WorldContextObject)
+{
+	if (!IsValid(Template))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GenerateRadiantQuest: Invalid template"));
+		return nullptr;
+	}
+
+	return UNerveQuestAsset::CreateRadiantInstance(this, Template, Seed, WorldContextObject ? WorldContextObject : GetWorld());
+}
+
+TArray<UNerveQuestAsset*> UNerveQuestSubsystem::GenerateRadiantQuestOffers(UNerveQuestAsset* Template, const int32 BaseSeed, const int32 Count, UObject* WorldContextObject)
+{
+	TArray<UNerveQuestAsset*> Offers;
+	Offers.Reserve(FMath::Max(Count, 0));
+
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		if (UNerveQuestAsset* Offer = GenerateRadiantQuest(Template, GetRadiantOfferSeed(BaseSeed, Index), WorldContextObject))
+		{
+			Offers.Add(Offer);
+		}
+	}
+	return Offers;
+}
+
+bool UNerveQuestSubsystem::AddRadiantQuest(UNerveQuestAsset* Template, const int32 Seed, const bool bTrackQuest, UObject* WorldContextObject)
+{
+	if (IsValid(FindRadiantQuest(Template, Seed)))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AddRadiantQuest: Quest %d of %s is already active"), Seed, *GetNameSafe(Template));
+		return false;
+	}
+
+	UNerveQuestAsset* Quest = GenerateRadiantQuest(Template, Seed, WorldContextObject);
+	if (!IsValid(Quest)) return false;
+
+	return AddQuestInternal(Quest, bTrackQuest, WorldContextObject);
+}
+
+UNerveQuestAsset* UNerveQuestSubsystem::FindRadiantQuest(const UNerveQuestAsset* Template, const int32 Seed) const
+{
+	if (!IsValid(Template)) return nullptr;
+
+	for (const TPair<TObjectPtr<UNerveQuestAsset>, TObjectPtr<UNerveQuestRuntimeData>>& Pair : QuestRuntimeDataMap)
+	{
+		const UNerveQuestAsset* Quest = Pair.Key;
+		if (IsValid(Quest) && Quest->bIsRadiant && Quest->TemplateAsset == Template && Quest->RadiantSeed == Seed)
+		{
+			return Pair.Key;
+		}
+	}
+	return nullptr;
+}
+
+int32 UNerveQuestSubsystem::GetRadiantOfferSeed(const int32 BaseSeed, const int32 OfferIndex)
+{
+	return static_cast<int32>(HashCombine(GetTypeHash(BaseSeed), GetTypeHash(OfferIndex)));
+}
+
 bool UNerveQuestSubsystem::RemoveQuest(UNerveQuestAsset* QuestToRemove)
 {
 	// Validate quest
@@ -188,6 +437,7 @@ bool UNerveQuestSubsystem::RemoveQuest(UNerveQuestAsset* QuestToRemove)
 	}
 
 	// Clean up runtime data
+	RemoveJournalItem(QuestRuntimeData);
 	QuestRuntimeData->Uninitialize();
 	QuestRuntimeDataMap.Remove(QuestToRemove);
 
@@ -195,8 +445,8 @@ bool UNerveQuestSubsystem::RemoveQuest(UNerveQuestAsset* QuestToRemove)
 	OnQuestChanged.Broadcast(QuestToRemove);
 	OnQuestRemoved.Broadcast(QuestToRemove);
 
-	// Mark for garbage collection
-	QuestRuntimeData->ConditionalBeginDestroy();
+	// Hand the runtime data back for the next quest
+	ReleaseQuestRuntimeData(QuestRuntimeData);
 
 	UE_LOG(LogTemp, Log, TEXT("RemoveQuest: Successfully removed quest %s"), *QuestToRemove->GetName());
 	return true;
@@ -205,39 +455,59 @@ bool UNerveQuestSubsystem::RemoveQuest(UNerveQuestAsset* QuestToRemove)
 void UNerveQuestSubsystem::ResetAllQuests()
 {
 	UE_LOG(LogTemp, Log, TEXT("ResetQuestSystem: Resetting entire quest system"));
-	
-	for (auto& Pair : QuestRuntimeDataMap)
+
+	for (auto& Pair : JournalItems)
 	{
 		if (IsValid(Pair.Value))
 		{
 			Pair.Value->Uninitialize();
-			Pair.Value->ConditionalBeginDestroy();
 		}
 	}
+	JournalItems.Empty();
+	
+	// Releasing edits the maps below, so work on snapshots
+	TArray<TObjectPtr<UNerveQuestRuntimeData>> Quests;
+	QuestRuntimeDataMap.GenerateValueArray(Quests);
 	QuestRuntimeDataMap.Empty();
+	for (UNerveQuestRuntimeData* Quest : Quests)
+	{
+		if (IsValid(Quest) && !Quest->IsPooled())
+		{
+			Quest->Uninitialize();
+			ReleaseQuestRuntimeData(Quest);
+		}
+	}
 
+	TArray<UNerveObjectiveRuntimeData*> Optionals;
 	for (auto& Pair : ActiveOptionalObjectives)
 	{
 		for (FOptionalObjectiveData& Data : Pair.Value.ObjectiveData)
 		{
-			if (IsValid(Data.OptionalObjective))
-			{
-				Data.OptionalObjective->Uninitialize();
-				Data.OptionalObjective->ConditionalBeginDestroy();
-			}
+			Optionals.Add(Data.OptionalObjective);
 		}
 	}
 	ActiveOptionalObjectives.Empty();
-
-	for (auto& Pair : TrackedSubQuests)
+	for (UNerveObjectiveRuntimeData* Optional : Optionals)
 	{
-		if (IsValid(Pair.Key))
+		if (IsValid(Optional) && !Optional->IsPooled())
 		{
-			Pair.Key->Uninitialize();
-			Pair.Key->ConditionalBeginDestroy();
+			Optional->Uninitialize();
+			ReleaseObjectiveRuntimeData(Optional);
 		}
 	}
+
+	// Sub-quests are normally released by their objective while the quests above are cleaned up
+	TArray<TObjectPtr<UNerveQuestRuntimeData>> SubQuests;
+	TrackedSubQuests.GenerateKeyArray(SubQuests);
 	TrackedSubQuests.Empty();
+	for (UNerveQuestRuntimeData* SubQuest : SubQuests)
+	{
+		if (IsValid(SubQuest) && !SubQuest->IsPooled())
+		{
+			SubQuest->Uninitialize();
+			ReleaseQuestRuntimeData(SubQuest);
+		}
+	}
 	
 	DisplayedObjectives.Empty();
 	
@@ -249,6 +519,95 @@ void UNerveQuestSubsystem::ResetAllQuests()
 	UE_LOG(LogTemp, Log, TEXT("ResetQuestSystem: Quest system fully reset"));
 }
 
+void UNerveQuestSubsystem::PauseAllQuests()
+{
+	if (bAllQuestsPaused) return;
+	bAllQuestsPaused = true;
+
+	for (auto& Pair : QuestRuntimeDataMap)
+	{
+		if (IsValid(Pair.Value))
+		{
+			Pair.Value->RefreshPauseState();
+		}
+	}
+
+	if (UNervePingSubsystem* PingSubsystem = UNervePingSubsystem::GetPingSubsystem(this))
+	{
+		PingSubsystem->SuspendPingUpdates(this);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("PauseAllQuests: Paused %d quests"), QuestRuntimeDataMap.Num());
+}
+
+void UNerveQuestSubsystem::ResumeAllQuests()
+{
+	if (!bAllQuestsPaused) return;
+	bAllQuestsPaused = false;
+
+	for (auto& Pair : QuestRuntimeDataMap)
+	{
+		if (IsValid(Pair.Value))
+		{
+			Pair.Value->RefreshPauseState();
+		}
+	}
+
+	if (UNervePingSubsystem* PingSubsystem = UNervePingSubsystem::GetPingSubsystem(this))
+	{
+		PingSubsystem->ResumePingUpdates(this);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("ResumeAllQuests: Resumed quests"));
+}
+
+bool UNerveQuestSubsystem::PauseQuest(UNerveQuestAsset* Quest)
+{
+	UNerveQuestRuntimeData* QuestData = GetQuestRuntimeData(Quest);
+	if (!IsValid(QuestData))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("PauseQuest: Quest not registered"));
+		return false;
+	}
+
+	QuestData->PauseQuest();
+	OnQuestChanged.Broadcast(Quest);
+	return true;
+}
+
+bool UNerveQuestSubsystem::ResumeQuest(UNerveQuestAsset* Quest)
+{
+	UNerveQuestRuntimeData* QuestData = GetQuestRuntimeData(Quest);
+	if (!IsValid(QuestData))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ResumeQuest: Quest not registered"));
+		return false;
+	}
+
+	QuestData->ResumeQuest();
+	OnQuestChanged.Broadcast(Quest);
+	return true;
+}
+
+bool UNerveQuestSubsystem::IsQuestPaused(const UNerveQuestAsset* Quest) const
+{
+	const UNerveQuestRuntimeData* QuestData = GetQuestRuntimeData(Quest);
+	return IsValid(QuestData) && QuestData->IsPaused();
+}
+
+bool UNerveQuestSubsystem::SetQuestTimeDilation(UNerveQuestAsset* Quest, const float TimeDilation)
+{
+	UNerveQuestRuntimeData* QuestData = GetQuestRuntimeData(Quest);
+	if (!IsValid(QuestData))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SetQuestTimeDilation: Quest not registered"));
+		return false;
+	}
+
+	QuestData->SetTimeDilation(TimeDilation);
+	return true;
+}
+
 void UNerveQuestSubsystem::TrackQuest(UNerveQuestAsset* QuestToTrack)
 {
 	// Validate inputs
@@ -334,7 +693,7 @@ bool UNerveQuestSubsystem::StartOptionalObjective(UNerveQuestRuntimeData* Parent
 	}
 
 	// Create runtime data
-	UNerveObjectiveRuntimeData* OptionalRuntimeData = NewObject<UNerveObjectiveRuntimeData>(this);
+	UNerveObjectiveRuntimeData* OptionalRuntimeData = AcquireObjectiveRuntimeData();
 	if (!IsValid(OptionalRuntimeData))
 	{
 		UE_LOG(LogTemp, Error, TEXT("StartOptionalObjective: Failed to create runtime data"));
@@ -343,21 +702,8 @@ bool UNerveQuestSubsystem::StartOptionalObjective(UNerveQuestRuntimeData* Parent
 
 	// Initialize objective with consistent parameters (matching regular objectives)
 	OptionalRuntimeData->Initialize(OptionalObjectiveBase, this, OptionalObjectiveBase->bIsOptionalObjective);
+	OptionalRuntimeData->SetOwningQuest(ParentQuest);
 
-	// Set world context (consistent with regular objectives) with fallback
-	UObject* WorldContext = QuestWorldContextObject.Get();
-	if (!IsValid(WorldContext) && GetWorld())
-	{
-		WorldContext = GetWorld();
-		UE_LOG(LogTemp, Log, TEXT("StartOptionalObjective: Using subsystem world as fallback for optional objective"));
-	}
-	
-	if (IsValid(WorldContext))
-	{
-		OptionalObjectiveBase->SetWorldContextObject(WorldContext);
-		UE_LOG(LogTemp, Log, TEXT("StartOptionalObjective: Set world context for optional objective %s"), *OptionalObjectiveBase->GetName());
-	}
-	
 	// Create and store optional objective data
 	FOptionalObjectiveData OptionalData;
 	OptionalData.OptionalObjective = OptionalRuntimeData;
@@ -373,8 +719,7 @@ bool UNerveQuestSubsystem::StartOptionalObjective(UNerveQuestRuntimeData* Parent
 	OptionalRuntimeData->OnObjectiveCompleted.AddDynamic(this, &UNerveQuestSubsystem::OnOptionalObjectiveCompleted);
 	OptionalRuntimeData->OnObjectiveFailed.AddDynamic(this, &UNerveQuestSubsystem::OnOptionalObjectiveFailed);
 
-	OptionalRuntimeData->ParentObjective->SetWorldContextObject(GetWorld());
-	// Execute objective
+	// Execute objective; its run takes the subsystem's world context
 	OptionalRuntimeData->ExecuteObjective(ParentQuest->QuestAsset);
 
 	// Mark as tracked if parent quest is tracked
@@ -402,17 +747,16 @@ void UNerveQuestSubsystem::StopOptionalObjective(UNerveQuestRuntimeData* ParentQ
 	if (ActiveOptionalObjectives.Contains(ParentQuest))
 	{
 		FOptionalObjectiveDataArray& OptionalDataArray = ActiveOptionalObjectives[ParentQuest];
+		bool bRemoved = false;
 		for (int32 i = 0; i < OptionalDataArray.ObjectiveData.Num(); ++i)
 		{
 			if (OptionalDataArray.ObjectiveData[i].OptionalObjective == OptionalObjective)
 			{
 				// Unbind events
-				if (IsValid(OptionalObjective->ParentObjective))
-				{
-					OptionalObjective->ParentObjective->OnObjectiveCompleted.RemoveDynamic(this, &UNerveQuestSubsystem::OnOptionalObjectiveCompleted);
-					OptionalObjective->ParentObjective->OnObjectiveFailed.RemoveDynamic(this, &UNerveQuestSubsystem::OnOptionalObjectiveFailed);
-				}
+				OptionalObjective->OnObjectiveCompleted.RemoveDynamic(this, &UNerveQuestSubsystem::OnOptionalObjectiveCompleted);
+				OptionalObjective->OnObjectiveFailed.RemoveDynamic(this, &UNerveQuestSubsystem::OnOptionalObjectiveFailed);
 				OptionalDataArray.ObjectiveData.RemoveAt(i);
+				bRemoved = true;
 				break;
 			}
 		}
@@ -423,6 +767,13 @@ void UNerveQuestSubsystem::StopOptionalObjective(UNerveQuestRuntimeData* ParentQ
 			ActiveOptionalObjectives.Remove(ParentQuest);
 		}
 
+		// Hand the runtime data back for the next optional objective
+		if (bRemoved)
+		{
+			OptionalObjective->Uninitialize();
+			ReleaseObjectiveRuntimeData(OptionalObjective);
+		}
+
 		// Refresh UI if tracked
 		if (ParentQuest->bIsTracked)
 		{
@@ -485,18 +836,73 @@ void UNerveQuestSubsystem::RefreshQuestUI(UNerveQuestRuntimeData* QuestData)
 TArray<UNerveObjectiveRuntimeData*> UNerveQuestSubsystem::GetDisplayableObjectives(UNerveQuestRuntimeData* QuestData) const
 {
 	TArray<UNerveObjectiveRuntimeData*> DisplayableObjectives;
+	ForEachDisplayableObjective(QuestData, [&DisplayableObjectives](UNerveObjectiveRuntimeData* Objective)
+	{
+		DisplayableObjectives.Add(Objective);
+	});
+	return DisplayableObjectives;
+}
 
+void UNerveQuestSubsystem::ForEachDisplayableObjective(const UNerveQuestRuntimeData* QuestData, const TFunctionRef<void(UNerveObjectiveRuntimeData*)> Visitor) const
+{
 	// Validate input
-	if (!IsValid(QuestData)) return DisplayableObjectives;
+	if (!IsValid(QuestData)) return;
+
+	// The main objective of every branch, if visible
+	QuestData->ForEachRunningObjective([&Visitor](UNerveObjectiveRuntimeData* Objective)
+	{
+		if (IsValid(Objective->ParentObjective) && Objective->ParentObjective->GetShowInUI())
+		{
+			Visitor(Objective);
+		}
+	});
+}
+
+void UNerveQuestSubsystem::GetJournalItems(TArray<UNerveQuestJournalItem*>& OutItems, const bool bFilterByCategory, const ENerveQuestCategory QuestCategory)
+{
+	OutItems.Reset(QuestRuntimeDataMap.Num());
+
+	for (const auto& Pair : QuestRuntimeDataMap)
+	{
+		UNerveQuestRuntimeData* QuestData = Pair.Value;
+		if (!IsValid(QuestData)) continue;
+		if (bFilterByCategory && QuestData->QuestStatus != QuestCategory) continue;
+
+		if (UNerveQuestJournalItem* Item = FindOrAddJournalItem(QuestData))
+		{
+			OutItems.Add(Item);
+		}
+	}
+}
+
+UNerveQuestJournalItem* UNerveQuestSubsystem::GetJournalItemForQuest(const UNerveQuestAsset* QuestAsset)
+{
+	UNerveQuestRuntimeData* QuestData = GetQuestRuntimeData(QuestAsset);
+	return IsValid(QuestData) ? FindOrAddJournalItem(QuestData) : nullptr;
+}
+
+UNerveQuestJournalItem* UNerveQuestSubsystem::FindOrAddJournalItem(UNerveQuestRuntimeData* QuestData)
+{
+	if (!IsValid(QuestData)) return nullptr;
 
-	// Add main objective if visible
-	if (IsValid(QuestData->CurrentObjective) && IsValid(QuestData->CurrentObjective->ParentObjective) &&
-		QuestData->CurrentObjective->ParentObjective->GetShowInUI())
+	if (UNerveQuestJournalItem* ExistingItem = JournalItems.FindRef(QuestData))
 	{
-		DisplayableObjectives.Add(QuestData->CurrentObjective);
+		return ExistingItem;
 	}
 
-	return DisplayableObjectives;
+	UNerveQuestJournalItem* NewItem = NewObject<UNerveQuestJournalItem>(this);
+	NewItem->Initialize(QuestData);
+	JournalItems.Add(QuestData, NewItem);
+	return NewItem;
+}
+
+void UNerveQuestSubsystem::RemoveJournalItem(UNerveQuestRuntimeData* QuestData)
+{
+	TObjectPtr<UNerveQuestJournalItem> RemovedItem;
+	if (JournalItems.RemoveAndCopyValue(QuestData, RemovedItem) && IsValid(RemovedItem))
+	{
+		RemovedItem->Uninitialize();
+	}
 }
 
 bool UNerveQuestSubsystem::RegisterToReceiveEventFromObjective(UObject* RegisteringObject)
@@ -634,29 +1040,173 @@ void UNerveQuestSubsystem::BroadcastToTagReceivers(UNerveQuestAsset* QuestAsset,
 	}
 }
 
-UNerveQuestRuntimeData* UNerveQuestSubsystem::GetQuestRuntimeData(const UNerveQuestAsset* QuestAsset) const
+UNerveQuestRuntimeData* UNerveQuestSubsystem::AcquireQuestRuntimeData()
 {
-	return QuestRuntimeDataMap.FindRef(QuestAsset);
+	if (!PooledQuestRuntimeData.IsEmpty())
+	{
+		UNerveQuestRuntimeData* QuestData = PooledQuestRuntimeData.Pop();
+		QuestData->SetPooled(false);
+		QuestRuntimeDataPoolStats.NumReused++;
+		QuestRuntimeDataPoolStats.NumPooled = PooledQuestRuntimeData.Num();
+		return QuestData;
+	}
+
+	QuestRuntimeDataPoolStats.NumCreated++;
+	return NewObject<UNerveQuestRuntimeData>(this);
 }
 
-bool UNerveQuestSubsystem::AddQuestData(UNerveQuestAsset* NewDataKey, UNerveQuestRuntimeData* NewDataValue)
+void UNerveQuestSubsystem::ReleaseQuestRuntimeData(UNerveQuestRuntimeData* QuestData)
 {
-	// Validate inputs
-	if (!IsValid(NewDataKey) || !IsValid(NewDataValue))
-	{
-		UE_LOG(LogTemp, Warning, TEXT("AddQuestData: Invalid inputs"));
-		return false;
-	}
+	if (!IsValid(QuestData) || QuestData->IsPooled()) return;
 
-	// Check for existing data
-	if (QuestRuntimeDataMap.Contains(NewDataKey))
+	// Drop every reference the subsystem still holds, a pooled instance must be unreachable from game code
+	TrackedSubQuests.Remove(QuestData);
+	if (CurrentlyTrackedQuest == QuestData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AddQuestData: Quest already exists"));
-		return false;
+		CurrentlyTrackedQuest = nullptr;
 	}
+	RemoveJournalItem(QuestData);
 
-	// Add data
-	QuestRuntimeDataMap.Add(NewDataKey, NewDataValue);
+	FOptionalObjectiveDataArray Optionals;
+	if (ActiveOptionalObjectives.RemoveAndCopyValue(QuestData, Optionals))
+	{
+		for (const FOptionalObjectiveData& Data : Optionals.ObjectiveData)
+		{
+			if (IsValid(Data.OptionalObjective))
+			{
+				Data.OptionalObjective->Uninitialize();
+				ReleaseObjectiveRuntimeData(Data.OptionalObjective);
+			}
+		}
+	}
+
+	QuestData->ResetForReuse();
+	QuestRuntimeDataPoolStats.NumReleased++;
+
+	const int32 MaxPooled = IsValid(QuestRuntimeSetting) ? QuestRuntimeSetting->MaxPooledQuestRuntimeData : 0;
+	if (PooledQuestRuntimeData.Num() >= MaxPooled)
+	{
+		QuestRuntimeDataPoolStats.NumDiscarded++;
+		QuestData->ConditionalBeginDestroy();
+		return;
+	}
+
+	QuestData->SetPooled(true);
+	PooledQuestRuntimeData.Add(QuestData);
+	QuestRuntimeDataPoolStats.NumPooled = PooledQuestRuntimeData.Num();
+	QuestRuntimeDataPoolStats.PeakPooled = FMath::Max(QuestRuntimeDataPoolStats.PeakPooled, QuestRuntimeDataPoolStats.NumPooled);
+}
+
+UNerveObjectiveRuntimeData* UNerveQuestSubsystem::AcquireObjectiveRuntimeData()
+{
+	if (!PooledObjectiveRuntimeData.IsEmpty())
+	{
+		UNerveObjectiveRuntimeData* ObjectiveData = PooledObjectiveRuntimeData.Pop();
+		ObjectiveData->SetPooled(false);
+		ObjectiveData->SetLiveIndex(LiveObjectiveRuntimeData.Add(ObjectiveData));
+		ObjectiveRuntimeDataPoolStats.NumReused++;
+		ObjectiveRuntimeDataPoolStats.NumPooled = PooledObjectiveRuntimeData.Num();
+		return ObjectiveData;
+	}
+
+	UNerveObjectiveRuntimeData* ObjectiveData = NewObject<UNerveObjectiveRuntimeData>(this);
+	ObjectiveData->SetLiveIndex(LiveObjectiveRuntimeData.Add(ObjectiveData));
+	ObjectiveRuntimeDataPoolStats.NumCreated++;
+	return ObjectiveData;
+}
+
+void UNerveQuestSubsystem::ReleaseObjectiveRuntimeData(UNerveObjectiveRuntimeData* ObjectiveData)
+{
+	if (!IsValid(ObjectiveData) || ObjectiveData->IsPooled()) return;
+
+	DisplayedObjectives.Remove(ObjectiveData);
+
+	// Swap the last live objective into the freed slot
+	const int32 LiveIndex = ObjectiveData->GetLiveIndex();
+	if (LiveObjectiveRuntimeData.IsValidIndex(LiveIndex) && LiveObjectiveRuntimeData[LiveIndex] == ObjectiveData)
+	{
+		LiveObjectiveRuntimeData.RemoveAtSwap(LiveIndex);
+		if (LiveObjectiveRuntimeData.IsValidIndex(LiveIndex) && LiveObjectiveRuntimeData[LiveIndex])
+		{
+			LiveObjectiveRuntimeData[LiveIndex]->SetLiveIndex(LiveIndex);
+		}
+	}
+
+	ObjectiveData->ResetForReuse();
+	ObjectiveRuntimeDataPoolStats.NumReleased++;
+
+	const int32 MaxPooled = IsValid(QuestRuntimeSetting) ? QuestRuntimeSetting->MaxPooledObjectiveRuntimeData : 0;
+	if (PooledObjectiveRuntimeData.Num() >= MaxPooled)
+	{
+		ObjectiveRuntimeDataPoolStats.NumDiscarded++;
+		ObjectiveData->ConditionalBeginDestroy();
+		return;
+	}
+
+	ObjectiveData->SetPooled(true);
+	PooledObjectiveRuntimeData.Add(ObjectiveData);
+	ObjectiveRuntimeDataPoolStats.NumPooled = PooledObjectiveRuntimeData.Num();
+	ObjectiveRuntimeDataPoolStats.PeakPooled = FMath::Max(ObjectiveRuntimeDataPoolStats.PeakPooled, ObjectiveRuntimeDataPoolStats.NumPooled);
+}
+
+void UNerveQuestSubsystem::TrimRuntimeDataPools()
+{
+	PooledQuestRuntimeData.Empty();
+	PooledObjectiveRuntimeData.Empty();
+	QuestRuntimeDataPoolStats.NumPooled = 0;
+	ObjectiveRuntimeDataPoolStats.NumPooled = 0;
+}
+
+void UNerveQuestSubsystem::QueueProgressDelivery(UNerveObjectiveRuntimeData* Objective)
+{
+	if (!IsValid(Objective)) return;
+	PendingProgressObjectives.Add(Objective);
+}
+
+void UNerveQuestSubsystem::FlushPendingProgress()
+{
+	if (PendingProgressObjectives.IsEmpty()) return;
+
+	const float MinDeliveryDelta = IsValid(QuestRuntimeSetting) ? QuestRuntimeSetting->MinProgressDeliveryDelta : 0.0f;
+
+	// Swap out first so deliveries that queue new progress land in the next frame
+	TArray<TWeakObjectPtr<UNerveObjectiveRuntimeData>> ObjectivesToDeliver = MoveTemp(PendingProgressObjectives);
+	PendingProgressObjectives.Reset();
+
+	for (const TWeakObjectPtr<UNerveObjectiveRuntimeData>& WeakObjective : ObjectivesToDeliver)
+	{
+		UNerveObjectiveRuntimeData* Objective = WeakObjective.Get();
+		if (Objective && Objective->DeliverPendingProgress(MinDeliveryDelta))
+		{
+			// Held back as too small; kept queued so it is still shown if progress stalls there
+			PendingProgressObjectives.Add(Objective);
+		}
+	}
+}
+
+UNerveQuestRuntimeData* UNerveQuestSubsystem::GetQuestRuntimeData(const UNerveQuestAsset* QuestAsset) const
+{
+	return QuestRuntimeDataMap.FindRef(QuestAsset);
+}
+
+bool UNerveQuestSubsystem::AddQuestData(UNerveQuestAsset* NewDataKey, UNerveQuestRuntimeData* NewDataValue)
+{
+	// Validate inputs
+	if (!IsValid(NewDataKey) || !IsValid(NewDataValue))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AddQuestData: Invalid inputs"));
+		return false;
+	}
+
+	// Check for existing data
+	if (QuestRuntimeDataMap.Contains(NewDataKey))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AddQuestData: Quest already exists"));
+		return false;
+	}
+
+	// Add data
+	QuestRuntimeDataMap.Add(NewDataKey, NewDataValue);
 	
 	UE_LOG(LogTemp, Log, TEXT("AddQuestData: Added data for quest %s"), *NewDataKey->GetName());
 	return true;
@@ -703,7 +1253,7 @@ UNerveQuestRuntimeData* UNerveQuestSubsystem::CreateSubQuestRuntimeData(UNerveQu
 	}
 
 	// Create runtime data
-	UNerveQuestRuntimeData* SubQuestRuntimeData = NewObject<UNerveQuestRuntimeData>(this);
+	UNerveQuestRuntimeData* SubQuestRuntimeData = AcquireQuestRuntimeData();
 	if (!IsValid(SubQuestRuntimeData))
 	{
 		UE_LOG(LogTemp, Error, TEXT("CreateSubQuestRuntimeData: Failed to create runtime data"));
@@ -721,12 +1271,7 @@ bool UNerveQuestSubsystem::AreAllObjectiveCompleted(UNerveQuestRuntimeData* Ques
 {
 	if (!IsValid(Quest)) return false;
 
-	for (const auto Element : Quest->GetAllObjectives())
-	{
-		if (!Element->bIsCompleted) return false;
-	}
-
-	return true;
+	return Quest->AreAllObjectivesCompleted();
 }
 
 bool UNerveQuestSubsystem::IsQuestRegistered(const UNerveQuestAsset* QuestAsset) const
@@ -736,15 +1281,7 @@ bool UNerveQuestSubsystem::IsQuestRegistered(const UNerveQuestAsset* QuestAsset)
 
 TArray<UNerveQuestAsset*> UNerveQuestSubsystem::GetAllRegisteredQuests() const
 {
-	TArray<UNerveQuestAsset*> RegisteredQuests;
-	for (const auto& Pair : QuestRuntimeDataMap)
-	{
-		if (UNerveQuestAsset* QuestAsset = Pair.Key.Get())
-		{
-			RegisteredQuests.Add(QuestAsset);
-		}
-	}
-	return RegisteredQuests;
+	return GetAllQuestAssets();
 }
 
 void UNerveQuestSubsystem::TrackSubQuest(UNerveQuestRuntimeData* SubQuestData, bool bShowInMainUI)
@@ -796,21 +1333,24 @@ void UNerveQuestSubsystem::UntrackSubQuest(UNerveQuestRuntimeData* SubQuestData)
 TArray<UNerveQuestRuntimeData*> UNerveQuestSubsystem::GetActiveSubQuests() const
 {
 	TArray<UNerveQuestRuntimeData*> ActiveSubQuests;
-	
-	// Extract valid quest runtime data from the map
+	ForEachActiveSubQuest([&ActiveSubQuests](UNerveQuestRuntimeData* SubQuest)
+	{
+		ActiveSubQuests.Add(SubQuest);
+	});
+	return ActiveSubQuests;
+}
+
+void UNerveQuestSubsystem::ForEachActiveSubQuest(const TFunctionRef<void(UNerveQuestRuntimeData*)> Visitor) const
+{
 	for (const auto& Pair : TrackedSubQuests)
 	{
-		if (UNerveQuestRuntimeData* SubQuest = Pair.Key.Get())
+		// Filter out completed quests
+		UNerveQuestRuntimeData* SubQuest = Pair.Key.Get();
+		if (IsValid(SubQuest) && !SubQuest->GetIsCompleted())
 		{
-			// Filter out completed quests
-			if (IsValid(SubQuest) && !SubQuest->GetIsCompleted())
-			{
-				ActiveSubQuests.Add(SubQuest);
-			}
+			Visitor(SubQuest);
 		}
 	}
-	
-	return ActiveSubQuests;
 }
 
 void UNerveQuestSubsystem::SetCurrentlyTrackedQuest(UNerveQuestRuntimeData* NewCurrentTrackedQuest)
@@ -821,6 +1361,7 @@ void UNerveQuestSubsystem::SetCurrentlyTrackedQuest(UNerveQuestRuntimeData* NewC
 TArray<UNerveQuestAsset*> UNerveQuestSubsystem::GetAllQuestAssets() const
 {
 	TArray<UNerveQuestAsset*> QuestAssets;
+	QuestAssets.Reserve(QuestRuntimeDataMap.Num());
 	for (const auto& Pair : QuestRuntimeDataMap)
 	{
 		if (UNerveQuestAsset* QuestAsset = Pair.Key.Get())
@@ -834,6 +1375,7 @@ TArray<UNerveQuestAsset*> UNerveQuestSubsystem::GetAllQuestAssets() const
 TArray<UNerveQuestRuntimeData*> UNerveQuestSubsystem::GetAllQuestRuntimeData() const
 {
 	TArray<UNerveQuestRuntimeData*> RuntimeData;
+	RuntimeData.Reserve(QuestRuntimeDataMap.Num());
 	for (const auto& Pair : QuestRuntimeDataMap)
 	{
 		if (UNerveQuestRuntimeData* Data = Pair.Value.Get())
@@ -844,42 +1386,58 @@ TArray<UNerveQuestRuntimeData*> UNerveQuestSubsystem::GetAllQuestRuntimeData() c
 	return RuntimeData;
 }
 
-FOptionalObjectiveDataArray UNerveQuestSubsystem::GetAllOptionalObjectiveDataForQuest(const UNerveQuestRuntimeData* ParentQuest)
+void UNerveQuestSubsystem::ForEachQuest(const TFunctionRef<void(UNerveQuestAsset*, UNerveQuestRuntimeData*)> Visitor) const
 {
-	FOptionalObjectiveDataArray* NewOptionalObjectiveDataArray = nullptr;
-	
-	// Validate inputs
-	if (!IsValid(ParentQuest)) return *NewOptionalObjectiveDataArray;
-
-	// Find matching objective
-	if (ActiveOptionalObjectives.Contains(ParentQuest))
+	for (const auto& Pair : QuestRuntimeDataMap)
 	{
-		NewOptionalObjectiveDataArray = &ActiveOptionalObjectives[ParentQuest];
+		UNerveQuestAsset* QuestAsset = Pair.Key.Get();
+		UNerveQuestRuntimeData* QuestData = Pair.Value.Get();
+		if (IsValid(QuestAsset) && IsValid(QuestData))
+		{
+			Visitor(QuestAsset, QuestData);
+		}
 	}
-	
-	return *NewOptionalObjectiveDataArray;
+}
+
+FOptionalObjectiveDataArray UNerveQuestSubsystem::GetAllOptionalObjectiveDataForQuest(const UNerveQuestRuntimeData* ParentQuest) const
+{
+	const FOptionalObjectiveDataArray* OptionalDataArray = FindOptionalObjectiveData(ParentQuest);
+	return OptionalDataArray ? *OptionalDataArray : FOptionalObjectiveDataArray();
+}
+
+const FOptionalObjectiveDataArray* UNerveQuestSubsystem::FindOptionalObjectiveData(const UNerveQuestRuntimeData* ParentQuest) const
+{
+	// Validate inputs
+	if (!IsValid(ParentQuest)) return nullptr;
+
+	return ActiveOptionalObjectives.Find(ParentQuest);
 }
 
 TArray<UNerveObjectiveRuntimeData*> UNerveQuestSubsystem::GetAllOptionalObjectiveForQuest(const UNerveQuestRuntimeData* ParentQuest,
-const UNerveObjectiveRuntimeData* OptionalObjective)
+const UNerveObjectiveRuntimeData* OptionalObjective) const
 {
 	TArray<UNerveObjectiveRuntimeData*> AllOptionalObjectiveDataArray;
-	
-	if (!IsValid(ParentQuest) || !IsValid(OptionalObjective)) return AllOptionalObjectiveDataArray;
+	ForEachOptionalObjective(ParentQuest, OptionalObjective, [&AllOptionalObjectiveDataArray](UNerveObjectiveRuntimeData* Optional)
+	{
+		AllOptionalObjectiveDataArray.Add(Optional);
+	});
+	return AllOptionalObjectiveDataArray;
+}
 
-	// Find matching objective
-	if (ActiveOptionalObjectives.Contains(ParentQuest))
+void UNerveQuestSubsystem::ForEachOptionalObjective(const UNerveQuestRuntimeData* ParentQuest, const UNerveObjectiveRuntimeData* ParentObjective,
+const TFunctionRef<void(UNerveObjectiveRuntimeData*)> Visitor) const
+{
+	if (!IsValid(ParentObjective)) return;
+
+	const FOptionalObjectiveDataArray* OptionalDataArray = FindOptionalObjectiveData(ParentQuest);
+	if (!OptionalDataArray) return;
+
+	for (const FOptionalObjectiveData& OptData : OptionalDataArray->ObjectiveData)
 	{
-		FOptionalObjectiveDataArray& OptionalDataArray = ActiveOptionalObjectives[ParentQuest];
-		for (FOptionalObjectiveData& OptData : OptionalDataArray.ObjectiveData)
-		{
-			if (OptData.ParentObjective != OptionalObjective) continue;
+		if (OptData.ParentObjective != ParentObjective) continue;
 
-			AllOptionalObjectiveDataArray.Add(OptData.OptionalObjective);
-		}
+		Visitor(OptData.OptionalObjective);
 	}
-
-	return AllOptionalObjectiveDataArray;
 }
 
 TArray<UNerveQuestAsset*> UNerveQuestSubsystem::GetQuestOfCategory(const ENerveQuestCategory QuestCategory)
@@ -933,23 +1491,15 @@ bool UNerveQuestSubsystem::GetNextObjectiveForQuest(const UNerveQuestAsset* Ques
 		return false;
 	}
 
-	// Check objectives
-	if (QuestRuntimeData->GetAllObjectives().IsEmpty())
+	// Find first incomplete objective
+	UNerveObjectiveRuntimeData* Objective = QuestRuntimeData->FindFirstIncompleteObjective();
+	if (!IsValid(Objective))
 	{
 		return false;
 	}
 
-	// Find first incomplete objective
-	for (UNerveObjectiveRuntimeData* Objective : QuestRuntimeData->GetAllObjectives())
-	{
-		if (!Objective->bIsCompleted)
-		{
-			OutObjectiveRuntimeData = Objective;
-			return true;
-		}
-	}
-	
-	return false;
+	OutObjectiveRuntimeData = Objective;
+	return true;
 }
 
 bool UNerveQuestSubsystem::GetCurrentObjectiveForQuest(const UNerveQuestAsset* QuestAsset, UNerveObjectiveRuntimeData*& OutObjectiveRuntimeData)
@@ -982,12 +1532,13 @@ void UNerveQuestSubsystem::QuestCompleted(UNerveQuestRuntimeData* Quest)
 
 void UNerveQuestSubsystem::OnOptionalObjectiveCompleted(UNerveQuestRuntimeObjectiveBase* OptionalObjective)
 {
-	// Find matching objective
+	// Find matching objective; quests sharing a graph share the node, so match the run that just completed
 	for (auto& QuestOptionals : ActiveOptionalObjectives)
 	{
 		for (FOptionalObjectiveData& OptData : QuestOptionals.Value.ObjectiveData)
 		{
-			if (IsValid(OptData.OptionalObjective) && OptData.OptionalObjective->ParentObjective == OptionalObjective)
+			if (IsValid(OptData.OptionalObjective) && OptData.OptionalObjective->ParentObjective == OptionalObjective &&
+				OptData.OptionalObjective->GetIsCompleted() && !OptData.bIsCompleted)
 			{
 				OptData.bIsCompleted = true;
 				ProcessOptionalObjectiveCompletion(OptData);
@@ -1002,12 +1553,13 @@ void UNerveQuestSubsystem::OnOptionalObjectiveCompleted(UNerveQuestRuntimeObject
 
 void UNerveQuestSubsystem::OnOptionalObjectiveFailed(UNerveQuestRuntimeObjectiveBase* OptionalObjective)
 {
-	// Find matching objective
+	// Find matching objective; quests sharing a graph share the node, so match the run that just failed
 	for (auto& QuestOptionals : ActiveOptionalObjectives)
 	{
 		for (FOptionalObjectiveData& OptData : QuestOptionals.Value.ObjectiveData)
 		{
-			if (IsValid(OptData.OptionalObjective) && OptData.OptionalObjective->ParentObjective == OptionalObjective)
+			if (IsValid(OptData.OptionalObjective) && OptData.OptionalObjective->ParentObjective == OptionalObjective &&
+				OptData.OptionalObjective->GetIsFailed() && !OptData.bHasFailed)
 			{
 				OptData.bHasFailed = true;
 
@@ -1040,16 +1592,16 @@ void UNerveQuestSubsystem::ProcessOptionalObjectiveCompletion(const FOptionalObj
 	case EOptionalObjectiveResponse::CompleteParent:
 		if (IsValid(OptionalData.ParentObjective))
 		{
-			OptionalData.ParentObjective->ParentObjective->OnObjectiveCompleted.Broadcast(OptionalData.ParentObjective->ParentObjective);
+			OptionalData.ParentObjective->ForceComplete();
 		}
 		break;
 	case EOptionalObjectiveResponse::AdvanceParent:
 		// Find and advance parent quest
 		for (auto& QuestData : QuestRuntimeDataMap)
 		{
-			if (QuestData.Value->CurrentObjective == OptionalData.ParentObjective)
+			if (QuestData.Value->IsObjectiveRunning(OptionalData.ParentObjective))
 			{
-				QuestData.Value->AdvanceToNextObjective();
+				QuestData.Value->AdvanceFromObjective(OptionalData.ParentObjective);
 				break;
 			}
 		}
@@ -1117,9 +1669,9 @@ UNerveObjectiveRuntimeData* UNerveQuestSubsystem::FindEntryByObjective(UNerveQue
 	}
 
 	// Find entry objective
-	for (UNerveObjectiveRuntimeData* Objective : Quest->GetAllObjectives())
+	for (UNerveObjectiveRuntimeData* Objective : Quest->GetObjectiveView())
 	{
-		if (IsValid(Objective->ParentObjective) && Objective->ParentObjective->GetClass() == UNerveEntryObjective::StaticClass())
+		if (IsValid(Objective) && IsValid(Objective->ParentObjective) && Objective->ParentObjective->GetClass() == UNerveEntryObjective::StaticClass())
 		{
 			return Objective;
 		}
@@ -1145,17 +1697,33 @@ void UNerveQuestRuntimeData::Initialize(UNerveQuestAsset* InQuestAsset, UNerveQu
 			AccumulateObjectives(EntryObjective);
 		}
 	}
+	RebuildObjectiveStates();
+	CompileJoins();
 	
 	UE_LOG(LogTemp, Log, TEXT("Initialize: Initialized quest %s"), *InQuestAsset->QuestTitle);
 }
 
 void UNerveQuestRuntimeData::Uninitialize()
 {
-	for (auto Element : AllNerveObjectiveRuntimeData)
+	for (auto Element : State.Objectives)
 	{
-		Element->Uninitialize();
+		// Branches that already ended were uninitialized by EndBranch or CancelBranches
+		if (!Element->IsEnded())
+		{
+			Element->Uninitialize();
+		}
+		if (IsValid(QuestHandlerSubSystem))
+		{
+			QuestHandlerSubSystem->ReleaseObjectiveRuntimeData(Element);
+		}
 	}
 	ClearObjectives();
+	ResetBranches();
+	State.Joins.Reset();
+	CurrentObjective = nullptr;
+	ReleaseTimerScope();
+	State.bIsPaused = false;
+	State.bObjectivesPaused = false;
 	
 	QuestAsset = nullptr;
 	QuestHandlerSubSystem = nullptr;
@@ -1166,7 +1734,7 @@ void UNerveQuestRuntimeData::Uninitialize()
 void UNerveQuestRuntimeData::BeginDestroy()
 {
 	// Ensure cleanup happens even if Uninitialize wasn't called
-	if (IsValid(QuestHandlerSubSystem) || AllNerveObjectiveRuntimeData.Num() > 0)
+	if (IsValid(QuestHandlerSubSystem) || State.Objectives.Num() > 0)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("BeginDestroy: Quest runtime data not properly uninitialized, performing emergency cleanup"));
 		Uninitialize();
@@ -1175,6 +1743,35 @@ void UNerveQuestRuntimeData::BeginDestroy()
 	Super::BeginDestroy();
 }
 
+void UNerveQuestRuntimeData::ResetForReuse()
+{
+	QuestAsset = nullptr;
+	CurrentObjective = nullptr;
+	bIsTracked = false;
+	OverallProgress = 0.0f;
+	QuestStatus = ENerveQuestCategory::Available;
+	bIsCompleted = false;
+
+	OnQuestCompleted.Clear();
+	OnQuestFailed.Clear();
+	OnQuestProgressChanged.Clear();
+	OnQuestStatusChanged.Clear();
+	OnQuestTrackingChanged.Clear();
+	OnQuestFinishedNative.Unbind();
+
+	State.Objectives.Reset();
+	RebuildObjectiveStates();
+	ResetBranches();
+	State.Joins.Reset();
+	QuestHandlerSubSystem = nullptr;
+	State.bIsPaused = false;
+	State.bObjectivesPaused = false;
+	State.TimeDilation = 1.0f;
+
+	// References kept to the previous quest can tell it is gone
+	++State.Serial;
+}
+
 bool UNerveQuestRuntimeData::AddObjective(UNerveObjectiveRuntimeData* Objective)
 {
 	// Validate input
@@ -1185,7 +1782,8 @@ bool UNerveQuestRuntimeData::AddObjective(UNerveObjectiveRuntimeData* Objective)
 	}
 
 	// Add objective
-	AllNerveObjectiveRuntimeData.Add(Objective);
+	State.Objectives.Add(Objective);
+	RebuildObjectiveStates();
 	
 	UE_LOG(LogTemp, Log, TEXT("AddObjective: Added objective to quest %s"), *QuestAsset->QuestTitle);
 	return true;
@@ -1201,7 +1799,9 @@ bool UNerveQuestRuntimeData::RemoveObjective(UNerveObjectiveRuntimeData* Objecti
 	}
 
 	// Remove objective
-	AllNerveObjectiveRuntimeData.Remove(Objective);
+	State.Objectives.Remove(Objective);
+	Objective->SetQuestIndex(INDEX_NONE);
+	RebuildObjectiveStates();
 	
 	UE_LOG(LogTemp, Log, TEXT("RemoveObjective: Removed objective from quest %s"), *QuestAsset->QuestTitle);
 	return true;
@@ -1209,14 +1809,15 @@ bool UNerveQuestRuntimeData::RemoveObjective(UNerveObjectiveRuntimeData* Objecti
 
 void UNerveQuestRuntimeData::ClearObjectives()
 {
-	AllNerveObjectiveRuntimeData.Empty();
+	State.Objectives.Empty();
+	RebuildObjectiveStates();
 	UE_LOG(LogTemp, Log, TEXT("ClearObjectives: Cleared all objectives for quest %s"), *QuestAsset->QuestTitle);
 }
 
 void UNerveQuestRuntimeData::StartQuest()
 {
 	// Validate objectives
-	if (GetAllObjectives().IsEmpty())
+	if (State.Objectives.IsEmpty())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("StartQuest: No objectives found for quest %s"), *QuestAsset->QuestTitle);
 		return;
@@ -1230,42 +1831,27 @@ void UNerveQuestRuntimeData::StartQuest()
 		return;
 	}
 
-	// Set initial objective
-	if (!IsValid(CurrentObjective))
-	{
-		CurrentObjective = GetAllObjectives()[0];
-	}
-
-	if (!IsValid(CurrentObjective))
-	{
-		UE_LOG(LogTemp, Warning, TEXT("StartQuest: No valid entry objective for quest %s"), *QuestAsset->QuestTitle);
-		return;
-	}
-	
-	// Validate parent objective exists
-	if (!IsValid(CurrentObjective->ParentObjective))
+	// Resume at a preset current objective, otherwise leave the entry node, which may lead into a fork
+	UNerveQuestRuntimePin* EntryNodePin = nullptr;
+	if (IsValid(CurrentObjective))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("StartQuest: Current objective has no valid parent for quest %s"), *QuestAsset->QuestTitle);
-		return;
-	}
+		// Validate parent objective and input pin exist
+		if (!IsValid(CurrentObjective->ParentObjective) || !IsValid(CurrentObjective->ParentObjective->InputPin))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("StartQuest: Current objective has no valid parent or input pin for quest %s"), *QuestAsset->QuestTitle);
+			return;
+		}
 
-	// Validate input pin exists
-	if (!IsValid(CurrentObjective->ParentObjective->InputPin))
-	{
-		UE_LOG(LogTemp, Warning, TEXT("StartQuest: Current objective has no input pin for quest %s"), *QuestAsset->QuestTitle);
-		return;
+		// Get the pin connected to current objective's input
+		TArray<UNerveQuestRuntimePin*> InputConnections = CurrentObjective->ParentObjective->InputPin->GetValidConnections();
+		EntryNodePin = InputConnections.IsEmpty() ? nullptr : InputConnections[0];
 	}
-
-	// Get valid connections from input pin
-	TArray<UNerveQuestRuntimePin*> InputConnections = CurrentObjective->ParentObjective->InputPin->GetValidConnections();
-	if (InputConnections.IsEmpty())
+	else if (!QuestAsset->GetQuestObjectives().IsEmpty() && IsValid(QuestAsset->GetQuestObjectives()[0]))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("StartQuest: Current objective input pin has no valid connections for quest %s"), *QuestAsset->QuestTitle);
-		return;
+		const UNerveQuestRuntimeObjectiveBase* EntryObjective = QuestAsset->GetQuestObjectives()[0];
+		EntryNodePin = EntryObjective->OutPutPin.IsValidIndex(0) ? EntryObjective->OutPutPin[0].Get() : nullptr;
 	}
 
-	// Get the entry node pin (what's connected to current objective's input)
-	UNerveQuestRuntimePin* EntryNodePin = InputConnections[0];
 	if (!IsValid(EntryNodePin))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("StartQuest: Invalid entry node pin for quest %s"), *QuestAsset->QuestTitle);
@@ -1273,8 +1859,10 @@ void UNerveQuestRuntimeData::StartQuest()
 	}
 
 	// Broadcast start event
+	SetQuestStatus(ENerveQuestCategory::InProgress);
 	QuestHandlerSubSystem->BroadcastToEventReceivers(QuestAsset, EQuestObjectiveEventType::QuestStarted);
-	ExecuteObjectiveFromPin(EntryNodePin);
+	ResetBranches();
+	MoveBranch(AddBranch(), EntryNodePin);
 	
 	UE_LOG(LogTemp, Log, TEXT("StartQuest: Started quest %s"), *QuestAsset->QuestTitle);
 }
@@ -1291,6 +1879,14 @@ void UNerveQuestRuntimeData::TrackQuest()
 	// Update tracking state
 	bIsTracked = true;
 	CurrentObjective->MarkAsTracked(bIsTracked);
+	for (const FNerveQuestBranch& Branch : State.Branches)
+	{
+		if (IsValid(Branch.Objective) && Branch.Objective != CurrentObjective)
+		{
+			Branch.Objective->MarkAsTracked(bIsTracked);
+		}
+	}
+	OnQuestTrackingChanged.Broadcast(this);
 	
 	UE_LOG(LogTemp, Log, TEXT("TrackQuest: Tracking quest %s"), *QuestAsset->QuestTitle);
 }
@@ -1307,6 +1903,14 @@ void UNerveQuestRuntimeData::UntrackQuest()
 	// Update tracking state
 	bIsTracked = false;
 	CurrentObjective->MarkAsTracked(bIsTracked);
+	for (const FNerveQuestBranch& Branch : State.Branches)
+	{
+		if (IsValid(Branch.Objective) && Branch.Objective != CurrentObjective)
+		{
+			Branch.Objective->MarkAsTracked(bIsTracked);
+		}
+	}
+	OnQuestTrackingChanged.Broadcast(this);
 	
 	UE_LOG(LogTemp, Log, TEXT("UntrackQuest: Untracked quest %s"), *QuestAsset->QuestTitle);
 }
@@ -1345,14 +1949,24 @@ void UNerveQuestRuntimeData::StopAllOptionalObjectives()
 		FOptionalObjectiveDataArray& OptionalDataArray = QuestHandlerSubSystem->GetAllActiveOptionalObjectives()[this];
 		for (FOptionalObjectiveData& OptData : OptionalDataArray.ObjectiveData)
 		{
-			if (IsValid(OptData.OptionalObjective) && IsValid(OptData.OptionalObjective->ParentObjective))
+			if (IsValid(OptData.OptionalObjective))
 			{
-				OptData.OptionalObjective->ParentObjective->OnObjectiveCompleted.RemoveDynamic(QuestHandlerSubSystem, &UNerveQuestSubsystem::OnOptionalObjectiveCompleted);
-				OptData.OptionalObjective->ParentObjective->OnObjectiveFailed.RemoveDynamic(QuestHandlerSubSystem, &UNerveQuestSubsystem::OnOptionalObjectiveFailed);
+				OptData.OptionalObjective->OnObjectiveCompleted.RemoveDynamic(QuestHandlerSubSystem, &UNerveQuestSubsystem::OnOptionalObjectiveCompleted);
+				OptData.OptionalObjective->OnObjectiveFailed.RemoveDynamic(QuestHandlerSubSystem, &UNerveQuestSubsystem::OnOptionalObjectiveFailed);
 			}
 		}
-		OptionalDataArray.ObjectiveData.Empty();
+
+		// Release once the entry is gone so the map never points at pooled data
+		TArray<FOptionalObjectiveData> Stopped = MoveTemp(OptionalDataArray.ObjectiveData);
 		QuestHandlerSubSystem->GetAllActiveOptionalObjectives().Remove(this);
+		for (const FOptionalObjectiveData& OptData : Stopped)
+		{
+			if (IsValid(OptData.OptionalObjective))
+			{
+				OptData.OptionalObjective->Uninitialize();
+				QuestHandlerSubSystem->ReleaseObjectiveRuntimeData(OptData.OptionalObjective);
+			}
+		}
 
 		// Refresh UI
 		if (bIsTracked)
@@ -1368,8 +1982,9 @@ void UNerveQuestRuntimeData::MarkQuestComplete()
 {
 	// Update quest state
 	bIsTracked = false;
-	QuestStatus = ENerveQuestCategory::Completed;
 	bIsCompleted = true;
+	SetQuestStatus(ENerveQuestCategory::Completed);
+	RefreshProgress();
 
 	// Untrack if needed
 	if (IsValid(QuestHandlerSubSystem))
@@ -1378,9 +1993,9 @@ void UNerveQuestRuntimeData::MarkQuestComplete()
 	}
 
 	// Grant rewards
-	if (!QuestAsset->QuestRewards.IsEmpty())
+	if (!QuestAsset->GetRewards().IsEmpty())
 	{
-		for (UNerveQuestRewardBase* Reward : QuestAsset->QuestRewards)
+		for (UNerveQuestRewardBase* Reward : QuestAsset->GetRewards())
 		{
 			if (IsValid(Reward) && IsValid(QuestHandlerSubSystem))
 			{
@@ -1391,6 +2006,7 @@ void UNerveQuestRuntimeData::MarkQuestComplete()
 
 	// Broadcast completion
 	OnQuestCompleted.Broadcast(this);
+	OnQuestFinishedNative.ExecuteIfBound(this, true);
 	
 	UE_LOG(LogTemp, Log, TEXT("MarkQuestComplete: Quest %s completed"), *QuestAsset->QuestTitle);
 }
@@ -1398,9 +2014,9 @@ void UNerveQuestRuntimeData::MarkQuestComplete()
 void UNerveQuestRuntimeData::MarkQuestFailed()
 {
 	// Update quest state
-	QuestStatus = ENerveQuestCategory::Failed;
 	bIsTracked = false;
 	bIsCompleted = false;
+	SetQuestStatus(ENerveQuestCategory::Failed);
 
 	// Untrack if needed
 	if (IsValid(QuestHandlerSubSystem))
@@ -1410,6 +2026,7 @@ void UNerveQuestRuntimeData::MarkQuestFailed()
 
 	// Broadcast failure
 	OnQuestFailed.Broadcast(this);
+	OnQuestFinishedNative.ExecuteIfBound(this, false);
 	
 	UE_LOG(LogTemp, Log, TEXT("MarkQuestFailed: Quest %s failed"), *QuestAsset->QuestTitle);
 }
@@ -1419,124 +2036,719 @@ void UNerveQuestRuntimeData::SetQuestHandlerSubSystem(UNerveQuestSubsystem* Ques
 	QuestHandlerSubSystem = QuestSubsystem;
 }
 
-void UNerveQuestRuntimeData::AdvanceToNextObjective(const int32 NextNodeIndex)
+void UNerveQuestRuntimeData::PauseQuest()
 {
-	// Validate current objective
-	if (!IsValid(CurrentObjective) || NextNodeIndex > CurrentObjective->ParentObjective->OutPutPin.Num() - 1)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("AdvanceToNextObjective: Invalid current objective or index"));
-		return;
-	}
+	State.bIsPaused = true;
+	RefreshPauseState();
+}
 
-	// Get next pin
-	UNerveQuestRuntimePin* OutPin = CurrentObjective->ParentObjective->OutPutPin[NextNodeIndex];
-	if (!IsValid(OutPin) || OutPin->Connection.IsEmpty())
-	{
-		CurrentObjective->Uninitialize();
-		CurrentObjective = nullptr;
-		MarkQuestComplete();
-		return;
-	}
+void UNerveQuestRuntimeData::ResumeQuest()
+{
+	State.bIsPaused = false;
+	RefreshPauseState();
+}
 
-	// Execute next objective
-	ExecuteObjectiveFromPin(OutPin);
+bool UNerveQuestRuntimeData::IsPaused() const
+{
+	return State.bIsPaused || (IsValid(QuestHandlerSubSystem) && QuestHandlerSubSystem->AreAllQuestsPaused());
 }
 
-void UNerveQuestRuntimeData::ExecuteObjectiveFromPin(UNerveQuestRuntimePin* OutPin)
+void UNerveQuestRuntimeData::RefreshPauseState()
 {
-	// Validate inputs
-	if (!IsValid(OutPin))
+	const bool bShouldPause = IsPaused();
+	if (bShouldPause == State.bObjectivesPaused) return;
+	State.bObjectivesPaused = bShouldPause;
+
+	// Freezes every wait, deadline and tracking poll of the quest at once
+	const int32 Scope = GetTimerScope();
+	if (State.TimerSubsystem.IsValid() && Scope != 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ExecuteObjectiveFromPin: Invalid OutPin"));
-		return;
+		State.TimerSubsystem->SetScopePaused(Scope, bShouldPause);
 	}
 
-	// Get valid connections from output pin
-	TArray<UNerveQuestRuntimePin*> OutputConnections = OutPin->GetValidConnections();
-	if (OutputConnections.IsEmpty())
+	TArray<const UNerveObjectiveRuntimeData*, TInlineAllocator<8>> RunningObjectives;
+	for (const FNerveQuestBranch& Branch : State.Branches)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ExecuteObjectiveFromPin: No valid connections"));
-		MarkQuestComplete();
-		return;
+		const UNerveObjectiveRuntimeData* Objective = Branch.Objective;
+		if (IsValid(Objective) && !Objective->GetIsCompleted() && !Objective->GetIsFailed())
+		{
+			RunningObjectives.Add(Objective);
+		}
 	}
-
-	UNerveQuestRuntimePin* NextPin = OutputConnections[0];
-	UNerveQuestRuntimeObjectiveBase* NextParentNode = NextPin ? NextPin->GetParentNode() : nullptr;
-	if (!IsValid(NextPin) || !IsValid(NextParentNode))
+	if (IsValid(QuestHandlerSubSystem))
 	{
-		UE_LOG(LogTemp, Error, TEXT("ExecuteObjectiveFromPin: Invalid connection or parent node"));
-		return;
+		if (const FOptionalObjectiveDataArray* Optionals = QuestHandlerSubSystem->FindOptionalObjectiveData(this))
+		{
+			for (const FOptionalObjectiveData& Data : Optionals->ObjectiveData)
+			{
+				if (IsValid(Data.OptionalObjective))
+				{
+					RunningObjectives.Add(Data.OptionalObjective);
+				}
+			}
+		}
 	}
 
-	if (!IsValid(QuestHandlerSubSystem))
+	// Each objective pauses only this quest's run of its node
+	for (const UNerveObjectiveRuntimeData* Objective : RunningObjectives)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ExecuteObjectiveFromPin: Invalid subsystem"));
-		return;
+		if (bShouldPause)
+		{
+			Objective->PauseObjective();
+		}
+		else
+		{
+			Objective->ResumeObjective();
+		}
 	}
 
-	// Find next objective
-	UNerveObjectiveRuntimeData* NextObjective = FindObjectiveData(NextParentNode);
-	if (!IsValid(NextObjective) || !IsValid(NextObjective->ParentObjective))
+	UE_LOG(LogTemp, Log, TEXT("RefreshPauseState: Quest %s %s"), IsValid(QuestAsset) ? *QuestAsset->QuestTitle : TEXT("None"),
+		bShouldPause ? TEXT("paused") : TEXT("resumed"));
+}
+
+void UNerveQuestRuntimeData::SetTimeDilation(const float NewTimeDilation)
+{
+	State.TimeDilation = FMath::Max(NewTimeDilation, 0.0f);
+
+	const int32 Scope = GetTimerScope();
+	if (State.TimerSubsystem.IsValid() && Scope != 0)
 	{
-		UE_LOG(LogTemp, Log, TEXT("ExecuteObjectiveFromPin: Quest %s completed or reached end"), *QuestAsset->QuestTitle);
-		MarkQuestComplete();
-		return;
+		State.TimerSubsystem->SetScopeTimeDilation(Scope, State.TimeDilation);
 	}
+}
 
-	// Clean up current objective
-	if (IsValid(CurrentObjective))
+int32 UNerveQuestRuntimeData::GetTimerScope()
+{
+	UNerveQuestTimerSubsystem* CurrentTimerSubsystem = UNerveQuestTimerSubsystem::GetQuestTimerSubsystem(QuestHandlerSubSystem);
+	if (CurrentTimerSubsystem != State.TimerSubsystem.Get() || (IsValid(CurrentTimerSubsystem) && State.TimerScope == 0))
 	{
-		CurrentObjective->OnObjectiveCompleted.RemoveAll(this);
-		CurrentObjective->OnObjectiveFailed.RemoveAll(this);
+		// First use, or the player moved to another world; scopes live and die with their world
+		ReleaseTimerScope();
+		if (IsValid(CurrentTimerSubsystem))
+		{
+			State.TimerSubsystem = CurrentTimerSubsystem;
+			State.TimerScope = CurrentTimerSubsystem->CreateTimerScope();
+			CurrentTimerSubsystem->SetScopePaused(State.TimerScope, State.bObjectivesPaused);
+			CurrentTimerSubsystem->SetScopeTimeDilation(State.TimerScope, State.TimeDilation);
+		}
 	}
+	return State.TimerScope;
+}
 
-	// Set up new objective
-	CurrentObjective = NextObjective;
-	const UObject* WorldContextObject = nullptr;
-	
-	// 1. Try subsystem's stored context
-	if (const UObject* StoredContext = QuestHandlerSubSystem->QuestWorldContextObject.Get())
+float UNerveQuestRuntimeData::GetCompletedObjectiveFraction() const
+{
+	return State.Objectives.IsEmpty() ? 0.0f : static_cast<float>(State.NumCompletedObjectives) / static_cast<float>(State.Objectives.Num());
+}
+
+UNerveObjectiveRuntimeData* UNerveQuestRuntimeData::FindFirstIncompleteObjective() const
+{
+	// Scans a word of 32 objectives at a time
+	const int32 Index = State.CompletedObjectives.Find(false);
+	return State.Objectives.IsValidIndex(Index) ? State.Objectives[Index].Get() : nullptr;
+}
+
+void UNerveQuestRuntimeData::UpdateObjectiveState(const UNerveObjectiveRuntimeData* Objective)
+{
+	const int32 Index = IsValid(Objective) ? Objective->GetQuestIndex() : INDEX_NONE;
+	if (!State.Objectives.IsValidIndex(Index) || State.Objectives[Index] != Objective) return;
+
+	if (State.CompletedObjectives[Index] != Objective->bIsCompleted)
 	{
-		WorldContextObject = StoredContext;
-		UE_LOG(LogTemp, Log, TEXT("ExecuteObjectiveFromPin: Using stored world context"));
+		const float Weight = IsValid(Objective->ParentObjective) ? Objective->ParentObjective->GetObjectiveWeight() : 0.0f;
+		State.CompletedObjectives[Index] = Objective->bIsCompleted;
+		State.NumCompletedObjectives += Objective->bIsCompleted ? 1 : -1;
+		State.CompletedObjectiveWeight += Objective->bIsCompleted ? Weight : -Weight;
+		if (State.ReachCounts.IsValidIndex(Index) && State.ReachCounts[Index] > 0)
+		{
+			State.ReachableSteps += Objective->bIsCompleted ? -1 : 1;
+		}
 	}
-	// 2. Try subsystem's world
-	else if (const UWorld* SubsystemWorld = QuestHandlerSubSystem->GetWorld())
+	if (State.FailedObjectives[Index] != Objective->bHasFailed)
 	{
-		WorldContextObject = SubsystemWorld;
-		UE_LOG(LogTemp, Log, TEXT("ExecuteObjectiveFromPin: Using subsystem world as fallback"));
+		State.FailedObjectives[Index] = Objective->bHasFailed;
+		State.NumFailedObjectives += Objective->bHasFailed ? 1 : -1;
 	}
-	
-	// Set world context if we found one
-	if (IsValid(WorldContextObject))
+
+	RefreshProgress();
+}
+
+void UNerveQuestRuntimeData::RebuildObjectiveStates()
+{
+	const int32 NumObjectives = State.Objectives.Num();
+	State.CompletedObjectives.Init(false, NumObjectives);
+	State.FailedObjectives.Init(false, NumObjectives);
+	State.TotalObjectiveWeight = 0.0f;
+	State.CompletedObjectiveWeight = 0.0f;
+
+	TMap<const UNerveQuestRuntimeObjectiveBase*, int32> NodeIndices;
+	NodeIndices.Reserve(NumObjectives);
+
+	for (int32 Index = 0; Index < NumObjectives; Index++)
+	{
+		UNerveObjectiveRuntimeData* Objective = State.Objectives[Index];
+		if (!IsValid(Objective)) continue;
+
+		Objective->SetQuestIndex(Index);
+		State.CompletedObjectives[Index] = Objective->bIsCompleted;
+		State.FailedObjectives[Index] = Objective->bHasFailed;
+
+		if (IsValid(Objective->ParentObjective))
+		{
+			NodeIndices.Add(Objective->ParentObjective, Index);
+
+			const float Weight = Objective->ParentObjective->GetObjectiveWeight();
+			State.TotalObjectiveWeight += Weight;
+			State.CompletedObjectiveWeight += Objective->bIsCompleted ? Weight : 0.0f;
+		}
+	}
+
+	State.NumCompletedObjectives = State.CompletedObjectives.CountSetBits();
+	State.NumFailedObjectives = State.FailedObjectives.CountSetBits();
+
+	// Compile the graph once so progress estimates never touch pins
+	State.SuccessorOffsets.Reset(NumObjectives + 1);
+	State.ObjectiveSuccessors.Reset();
+	for (int32 Index = 0; Index < NumObjectives; Index++)
+	{
+		State.SuccessorOffsets.Add(State.ObjectiveSuccessors.Num());
+
+		const UNerveObjectiveRuntimeData* Objective = State.Objectives[Index];
+		if (IsValid(Objective) && IsValid(Objective->ParentObjective))
+		{
+			GatherObjectiveSuccessors(Objective->ParentObjective, NodeIndices, State.ObjectiveSuccessors);
+		}
+	}
+	State.SuccessorOffsets.Add(State.ObjectiveSuccessors.Num());
+
+	// Indices changed, so the reach of every running branch is counted again
+	State.ReachCounts.Init(0, NumObjectives);
+	State.ReachVisited.Init(false, NumObjectives);
+	State.ReachableSteps = 0;
+	for (const FNerveQuestBranch& Branch : State.Branches)
+	{
+		AddBranchReach(Branch.Objective, 1);
+	}
+
+	RefreshProgress();
+}
+
+void UNerveQuestRuntimeData::RefreshProgress()
+{
+	float NewProgress = 0.0f;
+	if (bIsCompleted)
+	{
+		NewProgress = 1.0f;
+	}
+	else if (State.TotalObjectiveWeight > 0.0f)
+	{
+		NewProgress = FMath::Clamp(State.CompletedObjectiveWeight / State.TotalObjectiveWeight, 0.0f, 1.0f);
+	}
+	const int32 NewRemainingSteps = bIsCompleted ? 0 : CountRemainingSteps();
+
+	if (FMath::IsNearlyEqual(NewProgress, OverallProgress) && NewRemainingSteps == State.RemainingSteps) return;
+
+	OverallProgress = NewProgress;
+	State.RemainingSteps = NewRemainingSteps;
+	OnQuestProgressChanged.Broadcast(this);
+}
+
+void UNerveQuestRuntimeData::SetQuestStatus(const ENerveQuestCategory NewStatus)
+{
+	if (QuestStatus == NewStatus) return;
+
+	QuestStatus = NewStatus;
+	OnQuestStatusChanged.Broadcast(this);
+}
+
+int32 UNerveQuestRuntimeData::CountRemainingSteps() const
+{
+	// Without running branches every incomplete objective is still ahead
+	if (State.Branches.IsEmpty() || State.ReachCounts.Num() != State.Objectives.Num())
+	{
+		return State.Objectives.Num() - State.NumCompletedObjectives;
+	}
+	return State.ReachableSteps;
+}
+
+void UNerveQuestRuntimeData::AddBranchReach(const UNerveObjectiveRuntimeData* Objective, const int32 Delta)
+{
+	const int32 NumObjectives = State.Objectives.Num();
+	const int32 Start = IsValid(Objective) ? Objective->GetQuestIndex() : INDEX_NONE;
+	if (!State.Objectives.IsValidIndex(Start) || State.ReachCounts.Num() != NumObjectives || State.SuccessorOffsets.Num() != NumObjectives + 1) return;
+
+	// Walks the compiled graph ahead of one branch only, each objective once
+	TBitArray<>& Visited = State.ReachVisited;
+	TArray<int32>& Reached = State.ReachScratch;
+	Visited[Start] = true;
+	Reached.Add(Start);
+
+	for (int32 Cursor = 0; Cursor < Reached.Num(); Cursor++)
+	{
+		const int32 Index = Reached[Cursor];
+		int32& ReachCount = State.ReachCounts[Index];
+		const bool bWasReachable = ReachCount > 0;
+		ReachCount += Delta;
+		if (!State.CompletedObjectives[Index] && bWasReachable != (ReachCount > 0))
+		{
+			State.ReachableSteps += bWasReachable ? -1 : 1;
+		}
+
+		for (int32 Successor = State.SuccessorOffsets[Index]; Successor < State.SuccessorOffsets[Index + 1]; Successor++)
+		{
+			const int32 Next = State.ObjectiveSuccessors[Successor];
+			if (!Visited[Next])
+			{
+				Visited[Next] = true;
+				Reached.Add(Next);
+			}
+		}
+	}
+
+	for (const int32 Index : Reached)
+	{
+		Visited[Index] = false;
+	}
+	Reached.Reset();
+}
+
+void UNerveQuestRuntimeData::ReleaseTimerScope()
+{
+	if (State.TimerSubsystem.IsValid() && State.TimerScope != 0)
+	{
+		State.TimerSubsystem->ReleaseTimerScope(State.TimerScope);
+	}
+	State.TimerSubsystem.Reset();
+	State.TimerScope = 0;
+}
+
+void UNerveQuestRuntimeData::AdvanceToNextObjective(const int32 NextNodeIndex)
+{
+	AdvanceFromObjective(CurrentObjective, NextNodeIndex);
+}
+
+void UNerveQuestRuntimeData::AdvanceFromObjective(UNerveObjectiveRuntimeData* Objective, const int32 NextNodeIndex)
+{
+	// Validate objective
+	if (!IsValid(Objective) || !IsValid(Objective->ParentObjective) || !Objective->ParentObjective->OutPutPin.IsValidIndex(NextNodeIndex))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AdvanceFromObjective: Invalid objective or index"));
+		return;
+	}
+
+	// Objectives advanced from outside a branch, e.g. restored ones, get a branch of their own
+	const FNerveQuestBranch* Branch = FindBranch(Objective);
+	int32 BranchId = Branch ? Branch->Id : INDEX_NONE;
+	if (BranchId == INDEX_NONE)
+	{
+		BranchId = AddBranch();
+		FindBranch(BranchId)->Objective = Objective;
+	}
+
+	MoveBranch(BranchId, Objective->ParentObjective->OutPutPin[NextNodeIndex]);
+}
+
+void UNerveQuestRuntimeData::ExecuteObjectiveFromPin(UNerveQuestRuntimePin* OutPin)
+{
+	// Validate inputs
+	if (!IsValid(OutPin))
+	{
+		UE_LOG(LogTemp, Error, TEXT("ExecuteObjectiveFromPin: Invalid OutPin"));
+		return;
+	}
+
+	const FNerveQuestBranch* Branch = FindBranch(CurrentObjective);
+	MoveBranch(Branch ? Branch->Id : AddBranch(), OutPin);
+}
+
+void UNerveQuestRuntimeData::GetRunningObjectives(TArray<UNerveObjectiveRuntimeData*>& OutObjectives) const
+{
+	OutObjectives.Reset(State.Branches.Num());
+	ForEachRunningObjective([&OutObjectives](UNerveObjectiveRuntimeData* Objective)
+	{
+		OutObjectives.Add(Objective);
+	});
+}
+
+void UNerveQuestRuntimeData::ForEachRunningObjective(const TFunctionRef<void(UNerveObjectiveRuntimeData*)> Visitor) const
+{
+	for (const FNerveQuestBranch& Branch : State.Branches)
+	{
+		if (IsValid(Branch.Objective))
+		{
+			Visitor(Branch.Objective);
+		}
+	}
+}
+
+bool UNerveQuestRuntimeData::IsObjectiveRunning(const UNerveObjectiveRuntimeData* Objective) const
+{
+	return IsValid(Objective) && State.Branches.ContainsByPredicate([Objective](const FNerveQuestBranch& Branch)
+	{
+		return Branch.Objective == Objective;
+	});
+}
+
+void UNerveQuestRuntimeData::CompileJoins()
+{
+	State.Joins.Reset();
+	if (!IsValid(QuestAsset) || !IsValid(QuestAsset->RuntimeGraph)) return;
+
+	const TArray<TObjectPtr<UNerveQuestRuntimeObjectiveBase>>& Nodes = QuestAsset->RuntimeGraph->GraphNodes;
+	for (const UNerveQuestRuntimeObjectiveBase* Node : Nodes)
+	{
+		if (const UNerveJoinObjective* Join = Cast<UNerveJoinObjective>(Node))
+		{
+			State.Joins.FindOrAdd(Join).NumBranches = Join->GetNumConnectedBranches();
+		}
+	}
+	if (State.Joins.IsEmpty()) return;
+
+	// Match every fork, and every pin forking through several links, to the joins its branches meet at
+	TArray<const UNerveJoinObjective*, TInlineAllocator<4>> ClosingJoins;
+	auto AddClosedFork = [this, &ClosingJoins](const UObject* Source, const TConstArrayView<const UNerveQuestRuntimePin*> BranchPins)
+	{
+		ClosingJoins.Reset();
+		GatherClosingJoins(BranchPins, ClosingJoins);
+		for (const UNerveJoinObjective* Join : ClosingJoins)
+		{
+			State.Joins.FindOrAdd(Join).ClosedForks.Add(Source);
+		}
+	};
+
+	for (const UNerveQuestRuntimeObjectiveBase* Node : Nodes)
+	{
+		if (!IsValid(Node)) continue;
+
+		if (Node->IsA<UNerveForkObjective>())
+		{
+			TArray<const UNerveQuestRuntimePin*, TInlineAllocator<4>> BranchPins(Node->OutPutPin);
+			AddClosedFork(Node, BranchPins);
+			continue;
+		}
+
+		for (const UNerveQuestRuntimePin* OutPin : Node->OutPutPin)
+		{
+			if (IsValid(OutPin) && OutPin->GetValidConnections().Num() > 1)
+			{
+				AddClosedFork(OutPin, MakeArrayView(&OutPin, 1));
+			}
+		}
+	}
+}
+
+int32 UNerveQuestRuntimeData::AddBranch(const TConstArrayView<FNerveQuestForkGroup> ForkGroups)
+{
+	FNerveQuestBranch& Branch = State.Branches.AddDefaulted_GetRef();
+	Branch.Id = State.NextBranchId++;
+	Branch.ForkGroups.Append(ForkGroups.GetData(), ForkGroups.Num());
+	return Branch.Id;
+}
+
+FNerveQuestBranch* UNerveQuestRuntimeData::FindBranch(const int32 BranchId)
+{
+	return State.Branches.FindByPredicate([BranchId](const FNerveQuestBranch& Branch) { return Branch.Id == BranchId; });
+}
+
+FNerveQuestBranch* UNerveQuestRuntimeData::FindBranch(const UNerveObjectiveRuntimeData* Objective)
+{
+	if (!IsValid(Objective)) return nullptr;
+	return State.Branches.FindByPredicate([Objective](const FNerveQuestBranch& Branch) { return Branch.Objective == Objective; });
+}
+
+void UNerveQuestRuntimeData::MoveBranch(const int32 BranchId, UNerveQuestRuntimePin* OutPin)
+{
+	// Get valid connections from output pin
+	TArray<UNerveQuestRuntimePin*> OutputConnections = IsValid(OutPin) ? OutPin->GetValidConnections() : TArray<UNerveQuestRuntimePin*>();
+	if (OutputConnections.IsEmpty())
+	{
+		EndBranch(BranchId);
+		return;
+	}
+
+	if (OutputConnections.Num() == 1)
+	{
+		EnterNode(BranchId, OutputConnections[0]->GetParentNode());
+		return;
+	}
+
+	// Several links on one pin fork like a fork node
+	TArray<UNerveQuestRuntimeObjectiveBase*, TInlineAllocator<4>> Targets;
+	for (const UNerveQuestRuntimePin* Connection : OutputConnections)
+	{
+		Targets.Add(Connection->GetParentNode());
+	}
+	ForkBranch(BranchId, Targets, OutPin);
+}
+
+void UNerveQuestRuntimeData::EnterNode(const int32 BranchId, UNerveQuestRuntimeObjectiveBase* Node)
+{
+	if (!IsValid(Node))
+	{
+		UE_LOG(LogTemp, Error, TEXT("EnterNode: Invalid connection or parent node"));
+		EndBranch(BranchId);
+		return;
+	}
+
+	if (const UNerveForkObjective* Fork = Cast<UNerveForkObjective>(Node))
+	{
+		TArray<UNerveQuestRuntimeObjectiveBase*, TInlineAllocator<4>> Targets;
+		for (const UNerveQuestRuntimePin* BranchPin : Fork->OutPutPin)
+		{
+			const TArray<UNerveQuestRuntimePin*> Connections = IsValid(BranchPin) ? BranchPin->GetValidConnections() : TArray<UNerveQuestRuntimePin*>();
+			for (const UNerveQuestRuntimePin* Connection : Connections)
+			{
+				Targets.Add(Connection->GetParentNode());
+			}
+		}
+
+		if (Targets.IsEmpty())
+		{
+			EndBranch(BranchId);
+			return;
+		}
+		ForkBranch(BranchId, Targets, Fork);
+		return;
+	}
+
+	if (const UNerveJoinObjective* Join = Cast<UNerveJoinObjective>(Node))
+	{
+		ArriveAtJoin(BranchId, Join);
+		return;
+	}
+
+	// Find next objective
+	UNerveObjectiveRuntimeData* NextObjective = FindObjectiveData(Node);
+	if (!IsValid(NextObjective) || !IsValid(NextObjective->ParentObjective))
+	{
+		UE_LOG(LogTemp, Log, TEXT("EnterNode: Quest %s branch reached end"), *QuestAsset->QuestTitle);
+		EndBranch(BranchId);
+		return;
+	}
+
+	RunObjective(BranchId, NextObjective);
+}
+
+void UNerveQuestRuntimeData::ForkBranch(const int32 BranchId, const TConstArrayView<UNerveQuestRuntimeObjectiveBase*> Targets, const UObject* Source)
+{
+	FNerveQuestBranch* Branch = FindBranch(BranchId);
+	if (!Branch || Targets.IsEmpty()) return;
+
+	// The branch itself takes the first target, every other target gets a sibling in the same fork group
+	Branch->ForkGroups.Add({State.NextForkGroup++, Source});
+	const TArray<FNerveQuestForkGroup, TInlineAllocator<2>> ForkGroups = Branch->ForkGroups;
+
+	TArray<int32, TInlineAllocator<4>> BranchIds;
+	BranchIds.Add(BranchId);
+	for (int32 Index = 1; Index < Targets.Num(); Index++)
+	{
+		BranchIds.Add(AddBranch(ForkGroups));
+	}
+
+	for (int32 Index = 0; Index < Targets.Num(); Index++)
+	{
+		// An earlier branch may already have finished the fork through an Any join
+		if (FindBranch(BranchIds[Index]))
+		{
+			EnterNode(BranchIds[Index], Targets[Index]);
+		}
+	}
+}
+
+void UNerveQuestRuntimeData::ArriveAtJoin(const int32 BranchId, const UNerveJoinObjective* Join)
+{
+	FNerveQuestBranch* Branch = FindBranch(BranchId);
+	if (!Branch) return;
+
+	// The join closes the innermost fork of the branch that was matched to it; forks opened inside
+	// that one without a join of their own are passed through
+	const FNerveQuestJoinInfo* JoinInfo = State.Joins.Find(Join);
+	int32 GroupIndex = INDEX_NONE;
+	if (JoinInfo)
+	{
+		GroupIndex = Branch->ForkGroups.FindLastByPredicate([JoinInfo](const FNerveQuestForkGroup& Group)
+		{
+			return JoinInfo->ClosedForks.Contains(Group.Source);
+		});
+	}
+	const int32 ForkGroup = GroupIndex != INDEX_NONE ? Branch->ForkGroups[GroupIndex].Id : INDEX_NONE;
+
+	// Branches of different forks meeting at one join are counted apart
+	const TPair<const UNerveJoinObjective*, int32> ArrivalKey(Join, ForkGroup);
+	int32& Arrivals = State.JoinArrivals.FindOrAdd(ArrivalKey);
+	Arrivals++;
+	if (Arrivals < Join->GetRequiredBranches(JoinInfo ? JoinInfo->NumBranches : 1))
+	{
+		// Waits as a count only; the last branch to arrive carries on
+		EndBranch(BranchId);
+		return;
+	}
+	State.JoinArrivals.Remove(ArrivalKey);
+
+	// Leave the fork, and the unjoined forks inside it, and cancel whatever of it still runs
+	if (GroupIndex != INDEX_NONE)
+	{
+		Branch->ForkGroups.SetNum(GroupIndex);
+		CancelBranches(ForkGroup, BranchId);
+	}
+
+	MoveBranch(BranchId, Join->OutPutPin.IsValidIndex(0) ? Join->OutPutPin[0] : nullptr);
+}
+
+void UNerveQuestRuntimeData::RunObjective(const int32 BranchId, UNerveObjectiveRuntimeData* Objective)
+{
+	FNerveQuestBranch* Branch = FindBranch(BranchId);
+	if (!Branch) return;
+
+	if (!IsValid(QuestHandlerSubSystem))
+	{
+		UE_LOG(LogTemp, Error, TEXT("RunObjective: Invalid subsystem"));
+		return;
+	}
+
+	// Clean up the branch's previous objective
+	if (IsValid(Branch->Objective))
 	{
-		CurrentObjective->ParentObjective->SetWorldContextObject(WorldContextObject);
+		Branch->Objective->OnObjectiveCompleted.RemoveAll(this);
+		Branch->Objective->OnObjectiveFailed.RemoveAll(this);
 	}
 
+	// Set up new objective
+	AddBranchReach(Branch->Objective, -1);
+	Branch->Objective = Objective;
+	AddBranchReach(Objective, 1);
+	CurrentObjective = Objective;
+	RefreshProgress();
+
 	// Bind events
-	CurrentObjective->OnObjectiveCompleted.AddDynamic(this, &UNerveQuestRuntimeData::OnObjectiveCompleted);
-	CurrentObjective->OnObjectiveFailed.AddDynamic(this, &UNerveQuestRuntimeData::OnObjectiveFailed);
+	Objective->OnObjectiveCompleted.AddDynamic(this, &UNerveQuestRuntimeData::OnObjectiveCompleted);
+	Objective->OnObjectiveFailed.AddDynamic(this, &UNerveQuestRuntimeData::OnObjectiveFailed);
 
 	// Execute objective
 	if (IsValid(QuestAsset))
 	{
-		CurrentObjective->ExecuteObjective(QuestAsset);
+		Objective->ExecuteObjective(QuestAsset);
 	}
 
+	// The objective may have finished right away and moved the quest on
+	if (CurrentObjective != Objective) return;
+
 	// Update tracking
 	if (bIsTracked && IsValid(QuestHandlerSubSystem) && QuestHandlerSubSystem->GetQuestScreen())
 	{
-		CurrentObjective->MarkAsTracked(bIsTracked);
+		Objective->MarkAsTracked(bIsTracked);
 		QuestHandlerSubSystem->RefreshQuestUI(this);
 	}
 
 	// Start optional objectives
-	if (IsValid(CurrentObjective) && IsValid(CurrentObjective->ParentObjective))
+	if (IsValid(Objective->ParentObjective))
 	{
 		StartOptionalObjectives();
 	}
 }
 
+void UNerveQuestRuntimeData::EndBranch(const int32 BranchId)
+{
+	const int32 Index = State.Branches.IndexOfByPredicate([BranchId](const FNerveQuestBranch& Branch) { return Branch.Id == BranchId; });
+	if (Index == INDEX_NONE) return;
+
+	UNerveObjectiveRuntimeData* Objective = State.Branches[Index].Objective;
+	AddBranchReach(Objective, -1);
+	State.Branches.RemoveAt(Index);
+	if (IsValid(Objective))
+	{
+		Objective->Uninitialize();
+	}
+
+	if (!State.Branches.IsEmpty())
+	{
+		// Another branch keeps the quest going and takes over as current objective
+		if (CurrentObjective == Objective)
+		{
+			CurrentObjective = State.Branches.Last().Objective;
+			if (bIsTracked && IsValid(QuestHandlerSubSystem))
+			{
+				QuestHandlerSubSystem->RefreshQuestUI(this);
+			}
+		}
+		RefreshProgress();
+		return;
+	}
+
+	CurrentObjective = nullptr;
+	State.JoinArrivals.Reset();
+	MarkQuestComplete();
+}
+
+void UNerveQuestRuntimeData::CancelBranches(const int32 ForkGroup, const int32 KeepBranchId)
+{
+	TArray<UNerveObjectiveRuntimeData*, TInlineAllocator<4>> Cancelled;
+	State.Branches.RemoveAll([&](const FNerveQuestBranch& Branch)
+	{
+		if (Branch.Id == KeepBranchId) return false;
+		if (ForkGroup != INDEX_NONE && !Branch.ForkGroups.ContainsByPredicate([ForkGroup](const FNerveQuestForkGroup& Group) { return Group.Id == ForkGroup; })) return false;
+
+		Cancelled.Add(Branch.Objective);
+		return true;
+	});
+
+	for (UNerveObjectiveRuntimeData* Objective : Cancelled)
+	{
+		if (!IsValid(Objective)) continue;
+
+		AddBranchReach(Objective, -1);
+		Objective->OnObjectiveCompleted.RemoveAll(this);
+		Objective->OnObjectiveFailed.RemoveAll(this);
+		Objective->MarkAsTracked(false);
+		StopOptionalObjectivesOf(Objective);
+		Objective->Uninitialize();
+
+		if (CurrentObjective == Objective)
+		{
+			CurrentObjective = nullptr;
+		}
+	}
+
+	if (!IsValid(CurrentObjective) && !State.Branches.IsEmpty())
+	{
+		CurrentObjective = State.Branches.Last().Objective;
+	}
+	RefreshProgress();
+}
+
+void UNerveQuestRuntimeData::StopOptionalObjectivesOf(const UNerveObjectiveRuntimeData* Objective)
+{
+	if (!IsValid(QuestHandlerSubSystem)) return;
+
+	const FOptionalObjectiveDataArray* Optionals = QuestHandlerSubSystem->FindOptionalObjectiveData(this);
+	if (!Optionals) return;
+
+	// Stopping edits the array, so collect first
+	TArray<UNerveObjectiveRuntimeData*, TInlineAllocator<4>> ToStop;
+	for (const FOptionalObjectiveData& Data : Optionals->ObjectiveData)
+	{
+		if (Data.ParentObjective == Objective)
+		{
+			ToStop.Add(Data.OptionalObjective);
+		}
+	}
+
+	for (UNerveObjectiveRuntimeData* Optional : ToStop)
+	{
+		QuestHandlerSubSystem->StopOptionalObjective(this, Optional);
+	}
+}
+
+void UNerveQuestRuntimeData::ResetBranches()
+{
+	State.Branches.Reset();
+	State.JoinArrivals.Reset();
+	for (int32& ReachCount : State.ReachCounts)
+	{
+		ReachCount = 0;
+	}
+	State.ReachableSteps = 0;
+}
+
 TArray<UNerveQuestRewardBase*> UNerveQuestRuntimeData::GetQuestRewards() const
 {
 	if (!IsValid(QuestAsset))
@@ -1546,7 +2758,7 @@ TArray<UNerveQuestRewardBase*> UNerveQuestRuntimeData::GetQuestRewards() const
 
 	// Convert smart pointers to raw pointers for Blueprint compatibility
 	TArray<UNerveQuestRewardBase*> Rewards;
-	for (const TObjectPtr<UNerveQuestRewardBase>& RewardPtr : QuestAsset->QuestRewards)
+	for (const TObjectPtr<UNerveQuestRewardBase>& RewardPtr : QuestAsset->GetRewards())
 	{
 		if (UNerveQuestRewardBase* Reward = RewardPtr.Get())
 		{
@@ -1559,7 +2771,7 @@ TArray<UNerveQuestRewardBase*> UNerveQuestRuntimeData::GetQuestRewards() const
 UNerveObjectiveRuntimeData* UNerveQuestRuntimeData::FindObjectiveData(const UNerveQuestRuntimeObjectiveBase* ObjectiveBase)
 {
 	// Find matching objective
-	for (UNerveObjectiveRuntimeData* Objective : AllNerveObjectiveRuntimeData)
+	for (UNerveObjectiveRuntimeData* Objective : State.Objectives)
 	{
 		if (IsValid(Objective) && Objective->ParentObjective == ObjectiveBase)
 		{
@@ -1586,20 +2798,29 @@ void UNerveQuestRuntimeData::OnObjectiveCompleted(UNerveQuestRuntimeObjectiveBas
 	Objective->OnObjectiveCompleted.RemoveDynamic(this, &UNerveQuestRuntimeData::OnObjectiveCompleted);
 	Objective->OnObjectiveFailed.RemoveDynamic(this, &UNerveQuestRuntimeData::OnObjectiveFailed);
 
-	// Update UI if tracked
+	// Update UI if tracked; the node is shared, so untrack this quest's run of it
+	UNerveObjectiveRuntimeData* ObjectiveData = FindObjectiveData(Objective);
 	if (IsValid(QuestHandlerSubSystem) && bIsTracked)
 	{
-		Objective->MarkAsTracked(false);
+		if (IsValid(ObjectiveData)) ObjectiveData->MarkAsTracked(false);
 		if (IsValid(QuestHandlerSubSystem->GetQuestScreen()))
 		{
 			QuestHandlerSubSystem->GetQuestScreen()->UnInitQuestObjective(this);
 		}
 	}
 
-	StopAllOptionalObjectives();
+	// Other branches keep their optional objectives
+	if (State.Branches.Num() > 1)
+	{
+		StopOptionalObjectivesOf(ObjectiveData);
+	}
+	else
+	{
+		StopAllOptionalObjectives();
+	}
 	
-	// Advance to next objective
-	AdvanceToNextObjective();
+	// Advance the objective's branch
+	AdvanceFromObjective(ObjectiveData);
 	
 	UE_LOG(LogTemp, Log, TEXT("OnObjectiveCompleted: Objective completed for quest %s"), *QuestAsset->QuestTitle);
 }
@@ -1620,25 +2841,40 @@ void UNerveQuestRuntimeData::OnObjectiveFailed(UNerveQuestRuntimeObjectiveBase*
 	Objective->OnObjectiveCompleted.RemoveDynamic(this, &UNerveQuestRuntimeData::OnObjectiveCompleted);
 	Objective->OnObjectiveFailed.RemoveDynamic(this, &UNerveQuestRuntimeData::OnObjectiveFailed);
 
-	// Update UI if tracked
+	// Update UI if tracked; the node is shared, so untrack this quest's run of it
+	UNerveObjectiveRuntimeData* ObjectiveData = FindObjectiveData(Objective);
 	if (IsValid(QuestHandlerSubSystem) && bIsTracked)
 	{
-		Objective->MarkAsTracked(false);
+		if (IsValid(ObjectiveData)) ObjectiveData->MarkAsTracked(false);
 		QuestHandlerSubSystem->GetQuestScreen()->UnInitQuestObjective(this);
 	}
 
-	StopAllOptionalObjectives();
+	const EObjectiveFailureResponse FailureResponse = Objective->GetObjectiveFailureResponse();
+	if (FailureResponse == EObjectiveFailureResponse::ContinueToNextObjective && State.Branches.Num() > 1)
+	{
+		StopOptionalObjectivesOf(ObjectiveData);
+	}
+	else
+	{
+		StopAllOptionalObjectives();
+
+		// Other branches cannot outlive a failed or restarted quest
+		const FNerveQuestBranch* FailedBranch = FindBranch(ObjectiveData);
+		CancelBranches(INDEX_NONE, FailedBranch ? FailedBranch->Id : INDEX_NONE);
+	}
 
 	// Handle failure response
-	switch (Objective->GetObjectiveFailureResponse())
+	switch (FailureResponse)
 	{
 	case EObjectiveFailureResponse::FailQuest:
+		ResetBranches();
 		MarkQuestFailed();
 		break;
 	case EObjectiveFailureResponse::ContinueToNextObjective:
-		AdvanceToNextObjective();
+		AdvanceFromObjective(ObjectiveData);
 		break;
 	case EObjectiveFailureResponse::RestartQuest:
+		ResetBranches();
 		CurrentObjective = nullptr;
 		StartQuest();
 		break;
@@ -1671,39 +2907,57 @@ void UNerveQuestRuntimeData::StartOptionalObjectivesFromPin(UNerveQuestRuntimePi
 void UNerveQuestRuntimeData::AccumulateObjectives(UNerveQuestRuntimeObjectiveBase* Objective)
 {
 	// Validate inputs
-	if (!IsValid(Objective) || !Objective->OutPutPin.IsValidIndex(0) || !IsValid(Objective->OutPutPin[0]))
+	if (!IsValid(Objective))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AccumulateObjectives: Invalid objective or missing output pin"));
+		UE_LOG(LogTemp, Warning, TEXT("AccumulateObjectives: Invalid objective"));
 		return;
 	}
 
-	// Get valid connections using safe accessor
-	TArray<UNerveQuestRuntimePin*> ValidConnections = Objective->OutPutPin[0]->GetValidConnections();
-	if (ValidConnections.IsEmpty())
+	if (!IsValid(QuestHandlerSubSystem))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AccumulateObjectives: No valid connections found"));
+		UE_LOG(LogTemp, Error, TEXT("AccumulateObjectives: Invalid subsystem"));
 		return;
 	}
 
-	// Get parent node safely
-	UNerveQuestRuntimeObjectiveBase* ParentNode = ValidConnections[0]->GetParentNode();
-	if (!IsValid(ParentNode))
-	{
-		UE_LOG(LogTemp, Warning, TEXT("AccumulateObjectives: Invalid parent node"));
-		return;
-	}
+	// Walks every branch once; joins are reached from several of them
+	TArray<UNerveQuestRuntimeObjectiveBase*, TInlineAllocator<16>> PendingNodes;
+	TSet<const UNerveQuestRuntimeObjectiveBase*> VisitedNodes;
+	PendingNodes.Add(Objective);
+	VisitedNodes.Add(Objective);
 
-	// Create and initialize objective
-	UNerveObjectiveRuntimeData* NewObjective = NewObject<UNerveObjectiveRuntimeData>(this);
-	if (IsValid(NewObjective) && IsValid(QuestHandlerSubSystem))
+	while (!PendingNodes.IsEmpty())
 	{
-		NewObjective->Initialize(ParentNode, QuestHandlerSubSystem, Objective->bIsOptionalObjective);
-		AllNerveObjectiveRuntimeData.Add(NewObjective);
-		AccumulateObjectives(ParentNode);
-	}
-	else
-	{
-		UE_LOG(LogTemp, Error, TEXT("AccumulateObjectives: Failed to create or initialize new objective"));
+		UNerveQuestRuntimeObjectiveBase* Node = PendingNodes.Pop();
+
+		// Forks continue through every branch pin, other nodes through their first output only
+		const int32 NumPins = Node->IsA<UNerveForkObjective>() ? Node->OutPutPin.Num() : FMath::Min(Node->OutPutPin.Num(), 1);
+		for (int32 PinIndex = NumPins - 1; PinIndex >= 0; PinIndex--)
+		{
+			if (!IsValid(Node->OutPutPin[PinIndex])) continue;
+
+			TArray<UNerveQuestRuntimePin*> ValidConnections = Node->OutPutPin[PinIndex]->GetValidConnections();
+			for (int32 ConnectionIndex = ValidConnections.Num() - 1; ConnectionIndex >= 0; ConnectionIndex--)
+			{
+				UNerveQuestRuntimeObjectiveBase* ParentNode = ValidConnections[ConnectionIndex]->GetParentNode();
+				if (!IsValid(ParentNode) || VisitedNodes.Contains(ParentNode)) continue;
+				VisitedNodes.Add(ParentNode);
+				PendingNodes.Add(ParentNode);
+
+				// Forks and joins are followed by the quest itself and need no runtime data
+				if (ParentNode->IsA<UNerveForkObjective>() || ParentNode->IsA<UNerveJoinObjective>()) continue;
+
+				// Create and initialize objective
+				UNerveObjectiveRuntimeData* NewObjective = QuestHandlerSubSystem->AcquireObjectiveRuntimeData();
+				if (!IsValid(NewObjective))
+				{
+					UE_LOG(LogTemp, Error, TEXT("AccumulateObjectives: Failed to create or initialize new objective"));
+					continue;
+				}
+				NewObjective->Initialize(ParentNode, QuestHandlerSubSystem, Node->bIsOptionalObjective);
+				NewObjective->SetOwningQuest(this);
+				State.Objectives.Add(NewObjective);
+			}
+		}
 	}
 }
 
@@ -1714,6 +2968,7 @@ void UNerveObjectiveRuntimeData::Initialize(UNerveQuestRuntimeObjectiveBase* Obj
 	QuestHandlerSubSystem = QuestSubsystem;
 	bIsOptionalObjective = bAsOptional;
 	ParentMainObjective = MainParent;
+	State.bEnded = false;
 
 	// Set display priority
 	if (IsValid(ParentObjective))
@@ -1721,34 +2976,23 @@ void UNerveObjectiveRuntimeData::Initialize(UNerveQuestRuntimeObjectiveBase* Obj
 		DisplayPriority = ParentObjective->GetDisplayPriority();
 	}
 
-	// Ensure objective has proper world context set
-	if (IsValid(Objective) && IsValid(QuestSubsystem))
-	{
-		// Try to get world context from subsystem
-		if (UObject* WorldContext = QuestSubsystem->QuestWorldContextObject.Get())
-		{
-			Objective->SetWorldContextObject(WorldContext);
-		}
-		// Fallback to subsystem's world
-		else if (UWorld* SubsystemWorld = QuestSubsystem->GetWorld())
-		{
-			Objective->SetWorldContextObject(SubsystemWorld);
-		}
-	}
-
 	// Create progress tracker if allowed
 	if (IsValid(ParentObjective) && ParentObjective->AllowGenerateProgressTracker())
 	{
-		TrackingWidget = CreateWidget<UObjectiveProgressTracker>
+		const ULocalPlayer* LocalPlayer = IsValid(QuestSubsystem) ? QuestSubsystem->GetLocalPlayer() : nullptr;
+		State.TrackingWidget = CreateWidget<UObjectiveProgressTracker>
 		(
-			UGameplayStatics::GetPlayerController(GetWorld(), 0), 
+			LocalPlayer ? LocalPlayer->GetPlayerController(GetWorld()) : nullptr, 
 			ParentObjective->GetProgressTrackerClass());
 
-		if (IsValid(TrackingWidget))
+		if (IsValid(State.TrackingWidget))
 		{
-			TrackingWidget->SetCurrent(0);
-			TrackingWidget->SetMax(1);
+			State.TrackingWidget->SetCurrent(0);
+			State.TrackingWidget->SetMax(1);
 		}
+
+		State.PendingProgress = State.DeliveredProgress = 0.0f;
+		State.PendingMaxProgress = State.DeliveredMaxProgress = 1.0f;
 	}
 	
 	UE_LOG(LogTemp, Log, TEXT("Initialize: Initialized objective %s"), *ParentObjective->GetName());
@@ -1756,15 +3000,23 @@ void UNerveObjectiveRuntimeData::Initialize(UNerveQuestRuntimeObjectiveBase* Obj
 
 void UNerveObjectiveRuntimeData::Uninitialize()
 {
-	// Clean up bindings
-	if (IsValid(ParentObjective))
-	{
-		ParentObjective->OnObjectiveCompleted.RemoveDynamic(this, &UNerveObjectiveRuntimeData::ObjectiveCompleted);
-		ParentObjective->OnObjectiveFailed.RemoveDynamic(this, &UNerveObjectiveRuntimeData::ObjectiveFailed);
-		ParentObjective->OnProgressChanged.RemoveDynamic(this, &UNerveObjectiveRuntimeData::ObjectiveProgress);
+	// Ending twice would run EndObjective and CleanUpObjective twice
+	if (State.bEnded) return;
+	State.bEnded = true;
 
-		ParentObjective->CleanUpObjective();
+	// End this quest's run; the shared node and its other runs are left alone
+	if (State.Run.IsValid())
+	{
+		if (IsValid(ParentObjective))
+		{
+			ParentObjective->EndObjective(*State.Run);
+		}
+		State.Run.Reset();
 	}
+
+	// Any queued delivery is dropped by the subsystem once it sees the flag cleared
+	State.bProgressPending = false;
+	State.bProgressHeldBack = false;
 	
 	UE_LOG(LogTemp, Log, TEXT("Uninitialize: Cleaned up objective %s"), ParentObjective ? *ParentObjective->GetName() : TEXT("Unknown"));
 }
@@ -1772,7 +3024,7 @@ void UNerveObjectiveRuntimeData::Uninitialize()
 void UNerveObjectiveRuntimeData::BeginDestroy()
 {
 	// Ensure cleanup happens even if Uninitialize wasn't called
-	if (IsValid(ParentObjective) || IsValid(QuestHandlerSubSystem))
+	if (!State.bEnded && (IsValid(ParentObjective) || IsValid(QuestHandlerSubSystem)))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("BeginDestroy: Objective runtime data not properly uninitialized, performing emergency cleanup"));
 		Uninitialize();
@@ -1781,7 +3033,43 @@ void UNerveObjectiveRuntimeData::BeginDestroy()
 	Super::BeginDestroy();
 }
 
-void UNerveObjectiveRuntimeData::ExecuteObjective(UNerveQuestAsset* QuestAsset) const
+void UNerveObjectiveRuntimeData::ResetForReuse()
+{
+	ParentObjective = nullptr;
+	bIsCompleted = false;
+	bHasFailed = false;
+	bIsOptionalObjective = false;
+	DisplayPriority = 0;
+	ParentMainObjective = nullptr;
+
+	OnObjectiveCompleted.Clear();
+	OnObjectiveFailed.Clear();
+	OnObjectiveFinishedNative.Unbind();
+
+	State.TrackingWidget = nullptr;
+	QuestHandlerSubSystem = nullptr;
+	State.ParentQuestAsset = nullptr;
+	State.Run.Reset();
+	State.PendingProgress = State.DeliveredProgress = 0.0f;
+	State.PendingMaxProgress = State.DeliveredMaxProgress = 1.0f;
+	State.bProgressPending = false;
+	State.bProgressHeldBack = false;
+	State.bEnded = false;
+	State.OwningQuest.Reset();
+	State.LiveIndex = INDEX_NONE;
+	State.QuestIndex = INDEX_NONE;
+}
+
+void UNerveObjectiveRuntimeData::AddStateReferences(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(State.TrackingWidget, this);
+	if (State.Run.IsValid())
+	{
+		State.Run->AddReferencedObjects(Collector, this);
+	}
+}
+
+void UNerveObjectiveRuntimeData::ExecuteObjective(UNerveQuestAsset* QuestAsset)
 {
 	// Validate inputs
 	if (!IsValid(ParentObjective) || !IsValid(QuestAsset))
@@ -1791,21 +3079,50 @@ void UNerveObjectiveRuntimeData::ExecuteObjective(UNerveQuestAsset* QuestAsset)
 	}
 
 	// Set parent quest
-	ParentQuestAsset = QuestAsset;
+	State.ParentQuestAsset = QuestAsset;
+	State.bEnded = false;
 
-	// Bind events
-	ParentObjective->OnObjectiveCompleted.AddDynamic(this, &UNerveObjectiveRuntimeData::ObjectiveCompleted);
-	ParentObjective->OnObjectiveFailed.AddDynamic(this, &UNerveObjectiveRuntimeData::ObjectiveFailed);
-	ParentObjective->OnProgressChanged.AddDynamic(this, &UNerveObjectiveRuntimeData::ObjectiveProgress);
+	// Run the objective's timers in its quest's scope so they pause and dilate with the quest
+	UNerveQuestRuntimeData* Quest = State.OwningQuest.Get();
+	if (!IsValid(Quest) && IsValid(QuestHandlerSubSystem))
+	{
+		Quest = QuestHandlerSubSystem->GetQuestRuntimeData(QuestAsset);
+	}
+
+	// Prefer the subsystem's world context, falling back to its world
+	const UObject* WorldContext = nullptr;
+	ULocalPlayer* LocalPlayer = nullptr;
+	if (IsValid(QuestHandlerSubSystem))
+	{
+		WorldContext = QuestHandlerSubSystem->QuestWorldContextObject.Get();
+		if (!WorldContext) WorldContext = QuestHandlerSubSystem->GetWorld();
+		LocalPlayer = QuestHandlerSubSystem->GetLocalPlayer();
+	}
+
+	// The node is shared with every quest running this graph; this quest's state lives in its run
+	if (State.Run.IsValid())
+	{
+		ParentObjective->EndObjective(*State.Run);
+	}
+	State.Run = ParentObjective->CreateRun(QuestAsset, WorldContext, LocalPlayer, IsValid(Quest) ? Quest->GetTimerScope() : 0);
+	State.Run->OnFinished.BindUObject(this, &UNerveObjectiveRuntimeData::HandleRunFinished);
+	State.Run->OnProgress.BindUObject(this, &UNerveObjectiveRuntimeData::HandleRunProgress);
 
 	// Broadcast start event
 	if (IsValid(QuestHandlerSubSystem))
 	{
-		QuestHandlerSubSystem->BroadcastToEventReceivers(ParentQuestAsset, EQuestObjectiveEventType::QuestObjectiveStarted);
+		QuestHandlerSubSystem->BroadcastToEventReceivers(State.ParentQuestAsset, EQuestObjectiveEventType::QuestObjectiveStarted);
 	}
 
-	// Execute objective
-	ParentObjective->ExecuteObjective(QuestAsset);
+	// Execute objective; it may finish and end its run before returning
+	const TSharedRef<FNerveObjectiveRun> Run = State.Run.ToSharedRef();
+	ParentObjective->BeginObjective(*Run);
+
+	// Objectives reached while the quest is paused start out paused
+	if (Run->bRunning && IsValid(Quest) && Quest->AreObjectivesPaused())
+	{
+		ParentObjective->PauseRun(*Run);
+	}
 	
 	UE_LOG(LogTemp, Log, TEXT("ExecuteObjective: Executed objective %s for quest %s"), 
 		*ParentObjective->GetName(), *QuestAsset->QuestTitle);
@@ -1821,22 +3138,73 @@ void UNerveObjectiveRuntimeData::MarkAsTracked(const bool Value) const
 	}
 
 	// Update tracking state
-	ParentObjective->MarkAsTracked(Value);
+	if (State.Run.IsValid())
+	{
+		ParentObjective->TrackRun(*State.Run, Value);
+	}
 	
 	UE_LOG(LogTemp, Log, TEXT("MarkAsTracked: Set tracking to %s for objective %s"), 
 		Value ? TEXT("true") : TEXT("false"), *ParentObjective->GetName());
 }
 
+void UNerveObjectiveRuntimeData::PauseObjective() const
+{
+	if (IsValid(ParentObjective) && State.Run.IsValid())
+	{
+		ParentObjective->PauseRun(*State.Run);
+	}
+}
+
+void UNerveObjectiveRuntimeData::ResumeObjective() const
+{
+	if (IsValid(ParentObjective) && State.Run.IsValid())
+	{
+		ParentObjective->ResumeRun(*State.Run);
+	}
+}
+
+void UNerveObjectiveRuntimeData::ForceComplete() const
+{
+	if (IsValid(ParentObjective) && State.Run.IsValid())
+	{
+		ParentObjective->FinishRun(*State.Run, true);
+	}
+}
+
+FText UNerveObjectiveRuntimeData::GetDisplayLabel() const
+{
+	if (!IsValid(ParentObjective)) return FText::GetEmpty();
+	if (!State.Run.IsValid()) return ParentObjective->GetObjectiveDisplayLabel();
+
+	FNerveObjectiveRunScope Scope(*State.Run);
+	return ParentObjective->GetObjectiveDisplayLabel();
+}
+
+FText UNerveObjectiveRuntimeData::GetDisplayTip() const
+{
+	if (!IsValid(ParentObjective)) return FText::GetEmpty();
+	if (!State.Run.IsValid()) return ParentObjective->GetObjectiveDisplayTip();
+
+	FNerveObjectiveRunScope Scope(*State.Run);
+	return ParentObjective->GetObjectiveDisplayTip();
+}
+
 TArray<UNerveObjectiveRuntimeData*> UNerveObjectiveRuntimeData::GetOptionalObjectives() const
 {
 	TArray<UNerveObjectiveRuntimeData*> Optionals;
-	if (!IsValid(QuestHandlerSubSystem)) return Optionals;
-	if (!IsValid(ParentQuestAsset)) return Optionals;
+	ForEachOptionalObjective([&Optionals](UNerveObjectiveRuntimeData* Optional)
+	{
+		Optionals.Add(Optional);
+	});
+	return Optionals;
+}
 
-	Optionals = QuestHandlerSubSystem->GetAllOptionalObjectiveForQuest
-	(QuestHandlerSubSystem->GetQuestDataByAsset(ParentQuestAsset), this);
+void UNerveObjectiveRuntimeData::ForEachOptionalObjective(const TFunctionRef<void(UNerveObjectiveRuntimeData*)> Visitor) const
+{
+	if (!IsValid(QuestHandlerSubSystem)) return;
+	if (!IsValid(State.ParentQuestAsset)) return;
 
-	return Optionals;
+	QuestHandlerSubSystem->ForEachOptionalObjective(QuestHandlerSubSystem->GetQuestDataByAsset(State.ParentQuestAsset), this, Visitor);
 }
 
 void UNerveObjectiveRuntimeData::ObjectiveCompleted(UNerveQuestRuntimeObjectiveBase* Objective)
@@ -1844,13 +3212,18 @@ void UNerveObjectiveRuntimeData::ObjectiveCompleted(UNerveQuestRuntimeObjectiveB
 	// Update state
 	bIsCompleted = true;
 	bHasFailed = false;
+	if (UNerveQuestRuntimeData* Quest = State.OwningQuest.Get())
+	{
+		Quest->UpdateObjectiveState(this);
+	}
 	
 	OnObjectiveCompleted.Broadcast(Objective);
+	OnObjectiveFinishedNative.ExecuteIfBound(this, true);
 
 	// Broadcast event
-	if (IsValid(QuestHandlerSubSystem) && IsValid(ParentQuestAsset))
+	if (IsValid(QuestHandlerSubSystem) && IsValid(State.ParentQuestAsset))
 	{
-		QuestHandlerSubSystem->BroadcastToEventReceivers(ParentQuestAsset, EQuestObjectiveEventType::QuestObjectiveCompleted);
+		QuestHandlerSubSystem->BroadcastToEventReceivers(State.ParentQuestAsset, EQuestObjectiveEventType::QuestObjectiveCompleted);
 	}
 	
 	UE_LOG(LogTemp, Log, TEXT("ObjectiveCompleted: Objective %s completed"), *Objective->GetName());
@@ -1861,14 +3234,19 @@ void UNerveObjectiveRuntimeData::ObjectiveFailed(UNerveQuestRuntimeObjectiveBase
 	// Update state
 	bIsCompleted = false;
 	bHasFailed = true;
+	if (UNerveQuestRuntimeData* Quest = State.OwningQuest.Get())
+	{
+		Quest->UpdateObjectiveState(this);
+	}
 
 	// Broadcast failure
 	OnObjectiveFailed.Broadcast(Objective);
+	OnObjectiveFinishedNative.ExecuteIfBound(this, false);
 
 	// Broadcast event
-	if (IsValid(QuestHandlerSubSystem) && IsValid(ParentQuestAsset))
+	if (IsValid(QuestHandlerSubSystem) && IsValid(State.ParentQuestAsset))
 	{
-		QuestHandlerSubSystem->BroadcastToEventReceivers(ParentQuestAsset, EQuestObjectiveEventType::QuestObjectiveFailed);
+		QuestHandlerSubSystem->BroadcastToEventReceivers(State.ParentQuestAsset, EQuestObjectiveEventType::QuestObjectiveFailed);
 	}
 	
 	UE_LOG(LogTemp, Log, TEXT("ObjectiveFailed: Objective %s failed"), *Objective->GetName());
@@ -1877,16 +3255,89 @@ void UNerveObjectiveRuntimeData::ObjectiveFailed(UNerveQuestRuntimeObjectiveBase
 void UNerveObjectiveRuntimeData::ObjectiveProgress(UNerveQuestRuntimeObjectiveBase* ObjectiveBase, const float NewProgressValue, const float MaxProgressValue)
 {
 	// Validate input
-	if (!IsValid(TrackingWidget))
+	if (!IsValid(State.TrackingWidget))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ObjectiveProgress: Invalid tracking widget"));
+		UE_LOG(LogTemp, Verbose, TEXT("ObjectiveProgress: No tracking widget for objective %s"), ObjectiveBase ? *ObjectiveBase->GetName() : TEXT("Unknown"));
 		return;
 	}
 
+	// Keep only the latest value; the subsystem delivers it once per frame
+	State.PendingProgress = NewProgressValue;
+	State.PendingMaxProgress = MaxProgressValue;
+	State.bProgressHeldBack = false;
+
+	if (!State.bProgressPending && IsValid(QuestHandlerSubSystem))
+	{
+		State.bProgressPending = true;
+		QuestHandlerSubSystem->QueueProgressDelivery(this);
+	}
+}
+
+void UNerveObjectiveRuntimeData::HandleRunFinished(FNerveObjectiveRun& Run, const bool bCompleted)
+{
+	if (&Run != State.Run.Get()) return;
+
+	if (bCompleted)
+	{
+		ObjectiveCompleted(ParentObjective);
+	}
+	else
+	{
+		ObjectiveFailed(ParentObjective);
+	}
+}
+
+void UNerveObjectiveRuntimeData::HandleRunProgress(FNerveObjectiveRun& Run, const float NewProgressValue, const float MaxProgressValue)
+{
+	if (&Run != State.Run.Get()) return;
+	ObjectiveProgress(ParentObjective, NewProgressValue, MaxProgressValue);
+}
+
+bool UNerveObjectiveRuntimeData::DeliverPendingProgress(const float MinDeliveryDelta)
+{
+	if (!State.bProgressPending) return false;
+
+	if (!IsValid(State.TrackingWidget))
+	{
+		State.bProgressPending = false;
+		return false;
+	}
+
+	const bool bMaxChanged = !FMath::IsNearlyEqual(State.PendingMaxProgress, State.DeliveredMaxProgress);
+	const bool bReachedEnd = State.PendingProgress <= 0.0f || State.PendingProgress >= State.PendingMaxProgress;
+
+	if (!bMaxChanged && FMath::IsNearlyEqual(State.PendingProgress, State.DeliveredProgress))
+	{
+		State.bProgressPending = false;
+		State.bProgressHeldBack = false;
+		return false;
+	}
+
+	// Hold back changes too small to show, unless they reach either end of the bar or no newer value came for a frame
+	if (!bMaxChanged && !bReachedEnd && !State.bProgressHeldBack)
+	{
+		const float SafeMax = FMath::Max(State.PendingMaxProgress, UE_KINDA_SMALL_NUMBER);
+		const float NormalizedDelta = FMath::Abs(State.PendingProgress - State.DeliveredProgress) / SafeMax;
+		if (NormalizedDelta < MinDeliveryDelta)
+		{
+			State.bProgressHeldBack = true;
+			return true;
+		}
+	}
+
+	State.bProgressPending = false;
+	State.bProgressHeldBack = false;
+
 	// Update progress
-	TrackingWidget->SetCurrent(NewProgressValue);
-	TrackingWidget->SetMax(MaxProgressValue);
-	
-	UE_LOG(LogTemp, Log, TEXT("ObjectiveProgress: Updated progress for objective %s to %f/%f"), 
-	*ObjectiveBase->GetName(), NewProgressValue, MaxProgressValue);
-}
\ No newline at end of file
+	if (bMaxChanged)
+	{
+		State.TrackingWidget->SetMax(State.PendingMaxProgress);
+		State.DeliveredMaxProgress = State.PendingMaxProgress;
+	}
+	State.TrackingWidget->SetCurrent(State.PendingProgress);
+	State.DeliveredProgress = State.PendingProgress;
+
+	UE_LOG(LogTemp, Verbose, TEXT("DeliverPendingProgress: Updated progress for objective %s to %f/%f"),
+	ParentObjective ? *ParentObjective->GetName() : TEXT("Unknown"), State.DeliveredProgress, State.DeliveredMaxProgress);
+	return false;
+}
@@ -0,0 +1,446 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#include "Subsystem/NerveQuestTargetSubsystem.h"
+#include "Setting/NerveQuestRuntimeSetting.h"
+#include "GameplayTagAssetInterface.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+void UNerveQuestTargetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    const UNerveQuestRuntimeSetting* Settings = GetDefault<UNerveQuestRuntimeSetting>();
+    CellSize = FMath::Max(static_cast<double>(Settings->QuestTargetCellSize), 100.0);
+
+    for (const TSoftClassPtr<AActor>& TargetClass : Settings->QuestTargetClasses)
+    {
+        if (UClass* LoadedClass = TargetClass.LoadSynchronous())
+        {
+            TargetClasses.AddUnique(LoadedClass);
+        }
+    }
+
+    UWorld* World = GetWorld();
+    if (!IsValid(World))
+    {
+        UE_LOG(LogTemp, Error, TEXT("UNerveQuestTargetSubsystem::Initialize - Invalid World"));
+        return;
+    }
+
+    ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UNerveQuestTargetSubsystem::HandleActorSpawned));
+    ActorDestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &UNerveQuestTargetSubsystem::HandleActorDestroyed));
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UNerveQuestTargetSubsystem::HandleLevelAdded);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UNerveQuestTargetSubsystem::HandleLevelRemoved);
+}
+
+void UNerveQuestTargetSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+        World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+    }
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+    Watchers.Empty();
+    Entries.Empty();
+    ActorsByClass.Empty();
+    ActorsByTag.Empty();
+    ActorsByCell.Empty();
+    MovableActors.Empty();
+    TargetClasses.Empty();
+    TargetClassCache.Empty();
+
+    Super::Deinitialize();
+}
+
+void UNerveQuestTargetSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Actors placed in the loaded levels were never "spawned"; only the target classes are walked
+    for (const TWeakObjectPtr<UClass>& TargetClass : TargetClasses)
+    {
+        if (!TargetClass.IsValid()) continue;
+
+        for (TActorIterator<AActor> It(&InWorld, TargetClass.Get()); It; ++It)
+        {
+            IndexActor(*It);
+        }
+    }
+}
+
+bool UNerveQuestTargetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    // Quest targets only matter while playing, including every PIE instance
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UNerveQuestTargetSubsystem* UNerveQuestTargetSubsystem::GetQuestTargetSubsystem(const UObject* WorldContextObject)
+{
+    const UWorld* World = IsValid(WorldContextObject) ? WorldContextObject->GetWorld() : nullptr;
+    return IsValid(World) ? World->GetSubsystem<UNerveQuestTargetSubsystem>() : nullptr;
+}
+
+int32 UNerveQuestTargetSubsystem::CountActorsOfClass(const TSubclassOf<AActor> ActorClass, const FGameplayTag Tag) const
+{
+    if (!IsValid(ActorClass)) return 0;
+
+    int32 Count = 0;
+    for (const TPair<TWeakObjectPtr<UClass>, FNerveQuestTargetSet>& ClassPair : ActorsByClass)
+    {
+        const UClass* IndexedClass = ClassPair.Key.Get();
+        if (!IndexedClass || !IndexedClass->IsChildOf(ActorClass)) continue;
+
+        if (!Tag.IsValid())
+        {
+            Count += ClassPair.Value.Num();
+            continue;
+        }
+
+        for (const TWeakObjectPtr<AActor>& Actor : ClassPair.Value)
+        {
+            const FNerveQuestTargetEntry* Entry = Entries.Find(Actor);
+            if (Entry && Entry->Tags.HasTagExact(Tag)) ++Count;
+        }
+    }
+    return Count;
+}
+
+void UNerveQuestTargetSubsystem::GetActorsOfClass(const TSubclassOf<AActor> ActorClass, const FGameplayTag Tag, TArray<AActor*>& OutActors) const
+{
+    OutActors.Reset();
+    if (!IsValid(ActorClass)) return;
+
+    for (const TPair<TWeakObjectPtr<UClass>, FNerveQuestTargetSet>& ClassPair : ActorsByClass)
+    {
+        const UClass* IndexedClass = ClassPair.Key.Get();
+        if (!IndexedClass || !IndexedClass->IsChildOf(ActorClass)) continue;
+
+        for (const TWeakObjectPtr<AActor>& Actor : ClassPair.Value)
+        {
+            if (!Actor.IsValid()) continue;
+            if (Tag.IsValid())
+            {
+                const FNerveQuestTargetEntry* Entry = Entries.Find(Actor);
+                if (!Entry || !Entry->Tags.HasTagExact(Tag)) continue;
+            }
+            OutActors.Add(Actor.Get());
+        }
+    }
+}
+
+void UNerveQuestTargetSubsystem::GetActorsWithTag(const FGameplayTag Tag, TArray<AActor*>& OutActors) const
+{
+    OutActors.Reset();
+
+    const FNerveQuestTargetSet* TaggedActors = ActorsByTag.Find(Tag);
+    if (!TaggedActors) return;
+
+    OutActors.Reserve(TaggedActors->Num());
+    for (const TWeakObjectPtr<AActor>& Actor : *TaggedActors)
+    {
+        if (Actor.IsValid()) OutActors.Add(Actor.Get());
+    }
+}
+
+void UNerveQuestTargetSubsystem::GetActorsInRadius(const FVector& Center, const float Radius, const TSubclassOf<AActor> ActorClass, TArray<AActor*>& OutActors) const
+{
+    OutActors.Reset();
+    if (Radius < 0.0f) return;
+
+    const FIntVector MinCell = GetCell(Center - FVector(Radius));
+    const FIntVector MaxCell = GetCell(Center + FVector(Radius));
+    const double RadiusSquared = FMath::Square(static_cast<double>(Radius));
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+            {
+                const FNerveQuestTargetSet* CellActors = ActorsByCell.Find(FIntVector(X, Y, Z));
+                if (!CellActors) continue;
+
+                for (const TWeakObjectPtr<AActor>& WeakActor : *CellActors)
+                {
+                    AActor* Actor = WeakActor.Get();
+                    if (!Actor) continue;
+                    if (ActorClass && !Actor->IsA(ActorClass)) continue;
+                    if (FVector::DistSquared(Actor->GetActorLocation(), Center) > RadiusSquared) continue;
+                    OutActors.Add(Actor);
+                }
+            }
+        }
+    }
+
+    // Movable targets have no reliable cell, check where they are now
+    for (const TWeakObjectPtr<AActor>& WeakActor : MovableActors)
+    {
+        AActor* Actor = WeakActor.Get();
+        if (!Actor) continue;
+        if (ActorClass && !Actor->IsA(ActorClass)) continue;
+        if (FVector::DistSquared(Actor->GetActorLocation(), Center) > RadiusSquared) continue;
+        OutActors.Add(Actor);
+    }
+}
+
+void UNerveQuestTargetSubsystem::RefreshActor(AActor* Actor)
+{
+    if (!IsValid(Actor)) return;
+
+    FNerveQuestTargetEntry* Entry = Entries.Find(Actor);
+    if (!Entry)
+    {
+        IndexActor(Actor);
+        return;
+    }
+
+    const TWeakObjectPtr<AActor> WeakActor(Actor);
+
+    const FIntVector NewCell = GetCell(Actor->GetActorLocation());
+    if (!Entry->bMovable && NewCell != Entry->Cell)
+    {
+        if (FNerveQuestTargetSet* OldCell = ActorsByCell.Find(Entry->Cell))
+        {
+            OldCell->Remove(WeakActor);
+            if (OldCell->IsEmpty()) ActorsByCell.Remove(Entry->Cell);
+        }
+        ActorsByCell.FindOrAdd(NewCell).Add(WeakActor);
+        Entry->Cell = NewCell;
+    }
+
+    FGameplayTagContainer OwnedTags;
+    if (const IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Actor))
+    {
+        TagInterface->GetOwnedGameplayTags(OwnedTags);
+    }
+    const FGameplayTagContainer NewTags = OwnedTags.GetGameplayTagParents();
+    if (NewTags == Entry->Tags) return;
+
+    for (const FGameplayTag& Tag : Entry->Tags)
+    {
+        if (NewTags.HasTagExact(Tag)) continue;
+        if (FNerveQuestTargetSet* TaggedActors = ActorsByTag.Find(Tag))
+        {
+            TaggedActors->Remove(WeakActor);
+            if (TaggedActors->IsEmpty()) ActorsByTag.Remove(Tag);
+        }
+    }
+    for (const FGameplayTag& Tag : NewTags)
+    {
+        ActorsByTag.FindOrAdd(Tag).Add(WeakActor);
+    }
+    Entry->Tags = NewTags;
+}
+
+void UNerveQuestTargetSubsystem::RegisterTargetClass(const TSubclassOf<AActor> ActorClass)
+{
+    if (!IsValid(ActorClass) || IsTargetClass(ActorClass)) return;
+
+    TargetClasses.Add(ActorClass.Get());
+    TargetClassCache.Reset();
+
+    // Pick up what is already there; later spawns and streamed levels are indexed as they come
+    UWorld* World = GetWorld();
+    if (!IsValid(World) || !World->HasBegunPlay()) return;
+
+    for (TActorIterator<AActor> It(World, ActorClass); It; ++It)
+    {
+        IndexActor(*It);
+    }
+}
+
+bool UNerveQuestTargetSubsystem::IsTargetClass(const UClass* ActorClass) const
+{
+    if (!ActorClass) return false;
+
+    if (const bool* bCached = TargetClassCache.Find(ActorClass))
+    {
+        return *bCached;
+    }
+
+    bool bIsTarget = false;
+    for (const TWeakObjectPtr<UClass>& TargetClass : TargetClasses)
+    {
+        if (TargetClass.IsValid() && ActorClass->IsChildOf(TargetClass.Get()))
+        {
+            bIsTarget = true;
+            break;
+        }
+    }
+    TargetClassCache.Add(ActorClass, bIsTarget);
+    return bIsTarget;
+}
+
+int32 UNerveQuestTargetSubsystem::AddWatcher(const TSubclassOf<AActor> ActorClass, const FGameplayTag Tag, FNerveQuestTargetChanged Callback)
+{
+    if (!IsValid(ActorClass) || !Callback.IsBound())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UNerveQuestTargetSubsystem::AddWatcher - Invalid class or unbound callback"));
+        return INDEX_NONE;
+    }
+
+    RegisterTargetClass(ActorClass);
+
+    const int32 Handle = NextWatcherHandle++;
+    FNerveQuestTargetWatcher& Watcher = Watchers.Add(Handle);
+    Watcher.ActorClass = ActorClass.Get();
+    Watcher.Tag = Tag;
+    Watcher.Callback = MoveTemp(Callback);
+    return Handle;
+}
+
+void UNerveQuestTargetSubsystem::RemoveWatcher(const int32 WatcherHandle)
+{
+    Watchers.Remove(WatcherHandle);
+}
+
+bool UNerveQuestTargetSubsystem::ActorMatches(const AActor* Actor, const UClass* ActorClass, const FGameplayTag& Tag) const
+{
+    if (!Actor || !ActorClass || !Actor->IsA(ActorClass)) return false;
+    if (!Tag.IsValid()) return true;
+
+    const FNerveQuestTargetEntry* Entry = Entries.Find(MakeWeakObjectPtr(const_cast<AActor*>(Actor)));
+    return Entry && Entry->Tags.HasTagExact(Tag);
+}
+
+void UNerveQuestTargetSubsystem::IndexActor(AActor* Actor)
+{
+    if (!IsValid(Actor) || Actor->IsTemplate() || !IsTargetClass(Actor->GetClass())) return;
+
+    const TWeakObjectPtr<AActor> WeakActor(Actor);
+    if (Entries.Contains(WeakActor)) return;
+
+    FNerveQuestTargetEntry& Entry = Entries.Add(WeakActor);
+    Entry.ActorClass = Actor->GetClass();
+    Entry.Cell = GetCell(Actor->GetActorLocation());
+    Entry.bMovable = Actor->IsRootComponentMovable();
+
+    FGameplayTagContainer OwnedTags;
+    if (const IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Actor))
+    {
+        TagInterface->GetOwnedGameplayTags(OwnedTags);
+    }
+    Entry.Tags = OwnedTags.GetGameplayTagParents();
+
+    ActorsByClass.FindOrAdd(Entry.ActorClass).Add(WeakActor);
+    if (Entry.bMovable)
+    {
+        MovableActors.Add(WeakActor);
+    }
+    else
+    {
+        ActorsByCell.FindOrAdd(Entry.Cell).Add(WeakActor);
+    }
+    for (const FGameplayTag& Tag : Entry.Tags)
+    {
+        ActorsByTag.FindOrAdd(Tag).Add(WeakActor);
+    }
+
+    NotifyWatchers(Actor, Entry, ENerveQuestTargetChange::Added);
+}
+
+void UNerveQuestTargetSubsystem::UnindexActor(AActor* Actor, const ENerveQuestTargetChange Change)
+{
+    const TWeakObjectPtr<AActor> WeakActor(Actor);
+
+    FNerveQuestTargetEntry Entry;
+    if (!Entries.RemoveAndCopyValue(WeakActor, Entry)) return;
+
+    if (FNerveQuestTargetSet* ClassActors = ActorsByClass.Find(Entry.ActorClass))
+    {
+        ClassActors->Remove(WeakActor);
+        if (ClassActors->IsEmpty()) ActorsByClass.Remove(Entry.ActorClass);
+    }
+    if (Entry.bMovable)
+    {
+        MovableActors.Remove(WeakActor);
+    }
+    else if (FNerveQuestTargetSet* CellActors = ActorsByCell.Find(Entry.Cell))
+    {
+        CellActors->Remove(WeakActor);
+        if (CellActors->IsEmpty()) ActorsByCell.Remove(Entry.Cell);
+    }
+    for (const FGameplayTag& Tag : Entry.Tags)
+    {
+        if (FNerveQuestTargetSet* TaggedActors = ActorsByTag.Find(Tag))
+        {
+            TaggedActors->Remove(WeakActor);
+            if (TaggedActors->IsEmpty()) ActorsByTag.Remove(Tag);
+        }
+    }
+
+    // Watchers still see the tags the actor had, even though it has left the indices
+    NotifyWatchers(Actor, Entry, Change);
+}
+
+void UNerveQuestTargetSubsystem::IndexLevel(const ULevel* Level)
+{
+    if (!Level) return;
+
+    for (AActor* Actor : Level->Actors)
+    {
+        IndexActor(Actor);
+    }
+}
+
+void UNerveQuestTargetSubsystem::NotifyWatchers(AActor* Actor, const FNerveQuestTargetEntry& Entry, const ENerveQuestTargetChange Change)
+{
+    if (Watchers.IsEmpty()) return;
+
+    // Callbacks may add or remove watchers, so walk a snapshot of the handles
+    TArray<int32, TInlineAllocator<16>> Handles;
+    Watchers.GenerateKeyArray(Handles);
+
+    for (const int32 Handle : Handles)
+    {
+        const FNerveQuestTargetWatcher* Watcher = Watchers.Find(Handle);
+        if (!Watcher) continue;
+
+        const UClass* WatchedClass = Watcher->ActorClass.Get();
+        if (!WatchedClass || !Actor->IsA(WatchedClass)) continue;
+        if (Watcher->Tag.IsValid() && !Entry.Tags.HasTagExact(Watcher->Tag)) continue;
+
+        // Copy, the callback may remove its own watcher
+        FNerveQuestTargetChanged Callback = Watcher->Callback;
+        Callback.ExecuteIfBound(Actor, Change);
+    }
+}
+
+FIntVector UNerveQuestTargetSubsystem::GetCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt32(Location.X / CellSize),
+        FMath::FloorToInt32(Location.Y / CellSize),
+        FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+void UNerveQuestTargetSubsystem::HandleActorSpawned(AActor* Actor)
+{
+    IndexActor(Actor);
+}
+
+void UNerveQuestTargetSubsystem::HandleActorDestroyed(AActor* Actor)
+{
+    UnindexActor(Actor, ENerveQuestTargetChange::Destroyed);
+}
+
+void UNerveQuestTargetSubsystem::HandleLevelAdded(ULevel* Level, UWorld* World)
+{
+    if (World != GetWorld() || !World->HasBegunPlay()) return;
+    IndexLevel(Level);
+}
+
+void UNerveQuestTargetSubsystem::HandleLevelRemoved(ULevel* Level, UWorld* World)
+{
+    if (World != GetWorld() || !Level) return;
+
+    for (AActor* Actor : Level->Actors)
+    {
+        if (Actor) UnindexActor(Actor, ENerveQuestTargetChange::Unloaded);
+    }
+}
@@ -0,0 +1,179 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#include "Subsystem/NerveQuestTimerSubsystem.h"
+#include "Setting/NerveQuestRuntimeSetting.h"
+#include "Engine/World.h"
+
+void UNerveQuestTimerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    const double TickLength = GetDefault<UNerveQuestRuntimeSetting>()->QuestTimerResolution;
+    GameTimeWheel.SetTickLength(TickLength);
+    RealTimeWheel.SetTickLength(TickLength);
+    PausedTimeWheel.SetTickLength(TickLength);
+    Scopes.Add(0);
+}
+
+void UNerveQuestTimerSubsystem::Deinitialize()
+{
+    GameTimeWheel.Reset();
+    RealTimeWheel.Reset();
+    PausedTimeWheel.Reset();
+    Scopes.Reset();
+
+    Super::Deinitialize();
+}
+
+void UNerveQuestTimerSubsystem::Tick(const float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    const UWorld* World = GetWorld();
+    if (!IsValid(World)) return;
+
+    // DeltaTime already carries global time dilation; the game clock stands still while paused
+    const bool bPaused = World->IsPaused();
+    const double RealDelta = World->DeltaRealTimeSeconds;
+    if (!bPaused) GameTimeWheel.Advance(DeltaTime);
+    RealTimeWheel.Advance(RealDelta);
+    if (bPaused) PausedTimeWheel.Advance(RealDelta);
+}
+
+bool UNerveQuestTimerSubsystem::IsTickable() const
+{
+    // Parked timers of paused scopes cost nothing until resumed
+    return GameTimeWheel.NumActive() > 0 || RealTimeWheel.NumActive() > 0 || PausedTimeWheel.NumActive() > 0;
+}
+
+TStatId UNerveQuestTimerSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNerveQuestTimerSubsystem, STATGROUP_Tickables);
+}
+
+bool UNerveQuestTimerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    // Quest timers only run while playing, including every PIE instance
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UNerveQuestTimerSubsystem* UNerveQuestTimerSubsystem::GetQuestTimerSubsystem(const UObject* WorldContextObject)
+{
+    const UWorld* World = IsValid(WorldContextObject) ? WorldContextObject->GetWorld() : nullptr;
+    return IsValid(World) ? World->GetSubsystem<UNerveQuestTimerSubsystem>() : nullptr;
+}
+
+void UNerveQuestTimerSubsystem::SetTimer(FNerveQuestTimerHandle& InOutHandle, FSimpleDelegate Callback, const float Delay, const bool bLoop, const ENerveQuestClock Clock, int32 Scope)
+{
+    ClearTimer(InOutHandle);
+
+    if (bLoop && Delay <= 0.0f)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UNerveQuestTimerSubsystem::SetTimer - Looping timers need a positive delay"));
+        return;
+    }
+
+    if (!Scopes.Contains(Scope))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UNerveQuestTimerSubsystem::SetTimer - Timer scope %d does not exist, using the world scope"), Scope);
+        Scope = 0;
+    }
+
+    InOutHandle = GetWheel(Clock).Add(MoveTemp(Callback), Delay, bLoop ? Delay : 0.0, Clock, Scope);
+    InOutHandle.Scope = Scope;
+}
+
+void UNerveQuestTimerSubsystem::ClearTimer(FNerveQuestTimerHandle& InOutHandle)
+{
+    if (!InOutHandle.IsValid()) return;
+
+    GetWheel(InOutHandle.Clock).Cancel(InOutHandle);
+    InOutHandle.Invalidate();
+}
+
+bool UNerveQuestTimerSubsystem::IsTimerActive(const FNerveQuestTimerHandle& Handle) const
+{
+    return Handle.IsValid() && GetWheel(Handle.Clock).IsActive(Handle);
+}
+
+float UNerveQuestTimerSubsystem::GetTimerRemaining(const FNerveQuestTimerHandle& Handle) const
+{
+    if (!Handle.IsValid()) return -1.0f;
+
+    // Remaining time is reported on the scope's own clock; convert with GetScopeTimeDilation if needed
+    return static_cast<float>(GetWheel(Handle.Clock).GetRemaining(Handle));
+}
+
+int32 UNerveQuestTimerSubsystem::GetNumPendingTimers() const
+{
+    return GameTimeWheel.Num() + RealTimeWheel.Num() + PausedTimeWheel.Num();
+}
+
+int32 UNerveQuestTimerSubsystem::CreateTimerScope()
+{
+    const int32 Scope = NextScope++;
+    Scopes.Add(Scope);
+    return Scope;
+}
+
+void UNerveQuestTimerSubsystem::ReleaseTimerScope(const int32 Scope)
+{
+    if (Scope == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UNerveQuestTimerSubsystem::ReleaseTimerScope - The world scope cannot be released"));
+        return;
+    }
+
+    // Safe from a timer callback: the wheels skip cancelled timers that were already due
+    if (Scopes.Remove(Scope) == 0) return;
+    GameTimeWheel.ReleaseGroup(Scope);
+    RealTimeWheel.ReleaseGroup(Scope);
+    PausedTimeWheel.ReleaseGroup(Scope);
+}
+
+void UNerveQuestTimerSubsystem::SetScopePaused(const int32 Scope, const bool bPaused)
+{
+    FNerveQuestTimerScope* TimerScope = Scopes.Find(Scope);
+    if (!TimerScope || TimerScope->bPaused == bPaused) return;
+
+    TimerScope->bPaused = bPaused;
+    GameTimeWheel.SetGroupPaused(Scope, bPaused);
+    RealTimeWheel.SetGroupPaused(Scope, bPaused);
+    PausedTimeWheel.SetGroupPaused(Scope, bPaused);
+}
+
+bool UNerveQuestTimerSubsystem::IsScopePaused(const int32 Scope) const
+{
+    const FNerveQuestTimerScope* TimerScope = Scopes.Find(Scope);
+    return TimerScope && TimerScope->bPaused;
+}
+
+void UNerveQuestTimerSubsystem::SetScopeTimeDilation(const int32 Scope, const float TimeDilation)
+{
+    FNerveQuestTimerScope* TimerScope = Scopes.Find(Scope);
+    if (!TimerScope) return;
+
+    TimerScope->TimeDilation = FMath::Max(TimeDilation, 0.0f);
+    GameTimeWheel.SetGroupTimeScale(Scope, TimerScope->TimeDilation);
+}
+
+float UNerveQuestTimerSubsystem::GetScopeTimeDilation(const int32 Scope) const
+{
+    const FNerveQuestTimerScope* TimerScope = Scopes.Find(Scope);
+    return TimerScope ? TimerScope->TimeDilation : 1.0f;
+}
+
+FNerveQuestTimingWheel& UNerveQuestTimerSubsystem::GetWheel(const ENerveQuestClock Clock)
+{
+    switch (Clock)
+    {
+    case ENerveQuestClock::RealTime: return RealTimeWheel;
+    case ENerveQuestClock::PausedTime: return PausedTimeWheel;
+    default: return GameTimeWheel;
+    }
+}
+
+const FNerveQuestTimingWheel& UNerveQuestTimerSubsystem::GetWheel(const ENerveQuestClock Clock) const
+{
+    return const_cast<UNerveQuestTimerSubsystem*>(this)->GetWheel(Clock);
+}
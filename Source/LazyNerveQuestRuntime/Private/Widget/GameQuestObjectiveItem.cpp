@@ -38,13 +38,13 @@ void UGameQuestObjectiveItem::ConstructObjectiveLook_Implementation()
     // Set objective title
     if (IsValid(GetObjectiveTitleBlock()))
     {
-        if (GetParentPerformingObjective()->ParentObjective->GetObjectiveDisplayLabel().IsEmpty())
+        if (GetParentPerformingObjective()->GetDisplayLabel().IsEmpty())
         {
             GetObjectiveTitleBlock()->SetVisibility(ESlateVisibility::Collapsed);
         }
         else
         {
-            GetObjectiveTitleBlock()->SetText(GetParentPerformingObjective()->ParentObjective->GetObjectiveDisplayLabel());
+            GetObjectiveTitleBlock()->SetText(GetParentPerformingObjective()->GetDisplayLabel());
             GetObjectiveTitleBlock()->SetVisibility(ESlateVisibility::Visible);
         }
     }
@@ -52,7 +52,7 @@ void UGameQuestObjectiveItem::ConstructObjectiveLook_Implementation()
     // Set objective tip/description
     if (IsValid(GetObjectiveTipBlock()))
     {
-        if (GetParentPerformingObjective()->ParentObjective->GetObjectiveDisplayTip().IsEmpty())
+        if (GetParentPerformingObjective()->GetDisplayTip().IsEmpty())
         {
             GetObjectiveTipBlock()->SetVisibility(ESlateVisibility::Collapsed);
         }
@@ -60,11 +60,11 @@ void UGameQuestObjectiveItem::ConstructObjectiveLook_Implementation()
         {
             if (UTextBlock* NormalText = Cast<UTextBlock>(GetObjectiveTipBlock()))
             {
-                NormalText->SetText(GetParentPerformingObjective()->ParentObjective->GetObjectiveDisplayTip());
+                NormalText->SetText(GetParentPerformingObjective()->GetDisplayTip());
             }
             else if (URichTextBlock* RichText = Cast<URichTextBlock>(GetObjectiveTipBlock()))
             {
-                RichText->SetText(GetParentPerformingObjective()->ParentObjective->GetObjectiveDisplayTip());
+                RichText->SetText(GetParentPerformingObjective()->GetDisplayTip());
             }
             GetObjectiveTipBlock()->SetVisibility(ESlateVisibility::Visible);
         }
@@ -0,0 +1,84 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+
+#include "Widget/NerveQuestJournalItem.h"
+#include "Objects/NerveQuest/NerveQuestAsset.h"
+#include "Subsystem/NerveQuestSubsystem.h"
+
+void UNerveQuestJournalItem::Initialize(UNerveQuestRuntimeData* InQuestRuntimeData)
+{
+    if (!IsValid(InQuestRuntimeData)) return;
+
+    QuestRuntimeData = InQuestRuntimeData;
+    QuestSerial = InQuestRuntimeData->GetSerial();
+    InQuestRuntimeData->OnQuestCompleted.AddUniqueDynamic(this, &UNerveQuestJournalItem::OnQuestStateChanged);
+    InQuestRuntimeData->OnQuestFailed.AddUniqueDynamic(this, &UNerveQuestJournalItem::OnQuestStateChanged);
+    InQuestRuntimeData->OnQuestProgressChanged.AddUniqueDynamic(this, &UNerveQuestJournalItem::OnQuestStateChanged);
+    InQuestRuntimeData->OnQuestStatusChanged.AddUniqueDynamic(this, &UNerveQuestJournalItem::OnQuestStateChanged);
+    InQuestRuntimeData->OnQuestTrackingChanged.AddUniqueDynamic(this, &UNerveQuestJournalItem::OnQuestStateChanged);
+
+    Refresh();
+}
+
+void UNerveQuestJournalItem::Uninitialize()
+{
+    if (UNerveQuestRuntimeData* Quest = QuestRuntimeData.Get())
+    {
+        Quest->OnQuestCompleted.RemoveDynamic(this, &UNerveQuestJournalItem::OnQuestStateChanged);
+        Quest->OnQuestFailed.RemoveDynamic(this, &UNerveQuestJournalItem::OnQuestStateChanged);
+        Quest->OnQuestProgressChanged.RemoveDynamic(this, &UNerveQuestJournalItem::OnQuestStateChanged);
+        Quest->OnQuestStatusChanged.RemoveDynamic(this, &UNerveQuestJournalItem::OnQuestStateChanged);
+        Quest->OnQuestTrackingChanged.RemoveDynamic(this, &UNerveQuestJournalItem::OnQuestStateChanged);
+    }
+    QuestRuntimeData = nullptr;
+    OnJournalItemChanged.Clear();
+    OnJournalItemStatusChanged.Clear();
+}
+
+UNerveQuestRuntimeData* UNerveQuestJournalItem::GetQuestRuntimeData() const
+{
+    UNerveQuestRuntimeData* Quest = QuestRuntimeData.Get();
+    return IsValid(Quest) && Quest->IsSameQuestInstance(QuestSerial) ? Quest : nullptr;
+}
+
+void UNerveQuestJournalItem::Refresh()
+{
+    const UNerveQuestRuntimeData* Quest = GetQuestRuntimeData();
+    if (!Quest) return;
+
+    // The asset is cleared on uninitialize, keep the last known one for display
+    if (IsValid(Quest->QuestAsset))
+    {
+        QuestAsset = Quest->QuestAsset;
+    }
+
+    const FString NewTitle = IsValid(QuestAsset) ? QuestAsset->QuestTitle : FString();
+    const ENerveQuestTypes NewType = IsValid(QuestAsset) ? QuestAsset->QuestType : QuestType;
+
+    const bool bChanged = NewTitle != QuestTitle || NewType != QuestType || Quest->QuestStatus != QuestStatus ||
+        Quest->bIsTracked != bIsTracked || !FMath::IsNearlyEqual(Quest->OverallProgress, OverallProgress) ||
+        Quest->GetRemainingSteps() != RemainingSteps;
+
+    const bool bStatusChanged = Quest->QuestStatus != QuestStatus;
+
+    QuestTitle = NewTitle;
+    QuestType = NewType;
+    QuestStatus = Quest->QuestStatus;
+    bIsTracked = Quest->bIsTracked;
+    OverallProgress = Quest->OverallProgress;
+    RemainingSteps = Quest->GetRemainingSteps();
+
+    if (bChanged)
+    {
+        OnJournalItemChanged.Broadcast(this);
+    }
+    if (bStatusChanged)
+    {
+        OnJournalItemStatusChanged.Broadcast(this);
+    }
+}
+
+void UNerveQuestJournalItem::OnQuestStateChanged(UNerveQuestRuntimeData* Quest)
+{
+    Refresh();
+}
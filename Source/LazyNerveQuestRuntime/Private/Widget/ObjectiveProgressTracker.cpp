@@ -3,8 +3,32 @@
 
 #include "Widget/ObjectiveProgressTracker.h"
 
+void UObjectiveProgressTracker::NativeTick(const FGeometry& MyGeometry, const float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	// Nothing to ease when already at the target
+	if (DisplayedCurrent == Current) return;
+
+	DisplayedCurrent = FMath::FInterpTo(DisplayedCurrent, Current, InDeltaTime, ProgressInterpSpeed);
+	if (FMath::IsNearlyEqual(DisplayedCurrent, Current, FMath::Max(Max, 1.0f) * 0.001f))
+	{
+		DisplayedCurrent = Current;
+	}
+	OnDisplayedProgressChanged(DisplayedCurrent, Max);
+}
+
 void UObjectiveProgressTracker::SetCurrent_Implementation(const float NewCurrent)
-{ Current = NewCurrent; }
+{
+	Current = NewCurrent;
+
+	// Snap when not interpolating, or when progress goes backwards (e.g. a restart)
+	if (!bInterpolateProgress || ProgressInterpSpeed <= 0.0f || NewCurrent < DisplayedCurrent)
+	{
+		DisplayedCurrent = Current;
+		OnDisplayedProgressChanged(DisplayedCurrent, Max);
+	}
+}
 
 void UObjectiveProgressTracker::SetMax_Implementation(const float NewMax)
 { Max = NewMax; }
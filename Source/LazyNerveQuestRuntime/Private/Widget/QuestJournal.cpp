@@ -0,0 +1,203 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+
+#include "Widget/QuestJournal.h"
+#include "Components/ListView.h"
+#include "Subsystem/NerveQuestSubsystem.h"
+#include "Widget/NerveQuestJournalItem.h"
+
+void UQuestJournal::NativeConstruct()
+{
+    Super::NativeConstruct();
+
+    const ULocalPlayer* LocalPlayer = GetOwningLocalPlayer();
+    UNerveQuestSubsystem* Subsystem = LocalPlayer ? LocalPlayer->GetSubsystem<UNerveQuestSubsystem>() : nullptr;
+    if (!IsValid(Subsystem))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UQuestJournal::NativeConstruct - Invalid QuestSubsystem"));
+        return;
+    }
+
+    QuestSubsystem = Subsystem;
+    Subsystem->OnQuestAdded.AddUniqueDynamic(this, &UQuestJournal::OnQuestAdded);
+    Subsystem->OnQuestRemoved.AddUniqueDynamic(this, &UQuestJournal::OnQuestRemoved);
+    Subsystem->OnQuestTracked.AddUniqueDynamic(this, &UQuestJournal::OnQuestTrackingChanged);
+    Subsystem->OnQuestUnTracked.AddUniqueDynamic(this, &UQuestJournal::OnQuestTrackingChanged);
+
+    RefreshJournal();
+}
+
+void UQuestJournal::NativeDestruct()
+{
+    if (UNerveQuestSubsystem* Subsystem = QuestSubsystem.Get())
+    {
+        Subsystem->OnQuestAdded.RemoveDynamic(this, &UQuestJournal::OnQuestAdded);
+        Subsystem->OnQuestRemoved.RemoveDynamic(this, &UQuestJournal::OnQuestRemoved);
+        Subsystem->OnQuestTracked.RemoveDynamic(this, &UQuestJournal::OnQuestTrackingChanged);
+        Subsystem->OnQuestUnTracked.RemoveDynamic(this, &UQuestJournal::OnQuestTrackingChanged);
+    }
+    ClearJournalItems();
+    QuestSubsystem = nullptr;
+
+    Super::NativeDestruct();
+}
+
+void UQuestJournal::RefreshJournal()
+{
+    UListView* ListView = GetJournalListView();
+    UNerveQuestSubsystem* Subsystem = QuestSubsystem.Get();
+    if (!IsValid(ListView) || !IsValid(Subsystem)) return;
+
+    ClearJournalItems();
+
+    // Follow every quest so status changes can move items in and out of the filter
+    TArray<UNerveQuestJournalItem*> AllItems;
+    Subsystem->GetJournalItems(AllItems);
+
+    TArray<UNerveQuestJournalItem*> VisibleItems;
+    VisibleItems.Reserve(AllItems.Num());
+    for (UNerveQuestJournalItem* Item : AllItems)
+    {
+        if (!IsValid(Item) || !IsValid(Item->GetQuestAsset())) continue;
+
+        JournalItems.Add(Item->GetQuestAsset(), Item);
+        Item->OnJournalItemStatusChanged.AddUniqueDynamic(this, &UQuestJournal::OnJournalItemStatusChanged);
+        if (PassesFilter(Item))
+        {
+            VisibleItems.Add(Item);
+            ListedItems.Add(Item);
+        }
+    }
+
+    // Only hands data to the list; entry widgets are generated lazily for visible rows
+    ListView->SetListItems(VisibleItems);
+}
+
+void UQuestJournal::AddJournalItem(UNerveQuestJournalItem* Item)
+{
+    if (!IsValid(Item) || !IsValid(Item->GetQuestAsset())) return;
+
+    JournalItems.Add(Item->GetQuestAsset(), Item);
+    Item->OnJournalItemStatusChanged.AddUniqueDynamic(this, &UQuestJournal::OnJournalItemStatusChanged);
+    OnJournalItemStatusChanged(Item);
+}
+
+void UQuestJournal::ClearJournalItems()
+{
+    for (const TPair<TObjectPtr<UNerveQuestAsset>, TObjectPtr<UNerveQuestJournalItem>>& Pair : JournalItems)
+    {
+        if (IsValid(Pair.Value))
+        {
+            Pair.Value->OnJournalItemStatusChanged.RemoveDynamic(this, &UQuestJournal::OnJournalItemStatusChanged);
+        }
+    }
+    JournalItems.Reset();
+    ListedItems.Reset();
+
+    if (UListView* ListView = GetJournalListView())
+    {
+        ListView->ClearListItems();
+    }
+}
+
+void UQuestJournal::SetCategoryFilter(const bool bEnableFilter, const ENerveQuestCategory NewCategory)
+{
+    bFilterByCategory = bEnableFilter;
+    FilterCategory = NewCategory;
+    RefreshJournal();
+}
+
+bool UQuestJournal::PassesFilter(const UNerveQuestJournalItem* Item) const
+{
+    return IsValid(Item) && (!bFilterByCategory || Item->GetQuestStatus() == FilterCategory);
+}
+
+void UQuestJournal::OnQuestAdded(UNerveQuestAsset* Quest)
+{
+    UListView* ListView = GetJournalListView();
+    UNerveQuestSubsystem* Subsystem = QuestSubsystem.Get();
+    if (!IsValid(ListView) || !IsValid(Subsystem)) return;
+
+    AddJournalItem(Subsystem->GetJournalItemForQuest(Quest));
+}
+
+void UQuestJournal::OnQuestRemoved(UNerveQuestAsset* Quest)
+{
+    // The subsystem has already uninitialized the item, which unbound us from it
+    TObjectPtr<UNerveQuestJournalItem> Item;
+    if (!JournalItems.RemoveAndCopyValue(Quest, Item)) return;
+
+    UListView* ListView = GetJournalListView();
+    if (ListedItems.Remove(Item) > 0 && IsValid(ListView))
+    {
+        ListView->RemoveItem(Item);
+    }
+}
+
+void UQuestJournal::OnJournalItemStatusChanged(UNerveQuestJournalItem* Item)
+{
+    UListView* ListView = GetJournalListView();
+    if (!IsValid(ListView) || !IsValid(Item)) return;
+
+    const bool bListed = ListedItems.Contains(Item);
+    if (PassesFilter(Item) && !bListed)
+    {
+        ListedItems.Add(Item);
+        ListView->AddItem(Item);
+    }
+    else if (!PassesFilter(Item) && bListed)
+    {
+        ListedItems.Remove(Item);
+        ListView->RemoveItem(Item);
+    }
+}
+
+void UQuestJournal::OnQuestTrackingChanged(UNerveQuestAsset* Quest)
+{
+    UNerveQuestSubsystem* Subsystem = QuestSubsystem.Get();
+    if (!IsValid(Subsystem)) return;
+
+    if (UNerveQuestJournalItem* Item = Subsystem->GetJournalItemForQuest(Quest))
+    {
+        Item->Refresh();
+    }
+}
+
+UListView* UQuestJournal::GetJournalListView_Implementation()
+{ return nullptr; }
+
+void UQuestJournalEntry::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+    IUserObjectListEntry::NativeOnListItemObjectSet(ListItemObject);
+
+    if (IsValid(JournalItem))
+    {
+        JournalItem->OnJournalItemChanged.RemoveDynamic(this, &UQuestJournalEntry::HandleJournalItemChanged);
+    }
+
+    JournalItem = Cast<UNerveQuestJournalItem>(ListItemObject);
+    if (!IsValid(JournalItem)) return;
+
+    JournalItem->OnJournalItemChanged.AddUniqueDynamic(this, &UQuestJournalEntry::HandleJournalItemChanged);
+    OnJournalItemUpdated(JournalItem);
+}
+
+void UQuestJournalEntry::NativeOnEntryReleased()
+{
+    IUserObjectListEntry::NativeOnEntryReleased();
+
+    if (IsValid(JournalItem))
+    {
+        JournalItem->OnJournalItemChanged.RemoveDynamic(this, &UQuestJournalEntry::HandleJournalItemChanged);
+    }
+    JournalItem = nullptr;
+}
+
+void UQuestJournalEntry::OnJournalItemUpdated_Implementation(UNerveQuestJournalItem* Item)
+{
+}
+
+void UQuestJournalEntry::HandleJournalItemChanged(UNerveQuestJournalItem* Item)
+{
+    OnJournalItemUpdated(Item);
+}
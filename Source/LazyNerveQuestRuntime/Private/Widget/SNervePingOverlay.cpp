@@ -0,0 +1,85 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#include "Widget/SNervePingOverlay.h"
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/SlateBrush.h"
+
+void SNervePingOverlay::Construct(const FArguments& InArgs)
+{
+    MarkerBrush = InArgs._MarkerBrush;
+    EdgeMarkerBrush = InArgs._EdgeMarkerBrush ? InArgs._EdgeMarkerBrush : InArgs._MarkerBrush;
+    LabelFont = InArgs._LabelFont;
+    LabelColor = InArgs._LabelColor;
+    OccludedTint = InArgs._OccludedTint;
+
+    // Purely visual, never takes input
+    SetVisibility(EVisibility::HitTestInvisible);
+    SetCanTick(false);
+}
+
+void SNervePingOverlay::CommitItems()
+{
+    Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SNervePingOverlay::ClearItems()
+{
+    if (Items.IsEmpty()) return;
+
+    Items.Reset();
+    Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+int32 SNervePingOverlay::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+    FSlateWindowElementList& OutDrawElements, const int32 LayerId, const FWidgetStyle& InWidgetStyle, const bool bParentEnabled) const
+{
+    if (Items.IsEmpty() || !MarkerBrush) return LayerId;
+
+    const FVector2D LocalSize = AllottedGeometry.GetLocalSize();
+    const FLinearColor WidgetTint = InWidgetStyle.GetColorAndOpacityTint();
+    const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+
+    // Markers share one layer and labels the next, so each batches into a single draw
+    const int32 MarkerLayer = LayerId;
+    const int32 LabelLayer = LayerId + 1;
+
+    for (const FNervePingOverlayItem& Item : Items)
+    {
+        const FSlateBrush* Brush = Item.bOnScreen ? MarkerBrush : EdgeMarkerBrush;
+        const FVector2D BrushSize = Brush->ImageSize;
+        const FVector2D Center = Item.NormalizedPosition * LocalSize;
+        const FLinearColor ItemTint = Item.bOccluded ? WidgetTint * OccludedTint : WidgetTint;
+
+        FSlateDrawElement::MakeBox(
+            OutDrawElements,
+            MarkerLayer,
+            AllottedGeometry.ToPaintGeometry(BrushSize, FSlateLayoutTransform(Center - BrushSize * 0.5)),
+            Brush,
+            ESlateDrawEffect::None,
+            Brush->GetTint(InWidgetStyle) * ItemTint);
+
+        if (Item.Label.IsEmpty()) continue;
+
+        const FVector2D LabelSize = FontMeasure->Measure(Item.Label, LabelFont);
+        const FVector2D LabelOffset(Center.X - LabelSize.X * 0.5, Center.Y + BrushSize.Y * 0.5);
+
+        FSlateDrawElement::MakeText(
+            OutDrawElements,
+            LabelLayer,
+            AllottedGeometry.ToPaintGeometry(LabelSize, FSlateLayoutTransform(LabelOffset)),
+            Item.Label,
+            LabelFont,
+            ESlateDrawEffect::None,
+            LabelColor * ItemTint);
+    }
+
+    return LabelLayer;
+}
+
+FVector2D SNervePingOverlay::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+    // Fills whatever slot the viewport gives it
+    return FVector2D::ZeroVector;
+}
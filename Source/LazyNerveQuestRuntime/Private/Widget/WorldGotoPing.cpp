@@ -9,33 +9,18 @@ UTextBlock* UWorldGotoPing::GetDistanceTextBlock_Implementation()
 void UWorldGotoPing::OnScreenStateChanged_Implementation(bool bIsOnScreen)
 {}
 
+void UWorldGotoPing::OnClusterCountChanged_Implementation(int32 ClusterCount)
+{}
+
+void UWorldGotoPing::OnOcclusionChanged_Implementation(bool bIsOccluded)
+{}
+
 void UWorldGotoPing::UpdateDistance(const float NewDistance, const ENerveDistanceConversionMethod ConversionMethod)
 {
 	if (!IsValid(GetDistanceTextBlock())) return;
 
-	// Determine the unit string based on the conversion method
-	FString UnitString;
-	switch (ConversionMethod)
-	{
-		case ENerveDistanceConversionMethod::Centimeter:
-			UnitString = TEXT(" cm");
-			break;
-		case ENerveDistanceConversionMethod::Meter:
-			UnitString = TEXT(" m");
-			break;
-		case ENerveDistanceConversionMethod::Kilometer:
-			UnitString = TEXT(" km");
-			break;
-		case ENerveDistanceConversionMethod::Foot:
-			UnitString = TEXT(" ft");
-			break;
-		default:
-			UnitString = TEXT(""); // Fallback in case of invalid enum value
-			break;
-	}
-
 	// Format the distance with the unit and update the text block
-	const FString DistanceString = FString::Printf(TEXT("%.0f%s"), NewDistance, *UnitString);
+	const FString DistanceString = FormatPingDistance(NewDistance, ConversionMethod);
 	GetDistanceTextBlock()->SetText(FText::FromString(DistanceString));
 }
 
@@ -46,4 +31,22 @@ void UWorldGotoPing::SetIsOnScreen(const bool bIsOnScreen)
 		bCurrentlyOnScreen = bIsOnScreen;
 		OnScreenStateChanged(bIsOnScreen);
 	}
-}
\ No newline at end of file
+}
+
+void UWorldGotoPing::SetClusterCount(const int32 ClusterCount)
+{
+	if (CurrentClusterCount != ClusterCount)
+	{
+		CurrentClusterCount = ClusterCount;
+		OnClusterCountChanged(ClusterCount);
+	}
+}
+
+void UWorldGotoPing::SetIsOccluded(const bool bIsOccluded)
+{
+	if (bCurrentlyOccluded != bIsOccluded)
+	{
+		bCurrentlyOccluded = bIsOccluded;
+		OnOcclusionChanged(bIsOccluded);
+	}
+}
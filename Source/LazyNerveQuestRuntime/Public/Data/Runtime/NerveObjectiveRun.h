@@ -0,0 +1,94 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class FReferenceCollector;
+class ULocalPlayer;
+class UNerveObjectiveModifier;
+class UNerveQuestAsset;
+class UNerveQuestRuntimeObjectiveBase;
+struct FNerveObjectiveRun;
+
+/** Native end-of-run callback for the owner of a run; bCompleted is false on failure */
+DECLARE_DELEGATE_TwoParams(FNerveObjectiveRunFinished, FNerveObjectiveRun& /*Run*/, bool /*bCompleted*/);
+
+/** Native progress callback for the owner of a run */
+DECLARE_DELEGATE_ThreeParams(FNerveObjectiveRunProgress, FNerveObjectiveRun& /*Run*/, float /*NewValue*/, float /*MaxValue*/);
+
+/** Per-run state of one modifier, e.g. a pending deadline; created on first use by the modifier */
+struct FNerveModifierRunState
+{
+    virtual ~FNerveModifierRunState() = default;
+};
+
+/**
+ * One execution of an objective node for one quest. Objective nodes belong to the quest graph and are shared by
+ * every quest running that graph, template instances included, so everything that differs between two runs of
+ * the same node lives here: the quest whose parameter block the node's bindings read, world and player, timer
+ * scope, counters and handles. Nodes with state of their own extend it and create it from MakeRun.
+ * Not reflected; objects a run has to keep alive are reported from AddReferencedObjects by the run's owner.
+ */
+struct LAZYNERVEQUESTRUNTIME_API FNerveObjectiveRun : public TSharedFromThis<FNerveObjectiveRun>
+{
+    virtual ~FNerveObjectiveRun() = default;
+
+    /** Reports the objects the run keeps alive; called by whoever owns the run */
+    virtual void AddReferencedObjects(FReferenceCollector& Collector, const UObject* Referencer) {}
+
+    /** Shared node this run executes */
+    TWeakObjectPtr<UNerveQuestRuntimeObjectiveBase> Objective;
+
+    /** Quest the run belongs to; parameter bindings are resolved against its parameter block */
+    TWeakObjectPtr<UNerveQuestAsset> QuestAsset;
+
+    TWeakObjectPtr<const UObject> WorldContextObject;
+
+    /** Local player whose quest subsystem runs the objective */
+    TWeakObjectPtr<ULocalPlayer> OwningLocalPlayer;
+
+    /** Quest timer scope, so the run's timers pause and dilate with its quest */
+    int32 TimerScope = 0;
+
+    /** True between BeginObjective and completion, failure or EndObjective */
+    bool bRunning = false;
+
+    /** Set by EndObjective, so cleanup runs once per start */
+    bool bEnded = false;
+
+    /** True while the node's modifiers are attached to this run */
+    bool bModifiersActive = false;
+
+    /** Set when a modifier failed the run, so late completion or progress is ignored */
+    bool bFailedByModifier = false;
+
+    /** State the node's modifiers keep for this run */
+    TMap<const UNerveObjectiveModifier*, TUniquePtr<FNerveModifierRunState>> ModifierStates;
+
+    /** Fired once when the run completes or fails */
+    FNerveObjectiveRunFinished OnFinished;
+
+    FNerveObjectiveRunProgress OnProgress;
+};
+
+/**
+ * Makes a run the node's active run for the lifetime of the scope, so the node's Blueprint events, getters and
+ * CompleteObjective act on it. Restores the previous active run on exit and keeps the run alive meanwhile.
+ */
+struct LAZYNERVEQUESTRUNTIME_API FNerveObjectiveRunScope
+{
+    explicit FNerveObjectiveRunScope(FNerveObjectiveRun& Run);
+    ~FNerveObjectiveRunScope();
+
+    FNerveObjectiveRunScope(const FNerveObjectiveRunScope&) = delete;
+    FNerveObjectiveRunScope& operator=(const FNerveObjectiveRunScope&) = delete;
+
+private:
+    UNerveQuestRuntimeObjectiveBase* Objective = nullptr;
+    TSharedRef<FNerveObjectiveRun> PinnedRun;
+    FNerveObjectiveRun* PreviousRun = nullptr;
+};
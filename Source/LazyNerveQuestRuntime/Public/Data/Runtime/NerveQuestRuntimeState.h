@@ -0,0 +1,167 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/ObjectPtr.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UNerveObjectiveRuntimeData;
+class UNerveJoinObjective;
+class UNerveQuestAsset;
+class UNerveQuestRuntimeObjectiveBase;
+class UNerveQuestRuntimeData;
+class UNerveQuestTimerSubsystem;
+class UObjectiveProgressTracker;
+struct FNerveObjectiveRun;
+
+/** One pass through a fork: every branch it split into carries the same group */
+struct FNerveQuestForkGroup
+{
+    int32 Id = INDEX_NONE;
+
+    /** Fork node or multi-link pin that opened the group; only compared, never dereferenced */
+    const UObject* Source = nullptr;
+};
+
+/** One branch of execution through a quest graph; a quest runs one per concurrent objective */
+struct FNerveQuestBranch
+{
+    int32 Id = INDEX_NONE;
+
+    /** Objective the branch waits on, null while it moves between nodes */
+    TObjectPtr<UNerveObjectiveRuntimeData> Objective;
+
+    /** Forks the branch went through without reaching their join yet, innermost last */
+    TArray<FNerveQuestForkGroup, TInlineAllocator<2>> ForkGroups;
+};
+
+/** A join node compiled once per quest */
+struct FNerveQuestJoinInfo
+{
+    /** Branches connected to the join's input */
+    int32 NumBranches = 1;
+
+    /** Fork nodes and multi-link pins whose branches meet again at this join */
+    TArray<const UObject*, TInlineAllocator<2>> ClosedForks;
+};
+
+/**
+ * Internal state of a UNerveQuestRuntimeData. Not reflected, so none of it is traversed by the garbage collector:
+ * objectives are kept alive by the quest subsystem, which reports them from its AddReferencedObjects.
+ */
+struct FNerveQuestRuntimeState
+{
+    /** Every objective of the quest, in graph order */
+    TArray<TObjectPtr<UNerveObjectiveRuntimeData>> Objectives;
+
+    /** Completion and failure of every objective, indexed like Objectives */
+    TBitArray<> CompletedObjectives;
+    TBitArray<> FailedObjectives;
+
+    /** Set bits of CompletedObjectives and FailedObjectives */
+    int32 NumCompletedObjectives = 0;
+    int32 NumFailedObjectives = 0;
+
+    /** Summed ObjectiveWeight of all objectives and of the completed ones */
+    float TotalObjectiveWeight = 0.0f;
+    float CompletedObjectiveWeight = 0.0f;
+
+    /**
+     * Objective graph compiled to indices, with forks and joins flattened away: the objectives following
+     * objective i are ObjectiveSuccessors[SuccessorOffsets[i]] up to ObjectiveSuccessors[SuccessorOffsets[i + 1]]
+     */
+    TArray<int32> SuccessorOffsets;
+    TArray<int32> ObjectiveSuccessors;
+
+    /** Incomplete objectives still ahead of the running branches, theirs included, as last reported */
+    int32 RemainingSteps = 0;
+
+    /** Running branches each objective is reachable from, indexed like Objectives */
+    TArray<int32> ReachCounts;
+
+    /** Incomplete objectives with a reach count above zero, updated as single branches move */
+    int32 ReachableSteps = 0;
+
+    /** Scratch of the reach walk, kept to avoid allocating on every branch move */
+    TBitArray<> ReachVisited;
+    TArray<int32> ReachScratch;
+
+    /** Running branches, oldest first */
+    TArray<FNerveQuestBranch> Branches;
+
+    /** Every join node of the graph */
+    TMap<const UNerveJoinObjective*, FNerveQuestJoinInfo> Joins;
+
+    /** Branches that reached a join node and wait for the others, by join and the fork group it closes */
+    TMap<TPair<const UNerveJoinObjective*, int32>, int32> JoinArrivals;
+
+    int32 NextBranchId = 1;
+    int32 NextForkGroup = 1;
+
+    /** Timer subsystem of the world the quest's timer scope lives in */
+    TWeakObjectPtr<UNerveQuestTimerSubsystem> TimerSubsystem;
+
+    /** Timer scope shared by every objective of this quest, zero until first used */
+    int32 TimerScope = 0;
+
+    /** Set by PauseQuest */
+    bool bIsPaused = false;
+
+    /** Whether the objectives are currently paused, on their own or through the subsystem */
+    bool bObjectivesPaused = false;
+
+    float TimeDilation = 1.0f;
+
+    /** True while the instance waits in the subsystem's pool */
+    bool bIsPooled = false;
+
+    /** Bumped every time the instance is reset for reuse; never reset itself */
+    int32 Serial = 0;
+};
+
+/**
+ * Internal state of a UNerveObjectiveRuntimeData. Not reflected; the tracker widget is reported by the quest subsystem,
+ * the quest asset is always the one of a live quest and stays alive through it.
+ */
+struct FNerveObjectiveRuntimeState
+{
+    /** Progress tracking widget */
+    TObjectPtr<UObjectiveProgressTracker> TrackingWidget;
+
+    /** Asset of the quest the objective was last executed for */
+    TObjectPtr<UNerveQuestAsset> ParentQuestAsset;
+
+    /** This quest's run of the shared objective node, from ExecuteObjective until Uninitialize */
+    TSharedPtr<FNerveObjectiveRun> Run;
+
+    /** Quest this objective belongs to; pooled instances are not outered to it */
+    TWeakObjectPtr<UNerveQuestRuntimeData> OwningQuest;
+
+    /** Latest progress received this frame, not yet delivered to the tracker */
+    float PendingProgress = 0.0f;
+    float PendingMaxProgress = 1.0f;
+
+    /** Progress last pushed to the tracker widget */
+    float DeliveredProgress = 0.0f;
+    float DeliveredMaxProgress = 1.0f;
+
+    /** Whether this objective is queued on the subsystem for delivery */
+    bool bProgressPending = false;
+
+    /** Pending progress was too small to deliver last flush; delivered on the next one unless it changes */
+    bool bProgressHeldBack = false;
+
+    /** True while the instance waits in the subsystem's pool */
+    bool bIsPooled = false;
+
+    /** Set once the objective has been ended, so a later quest-level cleanup does not end it again; cleared when it runs again */
+    bool bEnded = false;
+
+    /** Slot in the subsystem's live objectives, INDEX_NONE while pooled */
+    int32 LiveIndex = INDEX_NONE;
+
+    /** Slot in the owning quest's objectives and state bits, INDEX_NONE for optional objectives */
+    int32 QuestIndex = INDEX_NONE;
+};
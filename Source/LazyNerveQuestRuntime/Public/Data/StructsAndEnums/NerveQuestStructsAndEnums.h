@@ -3,12 +3,17 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagContainer.h"
+#include "Templates/SubclassOf.h"
 #include "UObject/Object.h"
 #include "NerveQuestStructsAndEnums.generated.h"
 
 class UWorldGotoPing;
 class UWidgetComponent;
+class ULocalPlayer;
 class UNerveQuestAsset;
+class AActor;
 // Quest category enum to track the current state of a quest
 UENUM(BlueprintType)
 enum class ENerveQuestCategory : uint8
@@ -27,6 +32,28 @@ enum class ENerveQuestTypes : uint8
 	SideQuest UMETA(DisplayName = "Side Quest")
 };
 
+// How world pings are drawn on screen
+UENUM(BlueprintType)
+enum class ENervePingRenderMode : uint8
+{
+	/** One screen-space widget component hosting a UWorldGotoPing per ping; fully customizable */
+	WidgetComponent UMETA(DisplayName = "Widget Component Per Ping"),
+	/** A single Slate overlay draws every marker and distance label in one paint pass */
+	SingleOverlay UMETA(DisplayName = "Single Overlay")
+};
+
+// Which clock a quest timer runs on
+UENUM(BlueprintType)
+enum class ENerveQuestClock : uint8
+{
+	/** Dilated game time; stops while the game is paused */
+	GameTime UMETA(DisplayName = "Game Time"),
+	/** Undilated real time; keeps running while the game is paused */
+	RealTime UMETA(DisplayName = "Real Time"),
+	/** Real time that only advances while the game is paused, e.g. for menu timers */
+	PausedTime UMETA(DisplayName = "Paused Time")
+};
+
 // Quest difficulty enum to indicate the challenge level of a quest
 UENUM(BlueprintType)
 enum class ENerveQuestDifficulty : uint8
@@ -210,6 +237,22 @@ struct FPingData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	FVector2D EdgePosition = FVector2D::ZeroVector;
 
+	/** Formatted distance text, rebuilt only when the distance changes */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FString DistanceLabel;
+
+	/** Pings of tracked quests are kept first when the marker cap is reached */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bIsTracked = false;
+
+	/** Last occlusion trace found geometry between the viewer and the target */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bIsOccluded = false;
+
+	/** Number of pings drawn by this marker: 1 alone, more when it stands for an off-screen cluster, 0 when merged into another */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 ClusterCount = 1;
+
 	FPingData()
 	{
 		WorldLocation = FVector::ZeroVector;
@@ -222,6 +265,21 @@ struct FPingData
 	}
 };
 
+// Pings at least MinDistance away from the viewer are refreshed every UpdateInterval seconds
+USTRUCT(BlueprintType)
+struct FNervePingLodTier
+{
+	GENERATED_BODY()
+
+	/** Distance from the viewer in world units where this tier starts */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(ClampMin="0.0"))
+	float MinDistance = 0.0f;
+
+	/** Seconds between projections of pings in this tier */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(ClampMin="0.0", Units="s"))
+	float UpdateInterval = 0.0f;
+};
+
 USTRUCT(BlueprintType)
 struct FPingComponent
 {
@@ -239,13 +297,199 @@ struct FPingComponent
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	int32 PingID = -1;
 
+	/** Bumped every time the slot is released so stale handles stop resolving */
+	int32 Generation = 1;
+
+	/** Position of this slot in the dense list of active pings, INDEX_NONE when free */
+	int32 ActiveIndex = INDEX_NONE;
+
+	/** Local player this ping is shown to */
+	TWeakObjectPtr<ULocalPlayer> OwningPlayer = nullptr;
+
+	/** Index of the owner's view during the current update */
+	int32 ViewIndex = INDEX_NONE;
+
+	/** Squared distance from the viewer at the last update, drives the LOD tier and render order */
+	double ViewDistanceSquared = 0.0;
+
+	/** LOD tier of the last update, 0 is refreshed every update */
+	int32 LodTier = 0;
+
+	/** Seconds until the next projection under the current LOD tier */
+	float LodTimeUntilUpdate = 0.0f;
+
+	/** Last projection put the ping in front of the viewer */
+	bool bProjected = false;
+
+	/** Ping survived clustering and the marker cap in the last update */
+	bool bRendered = false;
+
+	/** Cluster count last pushed to the ping widget */
+	int32 AppliedClusterCount = 1;
+
+	/** Last authoritative location and velocity reported for the target, and the world time they were sampled */
+	FVector SampleLocation = FVector::ZeroVector;
+	FVector SampleVelocity = FVector::ZeroVector;
+	double SampleTime = 0.0;
+	bool bHasSample = false;
+
+	/** Displayed minus predicted location when the last sample arrived, decayed to zero to hide corrections */
+	FVector CorrectionOffset = FVector::ZeroVector;
+
+	/** Location is still being extrapolated or corrected between samples */
+	bool bPredicting = false;
+
+	/** An async occlusion trace for this ping is in flight */
+	bool bOcclusionTracePending = false;
+
+	/** Smoothed marker position drawn by the overlay */
+	FVector2D DisplayedPosition = FVector2D::ZeroVector;
+	bool bHasDisplayedPosition = false;
+
 	FPingComponent()
 	{
 		WidgetComponent = nullptr;
 		PingWidget = nullptr;
 		PingID = -1;
 	}
+
+	bool IsInUse() const { return ActiveIndex != INDEX_NONE; }
+
+	/** Clears per-update state when the slot is handed to a new ping */
+	void ResetRuntimeState()
+	{
+		ViewDistanceSquared = 0.0;
+		LodTier = 0;
+		LodTimeUntilUpdate = 0.0f;
+		bProjected = false;
+		bRendered = false;
+		AppliedClusterCount = 1;
+		SampleVelocity = FVector::ZeroVector;
+		CorrectionOffset = FVector::ZeroVector;
+		bHasSample = false;
+		bPredicting = false;
+		bOcclusionTracePending = false;
+		bHasDisplayedPosition = false;
+	}
+};
+
+// Recycled widget components for one ping widget class
+USTRUCT()
+struct FPingWidgetComponentPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UWidgetComponent>> Components;
+};
+
+// Usage counters of a quest runtime data pool
+USTRUCT(BlueprintType)
+struct FNerveRuntimeDataPoolStats
+{
+	GENERATED_BODY()
+
+	/** Instances created because the pool was empty */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 NumCreated = 0;
+
+	/** Acquisitions served from the pool */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 NumReused = 0;
+
+	/** Instances handed back, pooled or discarded */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 NumReleased = 0;
+
+	/** Instances dropped to the garbage collector because the pool was full */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 NumDiscarded = 0;
+
+	/** Instances currently waiting in the pool */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 NumPooled = 0;
+
+	/** Highest NumPooled seen */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 PeakPooled = 0;
+};
+
+// One quest of a data table, instantiated from a template quest graph it shares with every other row
+USTRUCT(BlueprintType)
+struct FNerveQuestTemplateRow : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	/** Quest whose graph this row runs; its QuestParameters are the defaults of the parameters below */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest Template")
+	TSoftObjectPtr<UNerveQuestAsset> Template;
+
+	/** Title of the quest, empty for the template's; {Name} is replaced by the parameter of that name */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest Template")
+	FString QuestTitle;
+
+	/** Description of the quest, empty for the template's; {Name} is replaced by the parameter of that name */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest Template", meta = (MultiLine = "true"))
+	FString QuestDescription;
+
+	/** Parameter values in text form, e.g. "5", "(X=100,Y=0,Z=0)" or a gameplay tag; missing ones use the template's */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest Template")
+	TMap<FName, FString> Parameters;
+};
+
+// Quests already instantiated from the rows of one data table
+USTRUCT()
+struct FNerveQuestTableInstances
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TMap<FName, TObjectPtr<UNerveQuestAsset>> Quests;
+};
+
+// Where a radiant quest parameter takes its value from
+UENUM(BlueprintType)
+enum class ENerveQuestParameterSource : uint8
+{
+	IntegerRange UMETA(DisplayName = "Integer Range"),
+	FloatRange UMETA(DisplayName = "Float Range"),
+	Choice UMETA(DisplayName = "Choice"),
+	TargetActor UMETA(DisplayName = "Target Actor"),
+	TargetLocation UMETA(DisplayName = "Target Location")
+};
+
+// Draws one parameter of a radiant quest from the quest's seed
+USTRUCT(BlueprintType)
+struct FNerveQuestParameterGenerator
+{
+	GENERATED_BODY()
+
+	/** Parameter the drawn value is stored in */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radiant Quest")
+	FName ParameterName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radiant Quest")
+	ENerveQuestParameterSource Source = ENerveQuestParameterSource::IntegerRange;
+
+	/** Inclusive bounds, X the minimum and Y the maximum */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radiant Quest", meta = (EditCondition = "Source == ENerveQuestParameterSource::IntegerRange || Source == ENerveQuestParameterSource::FloatRange", EditConditionHides))
+	FVector2D Range = FVector2D(1.0, 10.0);
+
+	/** Values in text form to pick one from */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radiant Quest", meta = (EditCondition = "Source == ENerveQuestParameterSource::Choice", EditConditionHides))
+	TArray<FString> Choices;
+
+	/** Quest targets to pick one from, as indexed by the quest target subsystem */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radiant Quest", meta = (EditCondition = "Source == ENerveQuestParameterSource::TargetActor || Source == ENerveQuestParameterSource::TargetLocation", EditConditionHides))
+	TSubclassOf<AActor> TargetClass = nullptr;
+
+	/** Narrows the quest targets to the ones owning this tag */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radiant Quest", meta = (EditCondition = "Source == ENerveQuestParameterSource::TargetActor || Source == ENerveQuestParameterSource::TargetLocation", EditConditionHides))
+	FGameplayTag TargetTag;
 };
 
 // Utility function to convert distance using settings from UNerveQuestRuntimeSetting
-LAZYNERVEQUESTRUNTIME_API float ConvertDistance(float DistanceInUnrealUnits, ENerveDistanceConversionMethod ConversionMethod);
\ No newline at end of file
+LAZYNERVEQUESTRUNTIME_API float ConvertDistance(float DistanceInUnrealUnits, ENerveDistanceConversionMethod ConversionMethod);
+
+// Formats an already converted distance with its unit suffix, e.g. "42 m"
+LAZYNERVEQUESTRUNTIME_API FString FormatPingDistance(float ConvertedDistance, ENerveDistanceConversionMethod ConversionMethod);
\ No newline at end of file
@@ -0,0 +1,162 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/StructsAndEnums/NerveQuestStructsAndEnums.h"
+
+/** Identifies a timer of a FNerveQuestTimingWheel; stale handles are rejected through the generation */
+struct FNerveQuestTimerHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Generation = 0;
+    ENerveQuestClock Clock = ENerveQuestClock::GameTime;
+
+    /** Timer scope of UNerveQuestTimerSubsystem the timer belongs to, zero for the world scope */
+    int32 Scope = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+    void Invalidate() { Index = INDEX_NONE; Generation = 0; Scope = 0; }
+};
+
+/**
+ * Hierarchical timing wheel: four levels of 64 slots over a fixed tick length, plus an overflow list.
+ * Adding and cancelling a timer is O(1), and advancing costs one slot visit per elapsed tick,
+ * plus an occasional cascade of a higher level slot, no matter how many timers are pending.
+ * With the default 10 ms tick the levels span 0.64 s, 41 s, 44 min and 46 h.
+ *
+ * Timers belong to a group (a timer scope of UNerveQuestTimerSubsystem). A paused group parks its
+ * timers outside the wheel with their remaining time, and a group's time scale stretches its delays,
+ * so one wheel serves every group and only the group being changed pays for the change.
+ */
+class LAZYNERVEQUESTRUNTIME_API FNerveQuestTimingWheel
+{
+public:
+    static constexpr int32 SlotBits = 6;
+    static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+    static constexpr int32 SlotMask = SlotsPerLevel - 1;
+    static constexpr int32 NumLevels = 4;
+
+    explicit FNerveQuestTimingWheel(double InTickLength = 0.01);
+
+    /** Changes the tick length; only allowed while no timer is pending */
+    void SetTickLength(double InTickLength);
+
+    /**
+     * Schedules a callback.
+     * @param Callback Called when the timer fires.
+     * @param Delay Seconds until the first call.
+     * @param Interval Seconds between later calls; zero or less for a one-shot timer.
+     * @param Clock Stored in the handle so owners of several wheels can route it back.
+     * @param Group Group the timer belongs to; Delay and Interval are measured on the group's time scale.
+     * @return Handle used to cancel or query the timer.
+     */
+    FNerveQuestTimerHandle Add(FSimpleDelegate Callback, double Delay, double Interval, ENerveQuestClock Clock, int32 Group = 0);
+
+    /** Cancels a pending timer. @return False when the handle was stale. */
+    bool Cancel(const FNerveQuestTimerHandle& Handle);
+
+    /** @return True while the timer is pending. */
+    bool IsActive(const FNerveQuestTimerHandle& Handle) const;
+
+    /** @return Seconds until the timer fires on its group's time scale, or -1 when it is not pending. */
+    double GetRemaining(const FNerveQuestTimerHandle& Handle) const;
+
+    /** Parks or unparks every timer of a group; parked timers keep their remaining time */
+    void SetGroupPaused(int32 Group, bool bPaused);
+
+    /** Reschedules every timer of a group for a new time scale; zero parks them like a pause */
+    void SetGroupTimeScale(int32 Group, double TimeScale);
+
+    /** Drops every timer of a group without firing it and forgets the group */
+    void ReleaseGroup(int32 Group);
+
+    /** Advances the wheel and fires every timer that became due */
+    void Advance(double DeltaSeconds);
+
+    /** Drops every timer without firing it */
+    void Reset();
+
+    /** @return Number of pending timers, parked ones included. */
+    int32 Num() const { return NumPending; }
+
+    /** @return Number of pending timers the wheel may fire, i.e. not parked. */
+    int32 NumActive() const { return NumPending - NumParked; }
+
+private:
+    struct FTimerNode
+    {
+        FSimpleDelegate Callback;
+        uint64 ExpireTick = 0;
+        uint64 IntervalTicks = 0;
+        int32 Prev = INDEX_NONE;
+        int32 Next = INDEX_NONE;
+
+        /** List the node is linked into, INDEX_NONE while unlinked (free, firing or parked) */
+        int32 List = INDEX_NONE;
+        uint32 Generation = 0;
+        bool bPending = false;
+
+        /** Group membership, an intrusive list per group */
+        int32 Group = 0;
+        int32 GroupPrev = INDEX_NONE;
+        int32 GroupNext = INDEX_NONE;
+
+        /** Repeat interval on the group's time scale, kept so rescaling does not accumulate rounding */
+        double IntervalSeconds = 0.0;
+
+        /** Remaining time on the group's time scale while parked */
+        double ParkedSeconds = 0.0;
+        bool bParked = false;
+    };
+
+    struct FTimerGroup
+    {
+        int32 Head = INDEX_NONE;
+        double TimeScale = 1.0;
+        bool bPaused = false;
+
+        bool IsFrozen() const { return bPaused || TimeScale <= 0.0; }
+    };
+
+    /** Overflow list for timers further away than the top level spans */
+    static constexpr int32 OverflowList = NumLevels * SlotsPerLevel;
+    static constexpr int32 NumLists = OverflowList + 1;
+
+    const FTimerNode* FindNode(const FNerveQuestTimerHandle& Handle) const;
+
+    uint64 SecondsToTicks(double Seconds) const;
+
+    /** Links a node into the list matching its distance to the current tick */
+    void Link(int32 NodeIndex);
+    void Unlink(int32 NodeIndex);
+
+    /** Moves every node of a list to the list its remaining distance now maps to */
+    void Cascade(int32 ListIndex);
+
+    /** Advances one tick: cascades higher levels at their boundaries, then fires the level 0 slot */
+    void Step();
+
+    void ReleaseNode(int32 NodeIndex);
+
+    /** @return Seconds until a scheduled node fires, on the given time scale. */
+    double GetScheduledRemaining(const FTimerNode& Node, double TimeScale) const;
+
+    /** Schedules a node that is neither linked nor parked, RemainingSeconds from now on the given time scale */
+    void Schedule(int32 NodeIndex, double RemainingSeconds, double TimeScale);
+
+    /** Moves a node out of the wheel, keeping its remaining time */
+    void Park(int32 NodeIndex, double TimeScale);
+    void Unpark(int32 NodeIndex, double TimeScale);
+
+    TArray<FTimerNode> Nodes;
+    TArray<int32> FreeNodes;
+    int32 ListHeads[NumLists];
+    TMap<int32, FTimerGroup> Groups;
+
+    double TickLength = 0.01;
+    double Accumulator = 0.0;
+    uint64 CurrentTick = 0;
+    int32 NumPending = 0;
+    int32 NumParked = 0;
+};
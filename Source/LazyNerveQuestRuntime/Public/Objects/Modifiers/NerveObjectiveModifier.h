@@ -3,37 +3,55 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Data/Runtime/NerveObjectiveRun.h"
 #include "UObject/Object.h"
 #include "NerveObjectiveModifier.generated.h"
 
-class UNerveQuestRuntimeObjectiveBase;
 /**
- * 
+ * Adds a condition to an objective. The objective's owner starts its modifiers through BeginObjective, so they
+ * run even when a Blueprint override skips the parent ExecuteObjective. They are also checked on every progress
+ * update and before completing; a failing CheckCondition or ValidateCompletion fails the objective.
+ * Time based modifiers schedule one-shot deadlines in OnObjectiveStart instead of being polled.
+ * Modifiers are shared by every run of their objective, so anything a run needs is kept in GetRunState.
  */
 UCLASS(Abstract, Blueprintable, EditInlineNew)
 class LAZYNERVEQUESTRUNTIME_API UNerveObjectiveModifier : public UObject
 {
 	GENERATED_BODY()
 
-	UPROPERTY()
-	const UObject* WorldContextObject = nullptr;
-
 public:
+	/** @return World of the objective's active run. */
 	virtual UWorld* GetWorld() const override;
 	
-	/** Called when the objective starts */
-	virtual void OnObjectiveStart(UNerveQuestRuntimeObjectiveBase* Objective);
+	/** Called when a run of the objective starts */
+	virtual void OnObjectiveStart(FNerveObjectiveRun& Run);
     
-	/** Called to check if the modifier's conditions are met */
-	virtual bool CheckCondition(UNerveQuestRuntimeObjectiveBase* Objective) { return true; }
+	/** Called to check if the modifier's conditions are met for the run */
+	virtual bool CheckCondition(FNerveObjectiveRun& Run) { return true; }
     
-	/** Called when the objective updates progress */
-	virtual void OnObjectiveProgress(UNerveQuestRuntimeObjectiveBase* Objective);
+	/** Called when the run updates progress */
+	virtual void OnObjectiveProgress(FNerveObjectiveRun& Run);
     
-	/** Called when the objective is completed to verify if the modifier conditions were met */
-	virtual bool ValidateCompletion(UNerveQuestRuntimeObjectiveBase* Objective) { return true; }
-	
-	const UObject* GetWorldContextObject() const { return WorldContextObject; }
-	
-	void SetWorldContextObject(const UObject* NewWorldContextObject) { WorldContextObject = NewWorldContextObject; }
+	/** Called when the run is completed to verify if the modifier conditions were met */
+	virtual bool ValidateCompletion(FNerveObjectiveRun& Run) { return true; }
+
+	/** Called when the run completes, fails or is cleaned up; cancel anything scheduled in OnObjectiveStart */
+	virtual void OnObjectiveEnd(FNerveObjectiveRun& Run);
+
+protected:
+	/**
+	 * State this modifier keeps for a run, created on first use.
+	 * @param Run The run of the objective.
+	 * @return The run's state, always of type T for a given modifier.
+	 */
+	template<typename T>
+	T& GetRunState(FNerveObjectiveRun& Run) const
+	{
+		TUniquePtr<FNerveModifierRunState>& State = Run.ModifierStates.FindOrAdd(this);
+		if (!State.IsValid())
+		{
+			State = MakeUnique<T>();
+		}
+		return static_cast<T&>(*State);
+	}
 };
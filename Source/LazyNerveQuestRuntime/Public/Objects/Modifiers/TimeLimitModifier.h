@@ -4,23 +4,46 @@
 
 #include "CoreMinimal.h"
 #include "NerveObjectiveModifier.h"
+#include "Data/Timing/NerveQuestTimingWheel.h"
 #include "TimeLimitModifier.generated.h"
 
+class UNerveQuestTimerSubsystem;
+
+/** Deadline of one run of the objective */
+struct FTimeLimitModifierRunState : public FNerveModifierRunState
+{
+	/** Set once the deadline has passed */
+	bool bExpired = false;
+
+	FNerveQuestTimerHandle DeadlineHandle;
+
+	/** Timer subsystem the deadline was scheduled on */
+	TWeakObjectPtr<UNerveQuestTimerSubsystem> TimerSubsystem;
+};
+
 /**
- * 
+ * Fails the objective when it isn't completed within the time limit.
+ * The limit is a single one-shot deadline scheduled when the objective starts, so nothing runs until it expires.
  */
 UCLASS()
 class LAZYNERVEQUESTRUNTIME_API UTimeLimitModifier : public UNerveObjectiveModifier
 {
 	GENERATED_BODY()
 
-	/* in seconds */
+	/** In seconds; zero or less means no limit, the objective never fails from this modifier */
 	UPROPERTY(EditAnywhere, Category="Time Limit")
 	float TimeLimit = 60.0f;
-	
-	float StartTime = 0.0f;
+
+	/** Clock the limit is measured on. Game time stops while the game is paused. */
+	UPROPERTY(EditAnywhere, Category="Time Limit")
+	ENerveQuestClock Clock = ENerveQuestClock::GameTime;
 
 public:
-	virtual void OnObjectiveStart(UNerveQuestRuntimeObjectiveBase* Objective) override;
-	virtual bool CheckCondition(UNerveQuestRuntimeObjectiveBase* Objective) override;
+	virtual void OnObjectiveStart(FNerveObjectiveRun& Run) override;
+	virtual bool CheckCondition(FNerveObjectiveRun& Run) override;
+	virtual bool ValidateCompletion(FNerveObjectiveRun& Run) override;
+	virtual void OnObjectiveEnd(FNerveObjectiveRun& Run) override;
+
+private:
+	void HandleDeadline(TWeakPtr<FNerveObjectiveRun> WeakRun);
 };
@@ -42,6 +42,26 @@ public:
 	UPROPERTY(EditAnywhere, Instanced,  BlueprintReadWrite, Category = "Quest Information")
 	TArray<TObjectPtr<class UNerveQuestRewardBase>> QuestRewards = TArray<TObjectPtr<class UNerveQuestRewardBase>>();
 	
+	/** Named parameters and their values in text form; objectives read them through their ParameterBindings */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Quest Template")
+	TMap<FName, FString> QuestParameters;
+
+	/** Generators filling parameters of radiant quests made from this template, applied in order */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Quest Template")
+	TArray<FNerveQuestParameterGenerator> ParameterGenerators;
+
+	/** Quest this one was instantiated from; it runs that quest's graph, its objectives reading this quest's parameters */
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Quest Template")
+	TObjectPtr<UNerveQuestAsset> TemplateAsset = nullptr;
+
+	/** Seed a radiant quest's parameters were drawn from; saving it with the template is enough to restore the quest */
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Quest Template")
+	int32 RadiantSeed = 0;
+
+	/** Whether this quest was generated from its template's ParameterGenerators */
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Quest Template")
+	bool bIsRadiant = false;
+	
 	UPROPERTY()
 	TObjectPtr<UNerveQuestRuntimeGraph> RuntimeGraph = nullptr;
 
@@ -52,6 +72,53 @@ public:
 
 	UFUNCTION(BlueprintPure, Category="QuestAsset Helper")
 	TArray<UNerveQuestRuntimeObjectiveBase*> GetQuestObjectives() const;
+
+	/**
+	 * Finds a parameter value, falling back to the template's default
+	 * @param ParameterName Name of the parameter
+	 * @param OutValue The value in text form
+	 * @return True if this quest or its template defines the parameter
+	 */
+	UFUNCTION(BlueprintPure, Category="QuestAsset Helper")
+	bool FindQuestParameter(FName ParameterName, FString& OutValue) const;
+
+	UFUNCTION(BlueprintPure, Category="QuestAsset Helper")
+	bool IsTemplateInstance() const { return IsValid(TemplateAsset); }
+
+	/** @return Rewards of this quest; instances do not copy them and read their template's */
+	const TArray<TObjectPtr<UNerveQuestRewardBase>>& GetRewards() const
+	{
+		return IsValid(TemplateAsset) && QuestRewards.IsEmpty() ? TemplateAsset->GetRewards() : QuestRewards;
+	}
+
+	/**
+	 * Creates a quest sharing the template's graph and rewards; it holds only the template pointer, the row's
+	 * parameters and its formatted texts, and its objectives resolve their bindings from those parameters per run
+	 * @param Outer Owner of the new quest
+	 * @param Template Quest whose graph and parameter defaults are used
+	 * @param Row The data table row to instantiate
+	 * @param InstanceName Base object name of the new quest, usually the row name
+	 * @return The new quest, or null without a template graph
+	 */
+	static UNerveQuestAsset* CreateTemplateInstance(UObject* Outer, UNerveQuestAsset* Template, const FNerveQuestTemplateRow& Row, FName InstanceName);
+
+	/**
+	 * Creates a radiant quest: the template pointer, the seed and the parameters drawn from it, running the template's graph
+	 * @param Outer Owner of the new quest
+	 * @param Template Quest with ParameterGenerators
+	 * @param Seed Same template, seed and quest targets always give the same parameters
+	 * @param WorldContextObject World whose quest targets actor parameters are picked from
+	 * @return The new quest, or null without a template graph
+	 */
+	static UNerveQuestAsset* CreateRadiantInstance(UObject* Outer, UNerveQuestAsset* Template, int32 Seed, const UObject* WorldContextObject);
+
+	/**
+	 * Draws the values of every parameter generator
+	 * @param Seed Seed of the random stream, one stream per quest
+	 * @param WorldContextObject World whose quest targets actor parameters are picked from
+	 * @param OutParameters Receives the values in text form
+	 */
+	void GenerateParameters(int32 Seed, const UObject* WorldContextObject, TMap<FName, FString>& OutParameters) const;
 	
 #if WITH_EDITOR // WITH_EDITOR
 	virtual void PreEditChange(FProperty* PropertyAboutToChange) override;
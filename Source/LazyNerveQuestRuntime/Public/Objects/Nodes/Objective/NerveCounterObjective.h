@@ -0,0 +1,106 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "NerveQuestRuntimeObjectiveBase.h"
+#include "Subsystem/NerveQuestTargetSubsystem.h"
+#include "NerveCounterObjective.generated.h"
+
+class UNerveQuestEventSubsystem;
+
+/** Count and listeners of one run of a counter objective */
+struct FNerveCounterObjectiveRun : public FNerveObjectiveRun
+{
+    virtual ~FNerveCounterObjectiveRun() override;
+
+    /** Target count of this run, quest parameters applied */
+    int32 TargetCount = 1;
+
+    int32 CurrentCount = 0;
+
+    /** True between ExecuteObjective and completion or cleanup; late counts are ignored otherwise */
+    bool bCounting = false;
+
+    /** While paused, counts are held back and applied on resume */
+    bool bPaused = false;
+    int32 HeldCount = 0;
+
+    int32 TargetWatcherHandle = INDEX_NONE;
+
+    TWeakObjectPtr<UNerveQuestEventSubsystem> EventSubsystem;
+    TWeakObjectPtr<UNerveQuestTargetSubsystem> TargetSubsystem;
+
+    /** Stops listening to events and targets */
+    void StopCounting();
+};
+
+/**
+ * A quest objective that completes after something happened N times: kills, pickups, interactions.
+ * Counts come from events reported to UNerveQuestEventSubsystem, from destroyed quest targets, or from AddCount.
+ * Everything counted during a frame is summed and applied once, with a single progress update.
+ */
+UCLASS()
+class LAZYNERVEQUESTRUNTIME_API UNerveCounterObjective : public UNerveQuestRuntimeObjectiveBase
+{
+    GENERATED_BODY()
+
+protected:
+    /** How many times the event has to happen. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Counter Objective", meta = (ClampMin = "1", UIMin = "1"))
+    int32 TargetCount = 10;
+
+    /** Event counted by this objective; child tags count too. Leave empty to count only targets or AddCount. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Counter Objective")
+    FGameplayTag CountedEvent;
+
+    /** Optional class of quest targets whose destruction counts. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Counter Objective")
+    TSubclassOf<AActor> CountedTargetClass = nullptr;
+
+    /** Optional gameplay tag the destroyed targets must own. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Counter Objective", meta = (EditCondition = "CountedTargetClass != nullptr"))
+    FGameplayTag CountedTargetTag;
+
+public:
+    UNerveCounterObjective();
+
+    virtual FText GetObjectiveName_Implementation() override;
+    virtual FText GetObjectiveDescription_Implementation() override;
+    virtual FText GetObjectiveCategory_Implementation() override;
+    virtual FSlateBrush GetObjectiveBrush_Implementation() const override;
+
+    /** Resets the count and starts listening to the configured events and targets. */
+    virtual void ExecuteObjective_Implementation(UNerveQuestAsset* NerveQuestAsset) override;
+    virtual void CleanUpObjective_Implementation() override;
+    virtual void PauseObjective_Implementation() override;
+    virtual void ResumeObjective_Implementation() override;
+
+    /**
+     * Counts something that happened, e.g. from a Blueprint. Applied at the end of the frame together with other counts.
+     * @param Amount How many times it happened.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Counter Objective")
+    void AddCount(int32 Amount = 1);
+
+    /** @return Count of the active run. */
+    UFUNCTION(BlueprintPure, Category = "Counter Objective")
+    int32 GetCurrentCount() const;
+
+    /** @return Target count of the active run, quest parameters applied. */
+    UFUNCTION(BlueprintPure, Category = "Counter Objective")
+    int32 GetTargetCount() const;
+
+    /**
+     * Applies the summed counts of one frame; called by UNerveQuestEventSubsystem.
+     * @param Run The counting run.
+     * @param Amount Summed count.
+     */
+    void ApplyCount(FNerveObjectiveRun& Run, int32 Amount);
+
+protected:
+    virtual TSharedRef<FNerveObjectiveRun> MakeRun() const override;
+
+    void HandleTargetChanged(AActor* Actor, ENerveQuestTargetChange Change, TWeakPtr<FNerveObjectiveRun> WeakRun);
+};
@@ -3,9 +3,31 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
 #include "NerveQuestRuntimeObjectiveBase.h"
+#include "Subsystem/NerveQuestTargetSubsystem.h"
 #include "NerveDestroyActorObjective.generated.h"
 
+/** Destroyed count and registry watcher of one run of a destroy objective */
+struct FNerveDestroyActorObjectiveRun : public FNerveObjectiveRun
+{
+	virtual ~FNerveDestroyActorObjectiveRun() override;
+
+	/** Settings of this run, quest parameters applied */
+	TSubclassOf<AActor> ActorToDestroy = nullptr;
+	int32 AmountToDestroy = 1;
+	FGameplayTag ActorTag;
+
+	int32 CurrentAmount = 0;
+
+	/** Registry watcher counting destroyed targets, including ones spawned after the objective started */
+	int32 TargetWatcherHandle = INDEX_NONE;
+
+	TWeakObjectPtr<UNerveQuestTargetSubsystem> TargetSubsystem;
+
+	void StopWatchingTargets();
+};
+
 /**
  * 
  */
@@ -21,11 +43,9 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Destroy Objective", meta=(ClampMin = 1))
 	int32 AmountToDestroy = 1;
 
-private:
-	int32 CurrentAmount = 0;
-
-	UPROPERTY()
-	TArray<AActor*> OutActors;
+	/** Optional gameplay tag the actors must own to count, read through IGameplayTagAssetInterface */
+	UPROPERTY(EditAnywhere, Category="Destroy Objective")
+	FGameplayTag ActorTag;
 
 public:
 	UNerveDestroyActorObjective();
@@ -37,8 +57,10 @@ public:
 	
 	virtual void ExecuteObjective_Implementation(UNerveQuestAsset* NerveQuestAsset) override;
 	virtual void MarkAsTracked_Implementation(bool TrackValue) override;
+	virtual void CleanUpObjective_Implementation() override;
 
 protected:
-	UFUNCTION()
-	void HandleActorDestroy(AActor* DestroyedActor);
+	virtual TSharedRef<FNerveObjectiveRun> MakeRun() const override;
+
+	void HandleTargetChanged(AActor* Actor, ENerveQuestTargetChange Change, TWeakPtr<FNerveObjectiveRun> WeakRun);
 };
@@ -0,0 +1,36 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NerveQuestRuntimeObjectiveBase.h"
+#include "NerveForkObjective.generated.h"
+
+/**
+ * Splits the quest into branches that run at the same time, each one following one of the Branch pins.
+ * The quest tracks every branch as a lightweight token; a UNerveJoinObjective brings them back together.
+ * Inside a sequence objective the fork does not branch and simply completes.
+ */
+UCLASS()
+class LAZYNERVEQUESTRUNTIME_API UNerveForkObjective : public UNerveQuestRuntimeObjectiveBase
+{
+    GENERATED_BODY()
+
+protected:
+    /** Number of Branch pins. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fork", meta = (ClampMin = "2", UIMin = "2", ClampMax = "16", UIMax = "16"))
+    int32 BranchCount = 2;
+
+public:
+    UNerveForkObjective();
+
+    virtual FText GetObjectiveName_Implementation() override;
+    virtual FText GetObjectiveDescription_Implementation() override;
+    virtual FText GetObjectiveCategory_Implementation() override;
+    virtual bool CanGenerateOptionals_Implementation() override { return false; }
+    virtual bool IsCosmetic_Implementation() override { return true; }
+
+    virtual void ExecuteObjective_Implementation(UNerveQuestAsset* NerveQuestAsset) override;
+
+    int32 GetBranchCount() const { return FMath::Clamp(BranchCount, 2, 16); }
+};
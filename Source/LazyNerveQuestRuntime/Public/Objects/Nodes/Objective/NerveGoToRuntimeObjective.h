@@ -5,11 +5,13 @@
 #include "CoreMinimal.h"
 #include "NerveQuestRuntimeObjectiveBase.h"
 #include "Data/StructsAndEnums/NerveQuestStructsAndEnums.h"
+#include "Data/Timing/NerveQuestTimingWheel.h"
 #include "Engine/TimerHandle.h"
 #include "Templates/SubclassOf.h"
 #include "NerveGoToRuntimeObjective.generated.h"
 
-class AGoToWorldPing;
+class UNervePingSubsystem;
+class UNerveQuestTimerSubsystem;
 class UWorldGotoPing;
 /**
  * Enum representing the type of location for the "Go To" quest objective.
@@ -24,6 +26,32 @@ enum class EGoToQuestLocationType : uint8
 	ActorLocation,
 };
 
+/** Tracked pawn, ping and poll of one run of a go-to objective */
+struct FNerveGoToObjectiveRun : public FNerveObjectiveRun
+{
+	virtual ~FNerveGoToObjectiveRun() override;
+
+	/** Target of this run, quest parameters applied */
+	FVector SpecificLocation = FVector::ZeroVector;
+	TSoftObjectPtr<AActor> LocationActor = nullptr;
+	float AcceptableRadialOffset = 0.0f;
+
+	TWeakObjectPtr<APawn> TrackingPlayer = nullptr;
+
+	/** Ping subsystem of the world the ping was created in */
+	TWeakObjectPtr<UNervePingSubsystem> PingSubsystem = nullptr;
+	int32 CurrentPingID = -1;
+
+	/** Tracking poll on the quest timing wheel */
+	FNerveQuestTimerHandle TimerHandle;
+	TWeakObjectPtr<UNerveQuestTimerSubsystem> TimerSubsystem;
+
+	/** Stops the tracking poll */
+	void StopTracking();
+
+	void CleanupPing();
+};
+
 /**
  * 
  */
@@ -79,18 +107,13 @@ protected:
 	EditConditionHides = "bApplyWorldMarker == true"))
 	ENerveDistanceConversionMethod DistanceConversion = ENerveDistanceConversionMethod::Centimeter;
 
-	/** The rate at which the player location is tracked. */
+	/** The rate at which the player location is tracked. The world marker is extrapolated between samples,
+	* so objectives can opt into a coarser rate such as 0.1 (10 samples per second) and still move smoothly. */
 	UPROPERTY(EditAnywhere, Category="GOTO Objective")
 	float TrackingRate = 0.01f;
 
 private:
-	UPROPERTY()
-	APawn* TrackingPlayer = nullptr;
-	UPROPERTY()
-	TObjectPtr<class APingManager> PingManager = nullptr;
-	UPROPERTY()
-	int32 CurrentPingID = -1;
-	FTimerHandle TimerHandle;
+	/** Editor preview only; runs keep their state in FNerveGoToObjectiveRun */
 	FTimerHandle DebugDrawTimerHandle;
 
 public:
@@ -103,12 +126,17 @@ public:
 
 	virtual void ExecuteObjective_Implementation(UNerveQuestAsset* NerveQuestAsset) override;
 	virtual void MarkAsTracked_Implementation(bool TrackValue) override;
-	void ListenToPlayerLocation();
+	void ListenToPlayerLocation(TWeakPtr<FNerveObjectiveRun> WeakRun);
+
+	/** @return Target of the active run, or the authored target outside a run (editor preview). */
 	FVector GetTargetLocationByLocationType(bool& Success) const;
 	FVector FindGroundLevel(const UWorld* World, const FVector& StartLocation) const;
 	virtual void CleanUpObjective_Implementation() override;
-	virtual void BeginDestroy() override;
-	void CleanupPing();
+
+protected:
+	virtual TSharedRef<FNerveObjectiveRun> MakeRun() const override;
+
+public:
 
 #if WITH_EDITOR
 	virtual void StartObjectivePreview_Implementation(UObject* PreviewWorldContextObject) override;
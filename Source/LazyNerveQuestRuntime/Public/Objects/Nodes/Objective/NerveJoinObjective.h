@@ -0,0 +1,54 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NerveQuestRuntimeObjectiveBase.h"
+#include "NerveJoinObjective.generated.h"
+
+UENUM(BlueprintType)
+enum class ENerveJoinPolicy : uint8
+{
+    All,        // Continues once every connected branch arrived
+    Any,        // Continues with the first branch to arrive, cancelling the others
+    Count,      // Continues once RequiredBranches arrived, cancelling the others
+};
+
+/**
+ * Waits for branches of a UNerveForkObjective, connected to its input, then continues the quest as a single branch.
+ * Branches of the same fork still running when the join continues are cancelled.
+ * Inside a sequence objective the join does not wait and simply completes.
+ */
+UCLASS()
+class LAZYNERVEQUESTRUNTIME_API UNerveJoinObjective : public UNerveQuestRuntimeObjectiveBase
+{
+    GENERATED_BODY()
+
+protected:
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Join")
+    ENerveJoinPolicy JoinPolicy = ENerveJoinPolicy::All;
+
+    /** Branches that have to arrive in Count mode, clamped to the number of connected branches. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Join", meta = (ClampMin = "1", UIMin = "1", EditCondition = "JoinPolicy == ENerveJoinPolicy::Count", EditConditionHides))
+    int32 RequiredBranches = 1;
+
+public:
+    UNerveJoinObjective();
+
+    virtual FText GetObjectiveName_Implementation() override;
+    virtual FText GetObjectiveDescription_Implementation() override;
+    virtual FText GetObjectiveCategory_Implementation() override;
+    virtual bool CanGenerateOptionals_Implementation() override { return false; }
+    virtual bool IsCosmetic_Implementation() override { return true; }
+
+    virtual void ExecuteObjective_Implementation(UNerveQuestAsset* NerveQuestAsset) override;
+
+    /** @return Number of branches connected to the input, at least one. */
+    int32 GetNumConnectedBranches() const;
+
+    /**
+     * @param NumConnectedBranches Result of GetNumConnectedBranches, cached by the quest.
+     * @return Number of branches that have to arrive before the quest continues past the join.
+     */
+    int32 GetRequiredBranches(int32 NumConnectedBranches) const;
+};
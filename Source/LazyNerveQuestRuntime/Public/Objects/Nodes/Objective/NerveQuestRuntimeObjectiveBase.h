@@ -3,11 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Data/Runtime/NerveObjectiveRun.h"
 #include "Data/StructsAndEnums/NerveQuestStructsAndEnums.h"
 #include "Styling/SlateBrush.h"
 #include "UObject/Object.h"
 #include "NerveQuestRuntimeObjectiveBase.generated.h"
 
+class APlayerController;
+class ULocalPlayer;
 class UNerveObjectiveModifier;
 class UObjectiveProgressTracker;
 
@@ -15,7 +18,8 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNerveQuestObjectiveAction, UNerveQu
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FNerveQuestObjectiveProgressAction, UNerveQuestRuntimeObjectiveBase*, ObjectiveBase, float, NewProgressValue, float, MaxProgressValue);
 
 /**
- * 
+ * A node of a quest graph. Nodes are shared by every quest running the graph, so they hold only authored data;
+ * each execution gets its own FNerveObjectiveRun from CreateRun, and the node's events act on the active run.
  */
 UCLASS(Abstract, EditInlineNew, Blueprintable)
 class LAZYNERVEQUESTRUNTIME_API UNerveQuestRuntimeObjectiveBase : public UObject
@@ -42,12 +46,15 @@ public:
 	UPROPERTY()
 	bool bIsOptionalObjective = false;
 
+	/** Broadcast when any run of this objective completes; owners of a run listen to FNerveObjectiveRun::OnFinished */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable)
 	FNerveQuestObjectiveAction OnObjectiveCompleted;
 
+	/** Broadcast when any run of this objective fails */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable)
 	FNerveQuestObjectiveAction OnObjectiveFailed;
 
+	/** Broadcast on progress of any run of this objective */
 	UPROPERTY(BlueprintCallable, BlueprintAssignable)
 	FNerveQuestObjectiveProgressAction OnProgressChanged;
 
@@ -64,9 +71,16 @@ protected:
 	/** Defines how to handle failure for this objective. */
 	UPROPERTY(EditAnywhere, Category="Generic")
 	EObjectiveFailureResponse FailureResponse = EObjectiveFailureResponse::FailQuest;
+
+	/** How much this objective counts when a parent sums weights, e.g. a weighted threshold sequence. */
+	UPROPERTY(EditAnywhere, Category="Generic", meta=(ClampMin="0", UIMin="0"))
+	float ObjectiveWeight = 1.0f;
+
+	/** Properties of this objective read from quest parameters, property name to parameter name, e.g. TargetCount to KillCount. Resolved per run from the running quest's parameters; the node keeps its authored values. */
+	UPROPERTY(EditAnywhere, Category="Generic")
+	TMap<FName, FName> ParameterBindings;
 	
-	/** Modifiers that add additional conditions to this objective */
-	// should be when one fails then the whole thing fails.
+	/** Modifiers that add additional conditions to this objective. When one fails the whole objective fails. */
     UPROPERTY(EditAnywhere, Instanced, Category="Generic")
     TArray<UNerveObjectiveModifier*> Modifiers = TArray<UNerveObjectiveModifier*>();
 
@@ -105,14 +119,17 @@ protected:
 	/** properties that should be copied */
 	TArray<FProperty*> PropertyData;
 
-	UPROPERTY()
-	TObjectPtr<class UNerveQuestAsset> ParentQuestAsset = nullptr;
-
 	UPROPERTY()
 	bool bIsConnectedAsOptional = false;
 
-	UPROPERTY()
-	TWeakObjectPtr<const UObject> WorldContextObject = nullptr;
+private:
+	friend struct FNerveObjectiveRunScope;
+
+	/** Run the node currently acts on, set by FNerveObjectiveRunScope */
+	FNerveObjectiveRun* ActiveRun = nullptr;
+
+	/** Most recently begun run, for Blueprint objectives completing from latent actions outside any scope */
+	TWeakPtr<FNerveObjectiveRun> LatestRun;
 
 public:
 
@@ -123,10 +140,10 @@ public:
 	UNerveQuestRuntimePin* FindOutPinByCategory(FName InCategory);
 
 	UFUNCTION(BlueprintPure, Category="Generic Objective")
-	FText GetObjectiveDisplayLabel() const { return FText::FromString(DisplayLabel); }
+	FText GetObjectiveDisplayLabel() const { return FText::FromString(ResolveProperty(GET_MEMBER_NAME_CHECKED(UNerveQuestRuntimeObjectiveBase, DisplayLabel), DisplayLabel)); }
 
 	UFUNCTION(BlueprintPure, Category="Generic Objective")
-	FText GetObjectiveDisplayTip() const { return FText::FromString(DisplayTip); }
+	FText GetObjectiveDisplayTip() const { return FText::FromString(ResolveProperty(GET_MEMBER_NAME_CHECKED(UNerveQuestRuntimeObjectiveBase, DisplayTip), DisplayTip)); }
 
 	/** Set whether this objective is being used as an optional */
 	UFUNCTION(BlueprintCallable, Category = "Quest Objective")
@@ -139,6 +156,9 @@ public:
 	UFUNCTION(BlueprintPure, Category="Generic Objective")
 	EObjectiveFailureResponse GetObjectiveFailureResponse() const { return FailureResponse; }
 
+	UFUNCTION(BlueprintPure, Category="Generic Objective")
+	float GetObjectiveWeight() const { return FMath::Max(ObjectiveWeight, 0.0f); }
+
 	UFUNCTION(BlueprintPure, Category="Generic Objective")
 	TArray<UNerveObjectiveModifier*> GetObjectiveModifiers() const { return Modifiers; }
 
@@ -181,8 +201,49 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category="Objective Editor MetaData")
 	FSlateBrush GetObjectiveBrush() const;
 
-	const UObject* GetWorldContextObject() const { return WorldContextObject.Get(); }
-	void SetWorldContextObject(const UObject* NewWorldContextObject) { WorldContextObject = NewWorldContextObject; }
+	/** @return World context of the active run. */
+	const UObject* GetWorldContextObject() const;
+
+	/** @return Timer scope of UNerveQuestTimerSubsystem every timer of the active run is scheduled in. */
+	int32 GetTimerScope() const;
+
+	/** @return Quest of the active run, whose parameters the bindings read. */
+	UFUNCTION(BlueprintPure, Category="Quest")
+	UNerveQuestAsset* GetRunningQuestAsset() const;
+
+	/**
+	 * Reads the quest parameter bound to a property for the active run, for Blueprint objectives with bindings.
+	 * @param PropertyName Bound property, a key of ParameterBindings.
+	 * @param OutValue The parameter value as text.
+	 * @return False when the property is not bound or the quest has no such parameter.
+	 */
+	UFUNCTION(BlueprintPure, Category="Quest")
+	bool GetBoundParameter(FName PropertyName, FString& OutValue) const;
+
+	/**
+	 * Value of a property for the active run: the bound quest parameter when there is one, the authored value otherwise.
+	 * @param PropertyName The property, as in ParameterBindings.
+	 * @param NodeValue The authored value on this node.
+	 * @return The value the active run uses.
+	 */
+	template<typename T>
+	T ResolveProperty(const FName PropertyName, const T& NodeValue) const
+	{
+		T Value = NodeValue;
+		ImportBoundParameter(PropertyName, &Value, sizeof(T));
+		return Value;
+	}
+
+	/**
+	 * Local player running this objective, so split-screen players each track their own pawn and UI.
+	 * @return The owning local player, or the world's first local player when none was assigned.
+	 */
+	UFUNCTION(BlueprintPure, Category="Quest")
+	ULocalPlayer* GetOwningLocalPlayer() const;
+
+	/** @return The player controller of the owning local player in this objective's world. */
+	UFUNCTION(BlueprintPure, Category="Quest")
+	APlayerController* GetOwningPlayerController() const;
 
 	///////// 
 
@@ -210,6 +271,52 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Quest")
 	void ExecuteProgress(float NewValue = 1, float MaxValue = 1);
 
+	/**
+	 * Fails the active run on behalf of a modifier whose condition no longer holds, e.g. an expired deadline.
+	 * @param Modifier The modifier that failed.
+	 */
+	void FailFromModifier(const UNerveObjectiveModifier* Modifier);
+
+	/**
+	 * Creates the state of one execution of this node. Owners keep the run and pass it to BeginObjective,
+	 * EndObjective and the other run functions.
+	 * @param QuestAsset Quest the run belongs to; bindings read its parameters.
+	 * @param WorldContextObject World the run lives in.
+	 * @param LocalPlayer Local player running the quest.
+	 * @param TimerScope Timer scope of the quest.
+	 * @return The new run, not started yet.
+	 */
+	TSharedRef<FNerveObjectiveRun> CreateRun(UNerveQuestAsset* QuestAsset, const UObject* WorldContextObject, ULocalPlayer* LocalPlayer, int32 TimerScope);
+
+	/**
+	 * Starts the modifiers, then runs ExecuteObjective for the run. Owners start objectives through this,
+	 * so modifiers run even when a Blueprint override of ExecuteObjective skips the parent call.
+	 * @param Run Run created by CreateRun.
+	 */
+	void BeginObjective(FNerveObjectiveRun& Run);
+
+	/** Runs CleanUpObjective for the run, then stops its modifiers so scheduled deadlines are cancelled */
+	void EndObjective(FNerveObjectiveRun& Run);
+
+	/** Runs PauseObjective for the run */
+	void PauseRun(FNerveObjectiveRun& Run);
+
+	/** Runs ResumeObjective for the run */
+	void ResumeRun(FNerveObjectiveRun& Run);
+
+	/** Runs MarkAsTracked for the run */
+	void TrackRun(FNerveObjectiveRun& Run, bool bTracked);
+
+	/**
+	 * Ends the run as completed or failed without asking the modifiers, e.g. when an optional objective completes its parent.
+	 * @param Run The run, ignored once finished.
+	 * @param bCompleted False to fail it.
+	 */
+	void FinishRun(FNerveObjectiveRun& Run, bool bCompleted);
+
+	/** @return The run the node acts on: the scoped run, else the latest run for latent Blueprint actions. */
+	FNerveObjectiveRun* GetActiveRun() const;
+
 	UFUNCTION(BlueprintNativeEvent, Category = "Quest Editor")
 	bool CanGenerateOptionals();
 
@@ -226,4 +333,33 @@ public:
 	
 public:
 	TArray<FString> GetPropertyDescription() const;
+
+protected:
+	/** @return A new run of the type this node keeps its per-run state in. */
+	virtual TSharedRef<FNerveObjectiveRun> MakeRun() const;
+
+	/** @return The active run as the type returned by MakeRun, null outside a run. */
+	template<typename T>
+	T* GetRun() const { return static_cast<T*>(GetActiveRun()); }
+
+	/**
+	 * Imports the quest parameter bound to a property of this node into Value, for the active run.
+	 * @param PropertyName The bound property.
+	 * @param Value Storage of the property's type.
+	 * @param ValueSize Size of Value, checked against the property.
+	 * @return False when nothing was imported and Value keeps its contents.
+	 */
+	bool ImportBoundParameter(FName PropertyName, void* Value, int32 ValueSize) const;
+
+	/** Runs OnObjectiveStart on every modifier */
+	void StartModifiers(FNerveObjectiveRun& Run);
+
+	/** Runs OnObjectiveEnd on every modifier so scheduled deadlines are cancelled */
+	void StopModifiers(FNerveObjectiveRun& Run);
+
+	/** @return False when any modifier's CheckCondition fails. */
+	bool CheckModifierConditions(FNerveObjectiveRun& Run) const;
+
+	/** @return False when any modifier's ValidateCompletion fails. */
+	bool ValidateModifierCompletion(FNerveObjectiveRun& Run) const;
 };
@@ -9,14 +9,53 @@
 UENUM(BlueprintType)
 enum class EObjectiveExecutionType : uint8
 {
-    Sequential,     // One after another
-    Parallel,       // All simultaneously
+    Sequential,         // One after another
+    Parallel,           // All simultaneously
+    Quorum,             // All simultaneously, completes once RequiredChildCount of them completed
+    Race,               // All simultaneously, completes with the first child that completes
+    WeightedThreshold,  // All simultaneously, completes once the completed children's weights reach WeightThreshold
+};
+
+/** Child runs and outcome of one run of a sequence objective */
+struct FNerveSequenceObjectiveRun : public FNerveObjectiveRun
+{
+    virtual void AddReferencedObjects(FReferenceCollector& Collector, const UObject* Referencer) override;
+
+    // Run of every started child, indexed like the sequence's ChildObjectives
+    TArray<TSharedPtr<FNerveObjectiveRun>> ChildRuns;
+
+    // Per-child state, indexed like ChildObjectives
+    TBitArray<> ActiveChildren;
+    TBitArray<> CompletedChildren;
+    TBitArray<> FailedChildren;
+
+    // Current index for sequential execution
+    int32 CurrentSequentialIndex = 0;
+
+    // Number of running children
+    int32 ActiveChildCount = 0;
+
+    // Summed weights of running and completed children, for WeightedThreshold mode
+    float ActiveChildWeight = 0.0f;
+    float CompletedChildWeight = 0.0f;
+
+    int32 CompletedChildCount = 0;
+    int32 FailedChildCount = 0;
+
+    // Set while parallel children are being started, so children finishing right away do not end the sequence early
+    bool bLaunchingChildren = false;
+
+    // Set once the sequence completed or failed; late child events are ignored
+    bool bSequenceFinished = false;
 };
 
 /**
  * Sequence objective that can execute child objectives either sequentially or in parallel.
  * Sequential: Executes one child at a time, advancing to the next when current completes
  * Parallel: Executes all children simultaneously, completes when all are done
+ * Quorum, Race, WeightedThreshold: Execute all children simultaneously and finish as soon as the outcome is decided,
+ * cancelling the children still running. Child failures only count against the threshold here (RestartQuest still
+ * restarts), and the sequence fails once the threshold can no longer be reached.
  */
 UCLASS(BlueprintType, Blueprintable)
 class LAZYNERVEQUESTRUNTIME_API UNerveSequenceRuntimeObjective : public UNerveQuestRuntimeObjectiveBase
@@ -30,38 +69,21 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sequence")
     EObjectiveExecutionType ExecutionType = EObjectiveExecutionType::Parallel;
 
-protected:
-    // Current quest asset being executed
-    UPROPERTY()
-    UNerveQuestAsset* CurrentQuestAsset;
-
-    // All child objectives collected from output pins
-    UPROPERTY()
-    TArray<UNerveQuestRuntimeObjectiveBase*> ChildObjectives;
-
-    // Currently active child objectives
-    UPROPERTY()
-    TArray<UNerveQuestRuntimeObjectiveBase*> ActiveChildObjectives;
-
-    // Completed child objectives
-    UPROPERTY()
-    TArray<UNerveQuestRuntimeObjectiveBase*> CompletedChildObjectives;
-
-    // Current index for sequential execution
-    UPROPERTY()
-    int32 CurrentSequentialIndex;
+    // Children that have to complete in Quorum mode, clamped to the number of children
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sequence", meta = (ClampMin = "1", UIMin = "1", EditCondition = "ExecutionType == EObjectiveExecutionType::Quorum", EditConditionHides))
+    int32 RequiredChildCount = 1;
 
-    // Number of completed children
-    UPROPERTY()
-    int32 CompletedChildCount;
+    // Summed ObjectiveWeight of completed children needed in WeightedThreshold mode
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sequence", meta = (ClampMin = "0", UIMin = "0", EditCondition = "ExecutionType == EObjectiveExecutionType::WeightedThreshold", EditConditionHides))
+    float WeightThreshold = 1.0f;
 
-    // Number of failed children
+protected:
+    // Child objectives in execution order, compiled once from the sequence pin chain and shared by every run
     UPROPERTY()
-    int32 FailedChildCount;
+    TArray<UNerveQuestRuntimeObjectiveBase*> ChildObjectives;
 
-    // Whether the sequence has started
-    UPROPERTY()
-    bool bSequenceStarted;
+    // Whether ChildObjectives holds the compiled plan; the graph of a quest asset does not change at runtime
+    bool bPlanCompiled = false;
 
 public:
     // UNerveQuestRuntimeObjectiveBase interface
@@ -77,7 +99,7 @@ public:
     virtual void CleanUpObjective_Implementation() override;
     virtual bool CanGenerateOptionals_Implementation() override { return true; }
 
-    // Sequence-specific methods
+    // Sequence-specific methods, reading the active run
     UFUNCTION(BlueprintCallable, Category = "Sequence")
     TArray<UNerveQuestRuntimeObjectiveBase*> GetActiveChildObjectives() const;
 
@@ -91,17 +113,45 @@ public:
     bool IsSequenceComplete() const;
 
 protected:
-    // Internal methods
-    bool CollectChildObjectives();
-    void AccumulateAllSequenceChildren(class UNerveQuestRuntimeObjectiveBase* ParentNode);
-    void ExecuteSequential();
-    void ExecuteParallel();
-    void RestartSequence();
+    virtual TSharedRef<FNerveObjectiveRun> MakeRun() const override;
 
-    // Child objective event handlers
-    UFUNCTION()
-    void OnChildObjectiveCompleted(UNerveQuestRuntimeObjectiveBase* CompletedObjective);
+    // Internal methods; the run is always the active one
+    /** Walks the sequence pin chain once and caches the children in execution order */
+    bool CompileSequencePlan();
+    void ResetChildState(FNerveSequenceObjectiveRun& Run) const;
+    void ExecuteSequential(FNerveSequenceObjectiveRun& Run);
+    void ExecuteParallel(FNerveSequenceObjectiveRun& Run);
+    void RestartSequence(FNerveSequenceObjectiveRun& Run);
 
-    UFUNCTION()
-    void OnChildObjectiveFailed(UNerveQuestRuntimeObjectiveBase* FailedObjective);
+    /** Marks a child active, creates its run with a native finish callback and executes it */
+    void StartChild(FNerveSequenceObjectiveRun& Run, int32 ChildIndex);
+
+    /** Marks a child inactive and unbinds it, cleaning it up when it is cancelled rather than finished */
+    void StopChild(FNerveSequenceObjectiveRun& Run, int32 ChildIndex, bool bCleanUp);
+
+    /** Completes or fails the sequence once, cancelling every child still running */
+    void FinishSequence(FNerveSequenceObjectiveRun& Run, bool bCompleted);
+
+    /**
+     * Finishes a non-sequential sequence once its outcome is decided: all children done for Parallel,
+     * the threshold reached or out of reach for the other modes. "All done" and "out of reach" wait
+     * until every child was started.
+     */
+    void CheckParallelFinished(FNerveSequenceObjectiveRun& Run);
+
+    /** @return True for modes that finish on a threshold rather than after every child. */
+    bool IsThresholdMode() const;
+
+    /** @return Children that have to complete in Quorum and Race mode. */
+    int32 GetRequiredChildCount() const;
+
+    float GetChildWeight(int32 ChildIndex) const;
+
+    /** @return Progress of the run towards completion, 0 to 1. */
+    float GetSequenceProgress(const FNerveSequenceObjectiveRun& Run) const;
+
+    // Child objective event handlers
+    void HandleChildFinished(FNerveObjectiveRun& ChildRun, bool bCompleted, TWeakPtr<FNerveObjectiveRun> WeakSequenceRun, int32 ChildIndex);
+    void OnChildObjectiveCompleted(FNerveSequenceObjectiveRun& Run, int32 ChildIndex);
+    void OnChildObjectiveFailed(FNerveSequenceObjectiveRun& Run, int32 ChildIndex);
 };
\ No newline at end of file
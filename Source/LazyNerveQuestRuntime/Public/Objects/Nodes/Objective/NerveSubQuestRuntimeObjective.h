@@ -7,8 +7,10 @@
 #include "Data/StructsAndEnums/NerveQuestStructsAndEnums.h"
 #include "NerveSubQuestRuntimeObjective.generated.h"
 
+class UNerveObjectiveRuntimeData;
 class UNerveQuestAsset;
 class UNerveQuestRuntimeData;
+class UNerveQuestSubsystem;
 
 UENUM(BlueprintType)
 enum class ESubQuestCompletionBehavior : uint8
@@ -49,6 +51,24 @@ enum class ESubQuestFailureBehavior : uint8
     IgnoreFailure UMETA(DisplayName = "Ignore Failure")
 };
 
+/** Sub-quest and restart count of one run of a sub-quest objective */
+struct FNerveSubQuestObjectiveRun : public FNerveObjectiveRun
+{
+    virtual void AddReferencedObjects(FReferenceCollector& Collector, const UObject* Referencer) override;
+
+    /** Runtime data for the sub-quest (not registered in main quest system) */
+    TObjectPtr<UNerveQuestRuntimeData> SubQuestRuntimeData;
+
+    /** Reference to the main quest subsystem */
+    TWeakObjectPtr<UNerveQuestSubsystem> QuestSubsystem;
+
+    /** Current restart attempt count */
+    int32 CurrentRestartAttempts = 0;
+
+    /** Whether this objective is currently being tracked */
+    bool bIsCurrentlyTracked = false;
+};
+
 /**
  * An objective that can run another quest as a nested sequence
  * The sub-quest runs independently without being registered in the main quest system
@@ -93,21 +113,6 @@ protected:
     meta = (EditCondition = "FailureBehavior == ESubQuestFailureBehavior::RestartSubQuest", EditConditionHides = true, ClampMin = "1", ClampMax = "10"))
     int32 MaxRestartAttempts = 3;
 
-private:
-    /** Runtime data for the sub-quest (not registered in main quest system) */
-    UPROPERTY()
-    UNerveQuestRuntimeData* SubQuestRuntimeData;
-
-    /** Reference to the main quest subsystem */
-    UPROPERTY()
-    class UNerveQuestSubsystem* QuestSubsystem;
-
-    /** Current restart attempt count */
-    int32 CurrentRestartAttempts = 0;
-
-    /** Whether this objective is currently being tracked */
-    bool bIsCurrentlyTracked = false;
-
 public:
     // UNerveQuestRuntimeObjectiveBase interface
     virtual FText GetObjectiveName_Implementation() override;
@@ -127,8 +132,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Sub-Quest")
     bool IsSubQuestValid() const;
 
+    /**
+     * Gets the sub-quest runtime data of the active run. It is owned by the run and pooled on cleanup, so references
+     * kept past that must store GetSerial and check IsSameQuestInstance before use
+     * @return The sub-quest runtime data, null while no sub-quest runs
+     */
     UFUNCTION(BlueprintCallable, Category = "Sub-Quest")
-    UNerveQuestRuntimeData* GetSubQuestRuntimeData() const { return SubQuestRuntimeData; }
+    UNerveQuestRuntimeData* GetSubQuestRuntimeData() const;
 
     UFUNCTION(BlueprintCallable, Category = "Sub-Quest")
     bool RestartSubQuest();
@@ -143,29 +153,25 @@ public:
     FText GetCurrentSubQuestObjectiveText() const;
 
 protected:
+    virtual TSharedRef<FNerveObjectiveRun> MakeRun() const override;
+
     /** Initialize the sub-quest runtime data */
-    bool InitializeSubQuest();
+    bool InitializeSubQuest(FNerveSubQuestObjectiveRun& Run);
 
     /** Clean up the sub-quest runtime data */
-    void CleanupSubQuest();
+    void CleanupSubQuest(FNerveSubQuestObjectiveRun& Run);
 
     /** Start the sub-quest execution */
-    void StartSubQuest();
-
-    /** Handle sub-quest completion */
-    UFUNCTION()
-    void OnSubQuestCompleted(UNerveQuestRuntimeData* CompletedQuest);
+    void StartSubQuest(FNerveSubQuestObjectiveRun& Run);
 
-    /** Handle sub-quest failure */
-    UFUNCTION()
-    void OnSubQuestFailed(UNerveQuestRuntimeData* FailedQuest);
+    /** Handle sub-quest completion or failure */
+    void OnSubQuestFinished(UNerveQuestRuntimeData* FinishedQuest, bool bCompleted, TWeakPtr<FNerveObjectiveRun> WeakRun);
 
     /** Handle sub-quest objective completion (for specific objective tracking) */
-    UFUNCTION()
-    void OnSubQuestObjectiveCompleted(class UNerveQuestRuntimeObjectiveBase* CompletedObjective);
+    void OnSubQuestObjectiveFinished(UNerveObjectiveRuntimeData* FinishedObjective, bool bCompleted, TWeakPtr<FNerveObjectiveRun> WeakRun);
 
     /** Update tracking behavior based on settings */
-    void UpdateSubQuestTracking();
+    void UpdateSubQuestTracking(const FNerveSubQuestObjectiveRun& Run) const;
 
     /** Get the quest subsystem reference */
     class UNerveQuestSubsystem* GetQuestSubsystem() const;
@@ -4,8 +4,29 @@
 
 #include "CoreMinimal.h"
 #include "NerveQuestRuntimeObjectiveBase.h"
+#include "Data/Timing/NerveQuestTimingWheel.h"
 #include "NerveWaitObjective.generated.h"
 
+class UNerveQuestTimerSubsystem;
+
+/** Timer of one run of a wait objective */
+struct FNerveWaitObjectiveRun : public FNerveObjectiveRun
+{
+    virtual ~FNerveWaitObjectiveRun() override;
+
+    /** Wait duration of this run, quest parameters applied */
+    float WaitDuration = 0.0f;
+
+    // Timer handle for managing the wait duration, on the quest timing wheel
+    FNerveQuestTimerHandle WaitTimerHandle;
+
+    float CurrentWaitDuration = 0;
+
+    TWeakObjectPtr<UNerveQuestTimerSubsystem> TimerSubsystem;
+
+    void ClearWaitTimer();
+};
+
 /**
  * A quest objective that introduces a delay before completion.
  * This objective pauses quest progression for a specified duration, with an option to keep the UI displayed or hide it during the wait.
@@ -24,15 +45,14 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wait Objective")
     bool bKeepUIDisplayed = false;
 
+    /** Clock the wait is measured on. Game time stops while the game is paused. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wait Objective")
+    ENerveQuestClock WaitClock = ENerveQuestClock::GameTime;
+
     /** The class of the progress tracker to be used if bGenerateProgressTracker is true. This will be hidden when bGenerateProgressTracker is false. */
     UPROPERTY(EditAnywhere, Category="UI", meta=(EditCondition = "bGenerateProgressTracker", EditConditionHides = "bGenerateProgressTracker"))
     float ProgressInterval = 0.02;
 
-    // Timer handle for managing the wait duration
-    FTimerHandle WaitTimerHandle;
-
-    float CurrentWaitDuration = 0;
-
 public:
     /** Default constructor. Initializes default values for properties. */
     UNerveWaitObjective();
@@ -56,9 +76,14 @@ public:
      */
     virtual void ExecuteObjective_Implementation(UNerveQuestAsset* NerveQuestAsset) override;
 
+    /** Cancels a pending wait. */
+    virtual void CleanUpObjective_Implementation() override;
+
 protected:
+    virtual TSharedRef<FNerveObjectiveRun> MakeRun() const override;
+
     /** Callback function triggered when the wait duration has elapsed. Completes the objective. */
-    void OnWaitComplete();
+    void OnWaitComplete(TWeakPtr<FNerveObjectiveRun> WeakRun);
 
     void UpdateUI(bool Visible);
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Data/StructsAndEnums/NerveQuestStructsAndEnums.h"
 #include "Engine/DeveloperSettings.h"
+#include "Fonts/SlateFontInfo.h"
+#include "Styling/SlateBrush.h"
 #include "NerveQuestRuntimeSetting.generated.h"
 
 /**
@@ -24,7 +26,131 @@ public:
 	UPROPERTY(config, EditAnywhere, Category="Quest")
 	int32 QuestScreenZOrder = 0;
 
+	/** Smallest normalized progress change (0-1) delivered to a progress tracker. Smaller changes are coalesced until they add up, or shown once progress stops changing for a frame. */
+	UPROPERTY(config, EditAnywhere, Category="Progress", meta=(ClampMin="0.0", ClampMax="1.0", UIMin="0.0", UIMax="0.1"))
+	float MinProgressDeliveryDelta = 0.005f;
+
 	// New property for distance conversion settings
 	UPROPERTY(config, EditAnywhere, Category="Distance Conversion")
 	FNerveDistanceConversionSettings DistanceConversions;
+
+	/** How world pings are drawn. The overlay draws every ping in one paint pass; widget components allow fully custom ping widgets. */
+	UPROPERTY(config, EditAnywhere, Category="Pings")
+	ENervePingRenderMode PingRenderMode = ENervePingRenderMode::WidgetComponent;
+
+	/** Ping widget used when an objective does not provide its own */
+	UPROPERTY(config, EditAnywhere, Category="Pings")
+	TSubclassOf<class UWorldGotoPing> DefaultPingWidgetClass = nullptr;
+
+	/** Seconds between ping screen updates, zero updates every frame */
+	UPROPERTY(config, EditAnywhere, Category="Pings", meta=(ClampMin="0.0", Units="s"))
+	float PingUpdateRate = 0.016f;
+
+	/** Distance in pixels kept between off-screen edge markers and the viewport border */
+	UPROPERTY(config, EditAnywhere, Category="Pings", meta=(ClampMin="0.0"))
+	float PingEdgeMargin = 50.0f;
+
+	/** Idle ping widget components kept for reuse per widget class */
+	UPROPERTY(config, EditAnywhere, Category="Pings", meta=(ClampMin="0"))
+	int32 MaxPooledPingWidgetsPerClass = 8;
+
+	/**
+	 * Distance tiers for refreshing far overlay markers less often, e.g. 5000 every 0.1 s and 20000 every 0.25 s.
+	 * Pings closer than the first tier update every time. Empty by default; widget components are always updated.
+	 */
+	UPROPERTY(config, EditAnywhere, Category="Pings|LOD")
+	TArray<FNervePingLodTier> PingLodTiers;
+
+	/** How quickly overlay markers of throttled tiers glide to their latest position */
+	UPROPERTY(config, EditAnywhere, Category="Pings|LOD", meta=(ClampMin="0.0"))
+	float PingLodInterpSpeed = 12.0f;
+
+	/** Extrapolate moving ping targets from their velocity between location updates, so objectives can poll slowly */
+	UPROPERTY(config, EditAnywhere, Category="Pings|Prediction")
+	bool bPredictPingMotion = true;
+
+	/** Longest time a ping keeps extrapolating past its last location update */
+	UPROPERTY(config, EditAnywhere, Category="Pings|Prediction", meta=(ClampMin="0.0", Units="s", EditCondition="bPredictPingMotion"))
+	float MaxPingExtrapolationTime = 0.3f;
+
+	/** How quickly a ping's prediction error is removed when a new location arrives */
+	UPROPERTY(config, EditAnywhere, Category="Pings|Prediction", meta=(ClampMin="0.0", EditCondition="bPredictPingMotion"))
+	float PingCorrectionSpeed = 10.0f;
+
+	/** Prediction errors larger than this are treated as teleports and snapped instead of smoothed */
+	UPROPERTY(config, EditAnywhere, Category="Pings|Prediction", meta=(ClampMin="0.0", EditCondition="bPredictPingMotion"))
+	float PingSnapDistance = 1000.0f;
+
+	/** Trace from each viewer to their drawn pings so widgets can show when the target is behind geometry */
+	UPROPERTY(config, EditAnywhere, Category="Pings|Occlusion")
+	bool bTracePingOcclusion = false;
+
+	UPROPERTY(config, EditAnywhere, Category="Pings|Occlusion", meta=(EditCondition="bTracePingOcclusion"))
+	TEnumAsByte<ECollisionChannel> PingOcclusionChannel = ECC_Visibility;
+
+	/** Async traces started per ping update; pings are visited round-robin so every ping is refreshed in turn */
+	UPROPERTY(config, EditAnywhere, Category="Pings|Occlusion", meta=(ClampMin="1", EditCondition="bTracePingOcclusion"))
+	int32 MaxOcclusionTracesPerUpdate = 8;
+
+	/** Traces stop this far short of the target so the target's own collision does not count as occlusion */
+	UPROPERTY(config, EditAnywhere, Category="Pings|Occlusion", meta=(ClampMin="0.0", EditCondition="bTracePingOcclusion"))
+	float OcclusionTargetTolerance = 100.0f;
+
+	/** Tint applied by the overlay to markers whose target is occluded */
+	UPROPERTY(config, EditAnywhere, Category="Pings|Overlay", meta=(EditCondition="PingRenderMode == ENervePingRenderMode::SingleOverlay"))
+	FLinearColor OverlayOccludedTint = FLinearColor(1.0f, 1.0f, 1.0f, 0.4f);
+
+	/** Maximum markers drawn at once, tracked quests first then nearest. Zero means no cap. */
+	UPROPERTY(config, EditAnywhere, Category="Pings|LOD", meta=(ClampMin="0"))
+	int32 MaxRenderedPings = 0;
+
+	/** Merge off-screen edge markers that point in a similar direction into one marker with a count */
+	UPROPERTY(config, EditAnywhere, Category="Pings|LOD")
+	bool bClusterOffScreenPings = false;
+
+	/** Widest angle, seen from the screen centre, covered by one off-screen cluster */
+	UPROPERTY(config, EditAnywhere, Category="Pings|LOD", meta=(ClampMin="0.0", ClampMax="180.0", Units="deg", EditCondition="bClusterOffScreenPings"))
+	float OffScreenClusterAngle = 10.0f;
+
+	/** Marker drawn at on-screen pings by the overlay */
+	UPROPERTY(config, EditAnywhere, Category="Pings|Overlay", meta=(EditCondition="PingRenderMode == ENervePingRenderMode::SingleOverlay"))
+	FSlateBrush OverlayMarkerBrush;
+
+	/** Marker drawn at the screen edge for off-screen pings by the overlay */
+	UPROPERTY(config, EditAnywhere, Category="Pings|Overlay", meta=(EditCondition="PingRenderMode == ENervePingRenderMode::SingleOverlay"))
+	FSlateBrush OverlayEdgeMarkerBrush;
+
+	/** Font used for distance labels drawn by the overlay */
+	UPROPERTY(config, EditAnywhere, Category="Pings|Overlay", meta=(EditCondition="PingRenderMode == ENervePingRenderMode::SingleOverlay"))
+	FSlateFontInfo OverlayLabelFont;
+
+	UPROPERTY(config, EditAnywhere, Category="Pings|Overlay", meta=(EditCondition="PingRenderMode == ENervePingRenderMode::SingleOverlay"))
+	FLinearColor OverlayLabelColor = FLinearColor::White;
+
+	/** Z-order of the overlay within the player's viewport */
+	UPROPERTY(config, EditAnywhere, Category="Pings|Overlay", meta=(EditCondition="PingRenderMode == ENervePingRenderMode::SingleOverlay"))
+	int32 OverlayZOrder = 0;
+
+	/** Tick length of the quest timing wheels. Timers fire on the first tick at or after their deadline. */
+	UPROPERTY(config, EditAnywhere, Category="Quest Timers", meta=(ClampMin="0.001", ClampMax="1.0", Units="s"))
+	float QuestTimerResolution = 0.01f;
+
+	/**
+	 * Actor classes, subclasses included, indexed as quest targets from world begin play.
+	 * Objectives register the classes they target at runtime as well; actors of other classes are never indexed.
+	 */
+	UPROPERTY(config, EditAnywhere, Category="Quest Targets")
+	TArray<TSoftClassPtr<AActor>> QuestTargetClasses;
+
+	/** Edge length of the spatial cells quest targets are bucketed into for radius queries */
+	UPROPERTY(config, EditAnywhere, Category="Quest Targets", meta=(ClampMin="100.0", Units="cm"))
+	float QuestTargetCellSize = 5000.0f;
+
+	/** Finished quest runtime data kept per local player for reuse by the next quest or sub-quest */
+	UPROPERTY(config, EditAnywhere, Category="Runtime Data Pools", meta=(ClampMin="0"))
+	int32 MaxPooledQuestRuntimeData = 16;
+
+	/** Finished objective runtime data kept per local player for reuse, including optional objectives */
+	UPROPERTY(config, EditAnywhere, Category="Runtime Data Pools", meta=(ClampMin="0"))
+	int32 MaxPooledObjectiveRuntimeData = 128;
 };
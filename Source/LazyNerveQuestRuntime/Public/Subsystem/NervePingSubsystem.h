@@ -0,0 +1,313 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/StructsAndEnums/NerveQuestStructsAndEnums.h"
+#include "Engine/EngineTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "NervePingSubsystem.generated.h"
+
+class SNervePingOverlay;
+class ULocalPlayer;
+class UWidgetComponent;
+class UWorldGotoPing;
+
+/**
+ * Structure-of-arrays scratch buffers for projecting every active ping in one pass.
+ * Kept on the subsystem so the buffers are reused between updates.
+ */
+struct FPingProjectionBatch
+{
+    TArray<int32> SlotIndices;
+    TArray<int32> ViewIndices;
+    TArray<double> WorldX;
+    TArray<double> WorldY;
+    TArray<double> WorldZ;
+    TArray<float> ScreenX;
+    TArray<float> ScreenY;
+    TArray<float> FinalX;
+    TArray<float> FinalY;
+    TArray<uint8> bProjected;
+    TArray<uint8> bOnScreen;
+
+    void Reset(const int32 Capacity)
+    {
+        SlotIndices.Reset(Capacity);
+        ViewIndices.Reset(Capacity);
+        WorldX.Reset(Capacity);
+        WorldY.Reset(Capacity);
+        WorldZ.Reset(Capacity);
+    }
+
+    void SetOutputNum(const int32 Num)
+    {
+        ScreenX.SetNumUninitialized(Num);
+        ScreenY.SetNumUninitialized(Num);
+        FinalX.SetNumUninitialized(Num);
+        FinalY.SetNumUninitialized(Num);
+        bProjected.SetNumUninitialized(Num);
+        bOnScreen.SetNumUninitialized(Num);
+    }
+};
+
+/** View of one local player, refreshed once per update and shared by all of that player's pings */
+struct FPingPlayerView
+{
+    TWeakObjectPtr<ULocalPlayer> LocalPlayer;
+    FMatrix ViewProjectionMatrix = FMatrix::Identity;
+    FVector ViewOrigin = FVector::ZeroVector;
+    FVector2D ViewportSize = FVector2D::ZeroVector;
+
+    /** False when the player has no viewport or projection this update */
+    bool bValid = false;
+
+    /** This player's overlay in SingleOverlay mode, created on first use */
+    TSharedPtr<SNervePingOverlay> Overlay;
+};
+
+/**
+ * Owns every world ping of a game world. Created with the world, so objectives reach it
+ * through UWorld::GetSubsystem instead of searching for or spawning a manager actor.
+ * Ticks only while pings or the ping overlay exist.
+ */
+UCLASS()
+class LAZYNERVEQUESTRUNTIME_API UNervePingSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+private:
+    /** Sparse ping slots addressed by handle; released slots are reused through FreePingSlots */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Ping Management", meta = (AllowPrivateAccess = "true"))
+    TArray<FPingComponent> PingComponents;
+
+    /** Indices of released slots in PingComponents */
+    TArray<int32> FreePingSlots;
+
+    /** Dense list of the slots currently in use, iterated on update */
+    TArray<int32> ActivePingSlots;
+
+    /** Hidden widget components kept for reuse, keyed by widget class */
+    UPROPERTY()
+    TMap<TObjectPtr<UClass>, FPingWidgetComponentPool> WidgetComponentPools;
+
+    /** Maximum number of idle widget components kept per widget class */
+    int32 MaxPooledWidgetsPerClass = 8;
+
+    UPROPERTY()
+    TSubclassOf<UUserWidget> DefaultPingWidgetClass = nullptr;
+
+    float EdgeMargin = 50.0f;
+
+    /** Seconds between ping updates, zero updates every frame */
+    float UpdateRate = 0.016f; // ~60 FPS
+
+    float TimeSinceLastUpdate = 0.0f;
+
+    /** Objects that suspended ping updates, e.g. the quest subsystem while every quest is paused */
+    TArray<TWeakObjectPtr<const UObject>> UpdateSuspenders;
+
+    /** Ascending squared start distances of the LOD tiers and their update intervals, copied from the settings */
+    TArray<double> LodTierDistancesSquared;
+    TArray<float> LodTierIntervals;
+    float LodInterpSpeed = 12.0f;
+
+    /** "xN" labels of clustered overlay markers, indexed by cluster count and formatted once */
+    TArray<FString> ClusterLabels;
+
+    /** Motion prediction settings, see UNerveQuestRuntimeSetting */
+    bool bPredictPingMotion = true;
+    float MaxPingExtrapolationTime = 0.3f;
+    float PingCorrectionSpeed = 10.0f;
+    double PingSnapDistanceSquared = 0.0;
+
+    /** Marker cap, zero for none */
+    int32 MaxRenderedPings = 0;
+
+    bool bClusterOffScreenPings = true;
+
+    /** Cluster width in radians */
+    float OffScreenClusterAngle = 0.0f;
+
+    /** Occlusion trace settings, see UNerveQuestRuntimeSetting */
+    bool bTracePingOcclusion = false;
+    TEnumAsByte<ECollisionChannel> PingOcclusionChannel = ECC_Visibility;
+    int32 MaxOcclusionTracesPerUpdate = 8;
+    float OcclusionTargetTolerance = 100.0f;
+
+    /** Position in ActivePingSlots where the next round of occlusion traces starts */
+    int32 OcclusionCursor = 0;
+
+    /** Completion callback shared by every occlusion trace */
+    FTraceDelegate OcclusionTraceDelegate;
+
+    /** Local player views, one per player of the game instance */
+    TArray<FPingPlayerView> PlayerViews;
+
+    /** Slots that may be drawn this update, grouped by view then sorted tracked first and nearest */
+    TArray<int32> RenderCandidates;
+
+    /** Screen angle and candidate rank of each off-screen ping, reused between updates */
+    TArray<TPair<float, int32>> OffScreenClusterScratch;
+
+    /** Handles pack the slot index in the low bits and the slot generation above it */
+    static constexpr int32 PingHandleIndexBits = 16;
+    static constexpr int32 PingHandleIndexMask = (1 << PingHandleIndexBits) - 1;
+    static constexpr int32 PingHandleGenerationMask = 0x7FFF;
+
+    FPingProjectionBatch ProjectionBatch;
+
+    /** Render mode read from the runtime settings when the subsystem is created */
+    ENervePingRenderMode RenderMode = ENervePingRenderMode::WidgetComponent;
+
+public:
+    //~ Begin USubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    //~ End USubsystem Interface
+
+    //~ Begin FTickableGameObject Interface
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+    //~ End FTickableGameObject Interface
+
+    /**
+     * Returns the ping subsystem of the world the context object lives in.
+     * @param WorldContextObject Any object with a valid world.
+     * @return The subsystem, or null for worlds without game play (editor, preview).
+     */
+    UFUNCTION(BlueprintPure, Category = "Ping Management", meta = (WorldContext = "WorldContextObject"))
+    static UNervePingSubsystem* GetPingSubsystem(const UObject* WorldContextObject);
+	
+    /**
+     * Creates a ping shown to one local player.
+     * @param WorldLocation Where the ping points.
+     * @param WidgetClass Ping widget, or the default ping widget from the settings when null.
+     * @param OwningPlayer Local player that sees the ping; the primary player when null.
+     * @return Handle of the new ping, or -1 on failure.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Ping Management")
+    int32 CreatePing(const FVector& WorldLocation, TSubclassOf<UUserWidget> WidgetClass = nullptr, ULocalPlayer* OwningPlayer = nullptr);
+
+    /** Reports a new target location; the velocity used for prediction is estimated from the previous report */
+    UFUNCTION(BlueprintCallable, Category = "Ping Management")
+    bool UpdatePingLocation(int32 PingID, const FVector& NewWorldLocation);
+
+    /**
+     * Reports a new target location together with its velocity.
+     * Between reports the ping extrapolates from the velocity and smoothly absorbs prediction errors.
+     * @param PingID Ping to update.
+     * @param NewWorldLocation Authoritative target location.
+     * @param Velocity Target velocity in world units per second.
+     * @return False when the ping no longer exists.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Ping Management")
+    bool UpdatePingMotion(int32 PingID, const FVector& NewWorldLocation, const FVector& Velocity);
+
+    UFUNCTION(BlueprintCallable, Category = "Ping Management")
+    bool UpdatePingDistance(int32 PingID, float NewDistance, ENerveDistanceConversionMethod ConversionMethod);
+
+    UFUNCTION(BlueprintCallable, Category = "Ping Management")
+    bool SetPingVisibility(int32 PingID, bool bVisible);
+
+    /** Marks a ping as belonging to a tracked quest so it wins over others when markers are capped */
+    UFUNCTION(BlueprintCallable, Category = "Ping Management")
+    bool SetPingTracked(int32 PingID, bool bTracked);
+
+    UFUNCTION(BlueprintCallable, Category = "Ping Management")
+    bool RemovePing(int32 PingID);
+
+    UFUNCTION(BlueprintCallable, Category = "Ping Management")
+    void RemoveAllPings();
+
+    UFUNCTION(BlueprintCallable, Category = "Ping Management")
+    bool IsPingValid(int32 PingID) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Ping Management")
+    FPingData GetPingData(int32 PingID) const;
+
+    /**
+     * Stops updating pings until every requester resumed; pings keep their last screen state meanwhile.
+     * @param Requester Object suspending the updates, released automatically when it is destroyed.
+     */
+    void SuspendPingUpdates(const UObject* Requester);
+
+    /** Drops a suspension added by SuspendPingUpdates */
+    void ResumePingUpdates(const UObject* Requester);
+
+    /** @return True while any live requester keeps ping updates suspended. */
+    bool ArePingUpdatesSuspended() const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    void UpdateAllPings(float DeltaTime);
+
+    /** Records an authoritative sample and sets up the correction toward it */
+    void ApplyPingSample(FPingComponent& PingComponent, const FVector& Location, const FVector& Velocity);
+
+    /** Moves predicted pings along their velocity and decays their correction offsets */
+    void AdvancePredictedPings(float DeltaTime);
+
+    /** Starts up to MaxOcclusionTracesPerUpdate async traces for rendered pings, continuing where the last update stopped */
+    void IssueOcclusionTraces();
+
+    /** Async trace completion; stale results for removed pings are dropped by the handle check */
+    void OnOcclusionTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+    /** Updates the view of every local player, dropping views of players that left */
+    void RefreshPlayerViews();
+
+    /** @return Index of the player's view in PlayerViews, or INDEX_NONE. */
+    int32 FindPlayerView(const ULocalPlayer* LocalPlayer) const;
+
+    /** Projects and edge-clamps every batched ping against its owner's view in a single branch-light pass */
+    void ProjectPingBatch();
+
+    /** Writes projected results back to ping data, touching widgets only when something changed */
+    void ApplyPingBatch();
+
+    /** Clusters off-screen markers and applies the marker cap to RenderCandidates, per player view */
+    void SelectRenderedPings();
+
+    /** Clustering and marker cap for the candidates of one view, in RenderCandidates[Begin, End) */
+    void SelectRenderedPingsForView(int32 Begin, int32 End, const FVector2D& ViewportSize);
+
+    /** Shows, hides and updates cluster counts of widget components after selection */
+    void ApplyWidgetRenderState();
+
+    /** Rebuilds each player's overlay marker list from their rendered pings */
+    void UpdatePingOverlays(float DeltaTime);
+
+    /**
+     * Finds the LOD tier for a viewer distance.
+     * @param DistanceSquared Squared distance from the viewer.
+     * @param OutInterval Seconds until the ping should be projected again.
+     * @return Tier index, 0 for pings nearer than every configured tier.
+     */
+    int32 GetLodTier(double DistanceSquared, float& OutInterval) const;
+
+    /** @return The overlay label of a marker standing for ClusterCount pings, formatted on first use. */
+    const FString& GetClusterLabel(int32 ClusterCount);
+
+    FPingComponent* FindPingByID(int32 PingID);
+    const FPingComponent* FindPingByID(int32 PingID) const;
+
+private:
+    static int32 MakePingHandle(int32 SlotIndex, int32 Generation);
+    int32 AllocatePingSlot();
+    void ReleasePingSlot(int32 SlotIndex);
+
+    UWidgetComponent* AcquireWidgetComponent(const TSubclassOf<UUserWidget>& WidgetClass);
+    void ReleaseWidgetComponent(UWidgetComponent* WidgetComponent);
+    UWidgetComponent* CreateWidgetComponent(const TSubclassOf<UUserWidget>& WidgetClass);
+    void CleanupPingComponent(FPingComponent& PingComponent);
+    void DestroyPooledWidgetComponents();
+
+    bool UsesPingOverlay() const { return RenderMode == ENervePingRenderMode::SingleOverlay; }
+    void EnsurePingOverlay(FPingPlayerView& PlayerView);
+    void RemovePingOverlay(FPingPlayerView& PlayerView);
+    void RemoveAllPingOverlays();
+};
\ No newline at end of file
@@ -0,0 +1,81 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Data/Runtime/NerveObjectiveRun.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NerveQuestEventSubsystem.generated.h"
+
+/**
+ * Aggregates gameplay events (kills, pickups, interactions) reported by the game and feeds them to
+ * counter objectives once per frame. Reporting only adds to a per-tag total, so an area attack that
+ * kills fifty enemies costs fifty map additions and a single progress update per listening objective.
+ * Counters are registered per run, so quests sharing a counter node count separately.
+ * Ticks only on frames where counts are pending.
+ */
+UCLASS()
+class LAZYNERVEQUESTRUNTIME_API UNerveQuestEventSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //~ Begin USubsystem Interface
+    virtual void Deinitialize() override;
+    //~ End USubsystem Interface
+
+    //~ Begin FTickableGameObject Interface
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+    //~ End FTickableGameObject Interface
+
+    /**
+     * Returns the quest event subsystem of the world the context object lives in.
+     * @param WorldContextObject Any object with a valid world.
+     * @return The subsystem, or null for worlds without game play (editor, preview).
+     */
+    UFUNCTION(BlueprintPure, Category = "Quest Events", meta = (WorldContext = "WorldContextObject"))
+    static UNerveQuestEventSubsystem* GetQuestEventSubsystem(const UObject* WorldContextObject);
+
+    /**
+     * Reports that a gameplay event happened. Counters listening to the tag or one of its parents
+     * receive the summed amount at the end of the frame.
+     * @param EventTag Event that happened, e.g. Quest.Event.Kill.Goblin.
+     * @param Amount How many times it happened.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Quest Events")
+    void ReportQuestEvent(FGameplayTag EventTag, int32 Amount = 1);
+
+    /** Starts feeding events matching the tag to a run of a counter objective */
+    void RegisterCounter(FNerveObjectiveRun& CounterRun, const FGameplayTag& EventTag);
+
+    /** Stops feeding events to the run and drops its pending count; safe to call from the run's destructor */
+    void UnregisterCounter(const FNerveObjectiveRun* CounterRun);
+
+    /** Adds to a counter run directly; applied together with the frame's events */
+    void QueueCount(FNerveObjectiveRun& CounterRun, int32 Amount);
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    /** Applies the frame's totals to the listening counters */
+    void FlushPendingCounts();
+
+    /** Event totals reported since the last flush */
+    TMap<FGameplayTag, int32> PendingEvents;
+
+    struct FPendingCount
+    {
+        TWeakPtr<FNerveObjectiveRun> Run;
+        int32 Amount = 0;
+    };
+
+    /** Direct increments and distributed event totals per counter run since the last flush */
+    TMap<const FNerveObjectiveRun*, FPendingCount> PendingCounts;
+
+    /** Counter runs keyed by the event tag they listen to */
+    TMap<FGameplayTag, TArray<TWeakPtr<FNerveObjectiveRun>>> CountersByTag;
+};
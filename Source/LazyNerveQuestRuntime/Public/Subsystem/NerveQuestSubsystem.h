@@ -2,22 +2,32 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "Data/Runtime/NerveQuestRuntimeState.h"
 #include "Data/StructsAndEnums/NerveQuestStructsAndEnums.h"
 #include "Objects/NerveQuest/NerveQuestAsset.h"
 #include "Objects/Nodes/Objective/NerveQuestRuntimeObjectiveBase.h"
 #include "Setting/NerveQuestRuntimeSetting.h"
 #include "Subsystems/LocalPlayerSubsystem.h"
+#include "Tickable.h"
 #include "NerveQuestSubsystem.generated.h"
 
 class UNerveObjectiveRuntimeData;
 class UNerveQuestRuntimeData;
 class UNerveQuestAsset;
+class UNerveQuestJournalItem;
+class UNerveQuestTimerSubsystem;
 
 // Delegate declarations for quest-related events
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNerveQuestSubsystemAction, UNerveQuestAsset*, Quest);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FNerveSubQuestSubsystemAction, UNerveQuestAsset*, Quest, bool, Tracked);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNerveQuestAction, UNerveQuestRuntimeData*, Quest);
 
+/** Native end-of-quest callback for the owner of a quest, e.g. a sub-quest objective; bCompleted is false on failure */
+DECLARE_DELEGATE_TwoParams(FNerveQuestFinished, UNerveQuestRuntimeData* /*Quest*/, bool /*bCompleted*/);
+
+/** Native end-of-objective callback; bCompleted is false on failure */
+DECLARE_DELEGATE_TwoParams(FNerveObjectiveRuntimeFinished, UNerveObjectiveRuntimeData* /*Objective*/, bool /*bCompleted*/);
+
 /**
  * @class UNerveQuestSubsystem
  * @brief Manages quest-related functionality for the local player.
@@ -25,9 +35,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNerveQuestAction, UNerveQuestRuntim
  * This subsystem handles quest creation, tracking, progression, and UI integration.
  * It maintains runtime data for quests and objectives, manages optional objectives,
  * and facilitates communication between quest components and UI elements.
+ * It only ticks while it has deferred work, such as coalesced objective progress.
  */
 UCLASS()
-class LAZYNERVEQUESTRUNTIME_API UNerveQuestSubsystem : public ULocalPlayerSubsystem
+class LAZYNERVEQUESTRUNTIME_API UNerveQuestSubsystem : public ULocalPlayerSubsystem, public FTickableGameObject
 {
 	GENERATED_BODY()
 
@@ -95,6 +106,10 @@ protected:
 	UPROPERTY()
 	TArray<TObjectPtr<UNerveObjectiveRuntimeData>> DisplayedObjectives;
 
+	/** Cached journal list items, created on first query and reused by every journal view */
+	UPROPERTY()
+	TMap<TObjectPtr<UNerveQuestRuntimeData>, TObjectPtr<UNerveQuestJournalItem>> JournalItems;
+
 	// --- Event System ---
 	/** Objects registered to receive quest events (using weak references to prevent memory leaks) */
 	UPROPERTY()
@@ -104,6 +119,35 @@ protected:
 	UPROPERTY()
 	TArray<TWeakObjectPtr<UObject>> RegisteredTagReceivers;
 
+	// --- Progress Delivery ---
+	/** Objectives with progress waiting to be delivered to their tracker on the next tick */
+	UPROPERTY()
+	TArray<TWeakObjectPtr<UNerveObjectiveRuntimeData>> PendingProgressObjectives;
+
+	// --- Pause ---
+	/** Set by PauseAllQuests; every quest counts as paused and the subsystem stops ticking */
+	bool bAllQuestsPaused = false;
+
+	// --- Runtime Data Pools ---
+	/** Reset quest runtime data waiting to be reused */
+	UPROPERTY()
+	TArray<TObjectPtr<UNerveQuestRuntimeData>> PooledQuestRuntimeData;
+
+	/** Reset objective runtime data waiting to be reused */
+	UPROPERTY()
+	TArray<TObjectPtr<UNerveObjectiveRuntimeData>> PooledObjectiveRuntimeData;
+
+	FNerveRuntimeDataPoolStats QuestRuntimeDataPoolStats;
+	FNerveRuntimeDataPoolStats ObjectiveRuntimeDataPoolStats;
+
+	/** Objective runtime data handed out and not yet released; reported from AddReferencedObjects with their trackers */
+	TArray<TObjectPtr<UNerveObjectiveRuntimeData>> LiveObjectiveRuntimeData;
+
+	// --- Quest Templates ---
+	/** Quests instantiated from data table rows, kept so a row always maps to the same quest */
+	UPROPERTY()
+	TMap<TObjectPtr<const UDataTable>, FNerveQuestTableInstances> TableQuests;
+
 public:
 	// --- Initialization & Cleanup ---
 	/** Initializes the subsystem and sets up quest runtime settings */
@@ -112,6 +156,16 @@ public:
 	/** Deinitializes the subsystem and cleans up resources */
 	virtual void Deinitialize() override;
 
+	/** Reports live objective runtime data together with the references kept in their unreflected state */
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+	// --- Tick ---
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+	virtual TStatId GetStatId() const override;
+
 	/** Sets up the quest screen widget for UI display */
 	UFUNCTION(BlueprintCallable, Category = "Quest|Setup", meta = (WorldContext = "WorldContextObject"))
 	void SetupQuestScreen();
@@ -135,6 +189,81 @@ public:
 
 	bool AddQuestInternal(UNerveQuestAsset* LoadedQuest, const bool bTrackQuest, UObject* WorldContextObject);
 
+	// --- Quest Templates ---
+	/**
+	 * Adds the quest of a data table row, instantiating it from its template on first use
+	 * @param QuestTable Table with FNerveQuestTemplateRow rows
+	 * @param RowName The row to add
+	 * @param bTrackQuest Whether to track the quest immediately
+	 * @param WorldContextObject The world context for the quest
+	 * @return True if the quest was successfully added
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Templates", meta = (WorldContext = "WorldContextObject"))
+	bool AddQuestFromTable(const UDataTable* QuestTable, FName RowName, bool bTrackQuest = true, UObject* WorldContextObject = nullptr);
+
+	/**
+	 * Gets the quest of a data table row, instantiating it from its template on first use
+	 * @param QuestTable Table with FNerveQuestTemplateRow rows
+	 * @param RowName The row to instantiate
+	 * @return The quest, sharing its template's graph, or null if the row or template is missing
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Templates")
+	UNerveQuestAsset* GetQuestFromTable(const UDataTable* QuestTable, FName RowName);
+
+	/**
+	 * Instantiates every row of a table up front, e.g. while a level loads
+	 * @param QuestTable Table with FNerveQuestTemplateRow rows
+	 * @return Number of rows with a valid quest
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Templates")
+	int32 PreloadQuestTable(const UDataTable* QuestTable);
+
+	/**
+	 * Generates a radiant quest from a template; the same template, seed and quest targets give the same quest
+	 * @param Template Quest with parameter generators
+	 * @param Seed Seed the parameters are drawn from
+	 * @param WorldContextObject World whose quest targets actor parameters are picked from
+	 * @return The generated quest, not added yet
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Templates", meta = (WorldContext = "WorldContextObject"))
+	UNerveQuestAsset* GenerateRadiantQuest(UNerveQuestAsset* Template, int32 Seed, UObject* WorldContextObject = nullptr);
+
+	/**
+	 * Generates a board of radiant quest offers, one per seed derived from the base seed.
+	 * An offer is only the template pointer, its seed and the drawn parameters; all offers run the template's graph,
+	 * keeping their objective state per quest, so hundreds cost little and any number of them can be accepted at once
+	 * @param Template Quest with parameter generators
+	 * @param BaseSeed Seed of the board, e.g. the day number
+	 * @param Count Number of offers
+	 * @param WorldContextObject World whose quest targets actor parameters are picked from
+	 * @return The offers; pass one to AddQuest to accept it
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Templates", meta = (WorldContext = "WorldContextObject"))
+	TArray<UNerveQuestAsset*> GenerateRadiantQuestOffers(UNerveQuestAsset* Template, int32 BaseSeed, int32 Count, UObject* WorldContextObject = nullptr);
+
+	/**
+	 * Generates and adds a radiant quest, e.g. when restoring one from its saved template and seed.
+	 * Quests of the same template run side by side; only a second quest with the same seed is rejected
+	 * @param Template Quest with parameter generators
+	 * @param Seed Seed the parameters are drawn from
+	 * @param bTrackQuest Whether to track the quest immediately
+	 * @param WorldContextObject The world context for the quest
+	 * @return True if the quest was successfully added
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Templates", meta = (WorldContext = "WorldContextObject"))
+	bool AddRadiantQuest(UNerveQuestAsset* Template, int32 Seed, bool bTrackQuest = true, UObject* WorldContextObject = nullptr);
+
+	/**
+	 * Finds an active radiant quest by its template and seed
+	 * @return The quest, or null if none is active
+	 */
+	UFUNCTION(BlueprintPure, Category = "Quest|Templates")
+	UNerveQuestAsset* FindRadiantQuest(const UNerveQuestAsset* Template, int32 Seed) const;
+
+	/** @return Seed of an offer of a board, stable across runs */
+	UFUNCTION(BlueprintPure, Category = "Quest|Templates")
+	static int32 GetRadiantOfferSeed(int32 BaseSeed, int32 OfferIndex);
+
 	/**
 	 * Removes a quest from the system
 	 * @param QuestToRemove The quest to remove
@@ -161,6 +290,54 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Quest|Management")
 	void UntrackQuest(UNerveQuestAsset* QuestToUntrack);
 
+	// --- Pause & Time Dilation ---
+	/**
+	 * Pauses every quest, e.g. while a menu is open: objective clocks freeze, polling stops,
+	 * ping updates are suspended and the subsystem stops ticking until ResumeAllQuests
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Pause")
+	void PauseAllQuests();
+
+	/** Resumes every quest that is not paused on its own through PauseQuest */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Pause")
+	void ResumeAllQuests();
+
+	UFUNCTION(BlueprintPure, Category = "Quest|Pause")
+	bool AreAllQuestsPaused() const { return bAllQuestsPaused; }
+
+	/**
+	 * Pauses a single quest, its objective clocks and polling
+	 * @param Quest The quest to pause
+	 * @return True if the quest is registered
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Pause")
+	bool PauseQuest(UNerveQuestAsset* Quest);
+
+	/**
+	 * Resumes a quest paused through PauseQuest; it stays paused while all quests are paused
+	 * @param Quest The quest to resume
+	 * @return True if the quest is registered
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Pause")
+	bool ResumeQuest(UNerveQuestAsset* Quest);
+
+	/**
+	 * Checks if a quest is paused, on its own or through PauseAllQuests
+	 * @param Quest The quest to check
+	 * @return True if the quest is paused
+	 */
+	UFUNCTION(BlueprintPure, Category = "Quest|Pause")
+	bool IsQuestPaused(const UNerveQuestAsset* Quest) const;
+
+	/**
+	 * Scales the game clock of a quest's objectives, e.g. 0.5 for a slowed-down challenge
+	 * @param Quest The quest to change
+	 * @param TimeDilation Game clock scale, zero freezes the quest's game time timers
+	 * @return True if the quest is registered
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Pause")
+	bool SetQuestTimeDilation(UNerveQuestAsset* Quest, float TimeDilation = 1.0f);
+
 	// --- Sub-Quest Management ---
 	/**
 	 * Creates runtime data for a sub-quest without registering it
@@ -233,6 +410,31 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Quest|UI")
 	TArray<UNerveObjectiveRuntimeData*> GetDisplayableObjectives(UNerveQuestRuntimeData* QuestData) const;
 
+	/**
+	 * Visits the objectives that should be displayed in UI without building an array (C++ only)
+	 * @param QuestData The quest to query
+	 * @param Visitor Called for each displayable objective, oldest branch first
+	 */
+	void ForEachDisplayableObjective(const UNerveQuestRuntimeData* QuestData, TFunctionRef<void(UNerveObjectiveRuntimeData*)> Visitor) const;
+
+	// --- Journal ---
+	/**
+	 * Gets the journal list items for all registered quests, for use with UListView/UTileView
+	 * @param OutItems Receives the journal items
+	 * @param bFilterByCategory Whether to only return quests of QuestCategory
+	 * @param QuestCategory The category to filter by
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Journal")
+	void GetJournalItems(TArray<UNerveQuestJournalItem*>& OutItems, bool bFilterByCategory = false, ENerveQuestCategory QuestCategory = ENerveQuestCategory::InProgress);
+
+	/**
+	 * Gets the journal list item for a single quest
+	 * @param QuestAsset The quest to query
+	 * @return The journal item, or nullptr if the quest is not registered
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Journal")
+	UNerveQuestJournalItem* GetJournalItemForQuest(const UNerveQuestAsset* QuestAsset);
+
 	// --- Event Registration ---
 	/**
 	 * Registers an object to receive quest events
@@ -280,7 +482,8 @@ public:
 
 	// --- Data Access ---
 	/**
-	 * Gets runtime data for a quest
+	 * Gets runtime data for a quest. The subsystem owns the instance and pools it once the quest is removed,
+	 * so callers keeping it past that must store GetSerial and check IsSameQuestInstance before using it again
 	 * @param QuestAsset The quest to query
 	 * @return The quest runtime data
 	 */
@@ -327,6 +530,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Sub-Quest|Query")
 	TArray<UNerveQuestRuntimeData*> GetActiveSubQuests() const;
 
+	/**
+	 * Visits the tracked sub-quests that are not completed yet (C++ only)
+	 * @param Visitor Called for each active sub-quest
+	 */
+	void ForEachActiveSubQuest(TFunctionRef<void(UNerveQuestRuntimeData*)> Visitor) const;
+
 	// --- Helper Functions ---
 	/**
 	 * Gets the currently tracked quest
@@ -369,14 +578,42 @@ public:
 	TArray<UNerveQuestRuntimeData*> GetAllQuestRuntimeData() const;
 
 	/**
+	 * Visits every registered quest without building an array (C++ only)
+	 * @param Visitor Called with each quest asset and its runtime data, both valid
+	 */
+	void ForEachQuest(TFunctionRef<void(UNerveQuestAsset*, UNerveQuestRuntimeData*)> Visitor) const;
+
+	/**
+	 * Gets a copy of the active optional objectives of a quest
+	 * @param ParentQuest The quest to query
+	 * @return The optional objective data, empty if the quest has none
 	 */
 	UFUNCTION(BlueprintPure, Category = "Quest|Helper")
-	FOptionalObjectiveDataArray GetAllOptionalObjectiveDataForQuest(const UNerveQuestRuntimeData* ParentQuest);
+	FOptionalObjectiveDataArray GetAllOptionalObjectiveDataForQuest(const UNerveQuestRuntimeData* ParentQuest) const;
+
+	/**
+	 * Finds the active optional objectives of a quest without copying them (C++ only)
+	 * @param ParentQuest The quest to query
+	 * @return The optional objective data, or null if the quest has none; invalidated when optionals start or stop
+	 */
+	const FOptionalObjectiveDataArray* FindOptionalObjectiveData(const UNerveQuestRuntimeData* ParentQuest) const;
 
 	/**
-	*/
+	 * Gets the active optional objectives started by one objective of a quest
+	 * @param ParentQuest The quest to query
+	 * @param OptionalObjective The objective the optionals belong to
+	 * @return Array of optional objectives
+	 */
 	UFUNCTION(BlueprintPure, Category = "Quest|Helper")
-	TArray<UNerveObjectiveRuntimeData*> GetAllOptionalObjectiveForQuest(const UNerveQuestRuntimeData* ParentQuest, const UNerveObjectiveRuntimeData* OptionalObjective);
+	TArray<UNerveObjectiveRuntimeData*> GetAllOptionalObjectiveForQuest(const UNerveQuestRuntimeData* ParentQuest, const UNerveObjectiveRuntimeData* OptionalObjective) const;
+
+	/**
+	 * Visits the active optional objectives started by one objective of a quest (C++ only)
+	 * @param ParentQuest The quest to query
+	 * @param ParentObjective The objective the optionals belong to
+	 * @param Visitor Called for each optional objective
+	 */
+	void ForEachOptionalObjective(const UNerveQuestRuntimeData* ParentQuest, const UNerveObjectiveRuntimeData* ParentObjective, TFunctionRef<void(UNerveObjectiveRuntimeData*)> Visitor) const;
 
 	/**
 	 * Gets quests of a specific category
@@ -387,7 +624,7 @@ public:
 	TArray<UNerveQuestAsset*> GetQuestOfCategory(ENerveQuestCategory QuestCategory);
 
 	/**
-	 * Gets runtime data by quest asset
+	 * Gets runtime data by quest asset. Owned and pooled by the subsystem, see GetQuestRuntimeData for keeping it
 	 * @param QuestAsset The quest to query
 	 * @return The runtime data
 	 */
@@ -449,6 +686,52 @@ public:
 	 */
 	void BroadcastToTagReceivers(UNerveQuestAsset* QuestAsset, const FGameplayTag& ReceivedGameplayTag);
 
+	// --- Runtime Data Pools ---
+	/**
+	 * Gets reset quest runtime data from the pool, or creates it when the pool is empty
+	 * @return Runtime data ready for Initialize
+	 */
+	UNerveQuestRuntimeData* AcquireQuestRuntimeData();
+
+	/**
+	 * Returns uninitialized quest runtime data to the pool, dropping every reference the subsystem
+	 * still holds to it (tracking, sub-quest tracking, optional objectives, journal)
+	 * @param QuestData The runtime data, already uninitialized
+	 */
+	void ReleaseQuestRuntimeData(UNerveQuestRuntimeData* QuestData);
+
+	/**
+	 * Gets reset objective runtime data from the pool, or creates it when the pool is empty
+	 * @return Runtime data ready for Initialize
+	 */
+	UNerveObjectiveRuntimeData* AcquireObjectiveRuntimeData();
+
+	/**
+	 * Returns uninitialized objective runtime data to the pool
+	 * @param ObjectiveData The runtime data, already uninitialized
+	 */
+	void ReleaseObjectiveRuntimeData(UNerveObjectiveRuntimeData* ObjectiveData);
+
+	/** Drops every pooled instance, e.g. after a large journal was cleared */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Pools")
+	void TrimRuntimeDataPools();
+
+	UFUNCTION(BlueprintPure, Category = "Quest|Pools")
+	FNerveRuntimeDataPoolStats GetQuestRuntimeDataPoolStats() const { return QuestRuntimeDataPoolStats; }
+
+	UFUNCTION(BlueprintPure, Category = "Quest|Pools")
+	FNerveRuntimeDataPoolStats GetObjectiveRuntimeDataPoolStats() const { return ObjectiveRuntimeDataPoolStats; }
+
+	// --- Progress Delivery ---
+	/**
+	 * Queues an objective so its latest progress is delivered once on the next tick
+	 * @param Objective The objective with pending progress
+	 */
+	void QueueProgressDelivery(UNerveObjectiveRuntimeData* Objective);
+
+	/** Delivers all pending objective progress to the tracker widgets */
+	void FlushPendingProgress();
+
 	// --- Callbacks ---
 	/**
 	 * Handles quest completion
@@ -491,6 +774,19 @@ protected:
 	 * @return The optional objective data
 	 */
 	FOptionalObjectiveData* FindOptionalObjectiveData(UNerveQuestRuntimeData* ParentQuest, UNerveObjectiveRuntimeData* OptionalObjective);
+
+	/**
+	 * Finds or creates the cached journal item for a quest
+	 * @param QuestData The quest runtime data
+	 * @return The journal item
+	 */
+	UNerveQuestJournalItem* FindOrAddJournalItem(UNerveQuestRuntimeData* QuestData);
+
+	/**
+	 * Releases the cached journal item for a quest
+	 * @param QuestData The quest runtime data
+	 */
+	void RemoveJournalItem(UNerveQuestRuntimeData* QuestData);
 };
 
 /**
@@ -519,7 +815,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest")
 	bool bIsTracked;
 
-	/** Overall progress of the quest (0-1) */
+	/** Overall progress of the quest (0-1): completed objectives weighted by their ObjectiveWeight, kept up to date by the quest */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest")
 	float OverallProgress;
 
@@ -540,16 +836,29 @@ public:
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category = "Quest|Events")
 	FNerveQuestAction OnQuestFailed;
 
+	/** Broadcast when OverallProgress or the remaining steps change; bind to this instead of polling */
+	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category = "Quest|Events")
+	FNerveQuestAction OnQuestProgressChanged;
+
+	/** Broadcast when QuestStatus changes */
+	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category = "Quest|Events")
+	FNerveQuestAction OnQuestStatusChanged;
+
+	/** Broadcast when the quest is tracked or untracked */
+	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category = "Quest|Events")
+	FNerveQuestAction OnQuestTrackingChanged;
+
+	/** Fired after OnQuestCompleted or OnQuestFailed, for the single native owner of the quest */
+	FNerveQuestFinished OnQuestFinishedNative;
+
 private:
 	// --- Internal Data ---
-	/** All objectives associated with this quest */
-	UPROPERTY()
-	TArray<TObjectPtr<UNerveObjectiveRuntimeData>> AllNerveObjectiveRuntimeData;
-
-	/** Reference to the quest subsystem */
-	UPROPERTY()
+	/** Reference to the quest subsystem; it is the outer, so no reflected reference is needed */
 	TObjectPtr<UNerveQuestSubsystem> QuestHandlerSubSystem;
 
+	/** Objectives, timer scope and pause state, kept out of the reflected object graph */
+	FNerveQuestRuntimeState State;
+
 public:
 	// --- Initialization & Cleanup ---
 	/**
@@ -562,6 +871,28 @@ public:
 
 	/** Cleans up quest resources */
 	void Uninitialize();
+
+	/** Resets every field and unbinds every delegate so the instance can be reused for another quest */
+	void ResetForReuse();
+
+	bool IsPooled() const { return State.bIsPooled; }
+	void SetPooled(const bool bPooled) { State.bIsPooled = bPooled; }
+
+	/**
+	 * Gets the serial of the quest this instance currently holds. Instances are pooled and reused for other
+	 * quests; the serial changes every time, so store it next to any reference kept across frames
+	 * @return The current serial
+	 */
+	UFUNCTION(BlueprintPure, Category = "Quest|Query")
+	int32 GetSerial() const { return State.Serial; }
+
+	/**
+	 * Checks if the instance still holds the quest a reference was taken for
+	 * @param Serial The serial stored with the reference
+	 * @return False once the quest was removed, even if the instance now holds another quest
+	 */
+	UFUNCTION(BlueprintPure, Category = "Quest|Query")
+	bool IsSameQuestInstance(const int32 Serial) const { return !State.bIsPooled && State.Serial == Serial; }
 	
 	/** RAII Destructor - ensures cleanup */
 	virtual void BeginDestroy() override;
@@ -608,20 +939,90 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Quest|Control")
 	void SetQuestHandlerSubSystem(UNerveQuestSubsystem* QuestSubsystem);
 
+	/** Pauses the quest's objectives and timers */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Control")
+	void PauseQuest();
+
+	/** Resumes the quest unless all quests are paused */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Control")
+	void ResumeQuest();
+
+	/**
+	 * Checks if the quest is paused, on its own or through the subsystem
+	 * @return True if paused
+	 */
+	UFUNCTION(BlueprintPure, Category = "Quest|Query")
+	bool IsPaused() const;
+
+	/** Pauses or resumes the objectives to match IsPaused */
+	void RefreshPauseState();
+
+	/** @return True while the running objectives are paused. */
+	bool AreObjectivesPaused() const { return State.bObjectivesPaused; }
+
 	/**
-	 * Advances to the next objective
+	 * Scales the game clock of the quest's timers
+	 * @param NewTimeDilation Game clock scale, zero freezes game time timers
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Control")
+	void SetTimeDilation(float NewTimeDilation);
+
+	UFUNCTION(BlueprintPure, Category = "Quest|Query")
+	float GetTimeDilation() const { return State.TimeDilation; }
+
+	/**
+	 * Gets the quest timer scope, creating it on first use or after the player moved to another world
+	 * @return Timer scope for the quest's objectives, zero when no timer subsystem exists
+	 */
+	int32 GetTimerScope();
+
+	/**
+	 * Advances the branch of the current objective to the next objective
 	 * @param NextNodeIndex The index of the next node
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Quest|Control")
 	void AdvanceToNextObjective(int32 NextNodeIndex = 0);
 
 	/**
-	 * Executes an objective from a pin
+	 * Advances the branch an objective runs on, leaving every other branch where it is
+	 * @param Objective A running objective of this quest
+	 * @param NextNodeIndex The index of the next node
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Control")
+	void AdvanceFromObjective(UNerveObjectiveRuntimeData* Objective, int32 NextNodeIndex = 0);
+
+	/**
+	 * Continues the branch of the current objective from a pin, or starts a branch when none runs
 	 * @param OutPin The output pin to execute
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Quest|Control")
 	void ExecuteObjectiveFromPin(UNerveQuestRuntimePin* OutPin);
 
+	/**
+	 * Gets the objectives every branch of the quest currently waits on; CurrentObjective is one of them
+	 * @param OutObjectives Receives the objectives, oldest branch first
+	 */
+	UFUNCTION(BlueprintPure, Category = "Quest|Query")
+	void GetRunningObjectives(TArray<UNerveObjectiveRuntimeData*>& OutObjectives) const;
+
+	/**
+	 * Visits the objectives every branch of the quest currently waits on (C++ only)
+	 * @param Visitor Called for each running objective, oldest branch first
+	 */
+	void ForEachRunningObjective(TFunctionRef<void(UNerveObjectiveRuntimeData*)> Visitor) const;
+
+	/**
+	 * Checks if a branch of the quest waits on an objective
+	 * @param Objective The objective to check
+	 * @return True while the objective runs
+	 */
+	UFUNCTION(BlueprintPure, Category = "Quest|Query")
+	bool IsObjectiveRunning(const UNerveObjectiveRuntimeData* Objective) const;
+
+	/** @return Number of branches running at the same time. */
+	UFUNCTION(BlueprintPure, Category = "Quest|Query")
+	int32 GetNumRunningBranches() const { return State.Branches.Num(); }
+
 	// --- Optional Objectives ---
 	/** Starts all optional objectives for the current objective */
 	UFUNCTION(BlueprintCallable, Category = "Quest|Optional Objectives")
@@ -637,7 +1038,13 @@ public:
 	 * @return Array of objectives
 	 */
 	UFUNCTION(BlueprintPure, Category = "Quest|Query")
-	TArray<UNerveObjectiveRuntimeData*> GetAllObjectives() { return AllNerveObjectiveRuntimeData; }
+	TArray<UNerveObjectiveRuntimeData*> GetAllObjectives() const { return State.Objectives; }
+
+	/**
+	 * Gets all objectives for the quest without copying them (C++ only)
+	 * @return View of the objectives in graph order; invalidated when objectives are added or removed
+	 */
+	TConstArrayView<TObjectPtr<UNerveObjectiveRuntimeData>> GetObjectiveView() const { return State.Objectives; }
 
 	/**
 	 * Gets quest rewards
@@ -661,6 +1068,46 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Quest|Query")
 	bool GetIsCompleted() const { return bIsCompleted; }
 
+	/**
+	 * Checks if every objective of the quest is completed, without walking them
+	 * @return True if all are completed, or the quest has none
+	 */
+	UFUNCTION(BlueprintPure, Category = "Quest|Query")
+	bool AreAllObjectivesCompleted() const { return State.NumCompletedObjectives == State.Objectives.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "Quest|Query")
+	int32 GetNumCompletedObjectives() const { return State.NumCompletedObjectives; }
+
+	UFUNCTION(BlueprintPure, Category = "Quest|Query")
+	int32 GetNumFailedObjectives() const { return State.NumFailedObjectives; }
+
+	/**
+	 * Gets the share of completed objectives
+	 * @return Completed objectives over all objectives, zero for a quest without any
+	 */
+	UFUNCTION(BlueprintPure, Category = "Quest|Query")
+	float GetCompletedObjectiveFraction() const;
+
+	/**
+	 * Gets the estimated number of objectives left, from the running objectives through the compiled graph
+	 * @return Incomplete objectives ahead of every branch, the running ones included; all alternatives count
+	 */
+	UFUNCTION(BlueprintPure, Category = "Quest|Query")
+	int32 GetRemainingSteps() const { return State.RemainingSteps; }
+
+	/**
+	 * Finds the first objective in graph order that is not completed
+	 * @return The objective, or null if all are completed
+	 */
+	UFUNCTION(BlueprintPure, Category = "Quest|Query")
+	UNerveObjectiveRuntimeData* FindFirstIncompleteObjective() const;
+
+	/**
+	 * Copies an objective's completed and failed flags into the quest's state bits
+	 * @param Objective An objective of this quest
+	 */
+	void UpdateObjectiveState(const UNerveObjectiveRuntimeData* Objective);
+
 	// --- Callbacks ---
 	/**
 	 * Handles objective completion
@@ -688,6 +1135,74 @@ private:
 	 * @param Objective The objective to accumulate
 	 */
 	void AccumulateObjectives(UNerveQuestRuntimeObjectiveBase* Objective);
+
+	/** Releases the timer scope together with every timer still pending in it */
+	void ReleaseTimerScope();
+
+	/** Reassigns objective indices and rebuilds the state bits, counters and compiled graph from the objectives */
+	void RebuildObjectiveStates();
+
+	/** Updates OverallProgress and the remaining steps, broadcasting OnQuestProgressChanged if they changed */
+	void RefreshProgress();
+
+	/** Sets QuestStatus, broadcasting OnQuestStatusChanged if it changed */
+	void SetQuestStatus(ENerveQuestCategory NewStatus);
+
+	/** @return Incomplete objectives reachable from the running branches, from the counts kept by AddBranchReach. */
+	int32 CountRemainingSteps() const;
+
+	/**
+	 * Counts the objectives ahead of one branch in or out of the reachable steps, when the branch moves or ends
+	 * @param Objective Objective the branch waits on, nothing happens for null
+	 * @param Delta 1 when the branch arrives at the objective, -1 when it leaves
+	 */
+	void AddBranchReach(const UNerveObjectiveRuntimeData* Objective, int32 Delta);
+
+	// --- Branches ---
+	/** Matches every join of the graph to the forks it closes and caches its connected branches */
+	void CompileJoins();
+
+	/** @return Id of a new branch outside any fork, or inside the given ones */
+	int32 AddBranch(TConstArrayView<FNerveQuestForkGroup> ForkGroups = TConstArrayView<FNerveQuestForkGroup>());
+
+	FNerveQuestBranch* FindBranch(int32 BranchId);
+	FNerveQuestBranch* FindBranch(const UNerveObjectiveRuntimeData* Objective);
+
+	/**
+	 * Moves a branch along an output pin; several links on the pin fork it
+	 * @param BranchId The branch to move
+	 * @param OutPin Pin to leave through, the branch ends without a valid link
+	 */
+	void MoveBranch(int32 BranchId, UNerveQuestRuntimePin* OutPin);
+
+	/** Moves a branch into a node: forks split it, joins hold it, any other node becomes its objective */
+	void EnterNode(int32 BranchId, UNerveQuestRuntimeObjectiveBase* Node);
+
+	/**
+	 * Splits a branch into one branch per target, all inside a new fork group
+	 * @param BranchId The branch to split
+	 * @param Targets Node each branch enters
+	 * @param Source Fork node or multi-link pin the split happens at, to find the join closing it
+	 */
+	void ForkBranch(int32 BranchId, TConstArrayView<UNerveQuestRuntimeObjectiveBase*> Targets, const UObject* Source);
+
+	/** Counts a branch arriving at a join and continues past it once enough did */
+	void ArriveAtJoin(int32 BranchId, const class UNerveJoinObjective* Join);
+
+	/** Makes an objective the one a branch waits on and executes it */
+	void RunObjective(int32 BranchId, UNerveObjectiveRuntimeData* Objective);
+
+	/** Ends a branch; the quest completes once no branch is left */
+	void EndBranch(int32 BranchId);
+
+	/** Cancels the objectives of branches inside a fork group, or of every branch for INDEX_NONE */
+	void CancelBranches(int32 ForkGroup, int32 KeepBranchId = INDEX_NONE);
+
+	/** Stops the optional objectives a main objective started */
+	void StopOptionalObjectivesOf(const UNerveObjectiveRuntimeData* Objective);
+
+	/** Forgets every branch and join arrival without touching the objectives */
+	void ResetBranches();
 };
 
 /**
@@ -737,19 +1252,16 @@ public:
 	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category = "Objective|Events")
 	FNerveQuestObjectiveAction OnObjectiveFailed;
 
+	/** Fired after OnObjectiveCompleted or OnObjectiveFailed, for a single native listener */
+	FNerveObjectiveRuntimeFinished OnObjectiveFinishedNative;
+
 private:
 	// --- Internal Data ---
-	/** Progress tracking widget */
-	UPROPERTY()
-	TObjectPtr<UObjectiveProgressTracker> TrackingWidget;
-
-	/** Reference to the quest subsystem */
-	UPROPERTY()
+	/** Reference to the quest subsystem; it is the outer, so no reflected reference is needed */
 	TObjectPtr<UNerveQuestSubsystem> QuestHandlerSubSystem;
 
-	/** Parent quest asset */
-	UPROPERTY()
-	mutable TObjectPtr<UNerveQuestAsset> ParentQuestAsset;
+	/** Tracker, progress and ownership, kept out of the reflected object graph */
+	FNerveObjectiveRuntimeState State;
 
 public:
 	// --- Initialization & Cleanup ---
@@ -762,8 +1274,32 @@ public:
 	 */
 	void Initialize(UNerveQuestRuntimeObjectiveBase* Objective, UNerveQuestSubsystem* QuestSubsystem, bool bAsOptional = false, UNerveObjectiveRuntimeData* MainParent = nullptr);
 
-	/** Cleans up objective resources */
+	/** Cleans up objective resources; does nothing once the objective has ended */
 	void Uninitialize();
+
+	/** @return True once Uninitialize has ended the objective. */
+	bool IsEnded() const { return State.bEnded; }
+
+	/** Resets every field and unbinds every delegate so the instance can be reused for another objective */
+	void ResetForReuse();
+
+	bool IsPooled() const { return State.bIsPooled; }
+	void SetPooled(const bool bPooled) { State.bIsPooled = bPooled; }
+
+	/** Sets the quest whose timer scope and pause state the objective follows */
+	void SetOwningQuest(UNerveQuestRuntimeData* Quest) { State.OwningQuest = Quest; }
+	UNerveQuestRuntimeData* GetOwningQuest() const { return State.OwningQuest.Get(); }
+
+	/** Slot in the subsystem's live objectives, INDEX_NONE while pooled */
+	int32 GetLiveIndex() const { return State.LiveIndex; }
+	void SetLiveIndex(const int32 Index) { State.LiveIndex = Index; }
+
+	/** Slot in the owning quest's objectives, INDEX_NONE for optional objectives */
+	int32 GetQuestIndex() const { return State.QuestIndex; }
+	void SetQuestIndex(const int32 Index) { State.QuestIndex = Index; }
+
+	/** Reports the references held in the unreflected state; called by the owning subsystem */
+	void AddStateReferences(FReferenceCollector& Collector);
 	
 	/** RAII Destructor - ensures cleanup */
 	virtual void BeginDestroy() override;
@@ -774,7 +1310,7 @@ public:
 	 * @param QuestAsset The associated quest asset
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Objective|Control")
-	void ExecuteObjective(UNerveQuestAsset* QuestAsset) const;
+	void ExecuteObjective(UNerveQuestAsset* QuestAsset);
 
 	/**
 	 * Sets the tracking state
@@ -783,6 +1319,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Objective|Control")
 	void MarkAsTracked(const bool Value) const;
 
+	/** Pauses this quest's run of the objective */
+	void PauseObjective() const;
+
+	/** Resumes this quest's run of the objective */
+	void ResumeObjective() const;
+
+	/** Completes this quest's run of the objective, as if the objective had completed itself */
+	void ForceComplete() const;
+
+	// --- Display ---
+	/**
+	 * Gets the objective label with its parameter bindings resolved for this quest
+	 * @return The display label
+	 */
+	UFUNCTION(BlueprintPure, Category = "Objective|Query")
+	FText GetDisplayLabel() const;
+
+	/**
+	 * Gets the objective tip with its parameter bindings resolved for this quest
+	 * @return The display tip
+	 */
+	UFUNCTION(BlueprintPure, Category = "Objective|Query")
+	FText GetDisplayTip() const;
+
 	// --- Data Access ---
 	/**
 	 * Checks if this is an optional objective
@@ -817,12 +1377,21 @@ public:
 	 * @return The tracker widget
 	 */
 	UFUNCTION(BlueprintPure, Category = "Objective|Query")
-	UObjectiveProgressTracker* GetObjectiveTrackerWidget() const { return TrackingWidget; }
+	UObjectiveProgressTracker* GetObjectiveTrackerWidget() const { return State.TrackingWidget; }
 
-	/** */
+	/**
+	 * Gets the active optional objectives this objective started
+	 * @return Array of optional objectives
+	 */
 	UFUNCTION(BlueprintPure, Category = "Objective|Query")
 	TArray<UNerveObjectiveRuntimeData*> GetOptionalObjectives() const;
 
+	/**
+	 * Visits the active optional objectives this objective started (C++ only)
+	 * @param Visitor Called for each optional objective
+	 */
+	void ForEachOptionalObjective(TFunctionRef<void(UNerveObjectiveRuntimeData*)> Visitor) const;
+
 	// --- Callbacks ---
 	/**
 	 * Handles objective completion
@@ -846,4 +1415,19 @@ public:
 	 */
 	UFUNCTION()
 	void ObjectiveProgress(UNerveQuestRuntimeObjectiveBase* ObjectiveBase, float NewProgressValue, float MaxProgressValue);
+
+	/**
+	 * Pushes the pending progress to the tracker widget if it would visibly change.
+	 * A change below MinDeliveryDelta is held back for one frame and delivered anyway if no newer progress arrives.
+	 * @param MinDeliveryDelta Smallest normalized change worth delivering
+	 * @return True if the progress was held back and must stay queued
+	 */
+	bool DeliverPendingProgress(float MinDeliveryDelta);
+
+private:
+	/** Forwards the end of the run to ObjectiveCompleted or ObjectiveFailed */
+	void HandleRunFinished(FNerveObjectiveRun& Run, bool bCompleted);
+
+	/** Forwards run progress to ObjectiveProgress */
+	void HandleRunProgress(FNerveObjectiveRun& Run, float NewProgressValue, float MaxProgressValue);
 };
\ No newline at end of file
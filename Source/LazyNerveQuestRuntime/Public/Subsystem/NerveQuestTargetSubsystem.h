@@ -0,0 +1,186 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NerveQuestTargetSubsystem.generated.h"
+
+/** Why a quest target entered or left the registry */
+enum class ENerveQuestTargetChange : uint8
+{
+    /** Spawned, or present when the world or its streaming level began play */
+    Added,
+    /** Destroyed through DestroyActor */
+    Destroyed,
+    /** Removed together with its streaming level, without being destroyed */
+    Unloaded
+};
+
+/** Native callback for quest target changes; the actor is still valid while it runs */
+DECLARE_DELEGATE_TwoParams(FNerveQuestTargetChanged, AActor* /*Actor*/, ENerveQuestTargetChange /*Change*/);
+
+/** Set of actors sharing one index key */
+using FNerveQuestTargetSet = TSet<TWeakObjectPtr<AActor>>;
+
+/** What the registry remembers about an indexed actor so it can be removed from every index */
+struct FNerveQuestTargetEntry
+{
+    TWeakObjectPtr<UClass> ActorClass;
+    FIntVector Cell = FIntVector::ZeroValue;
+
+    /** Movable actors are kept out of the cells and distance-checked on every radius query */
+    bool bMovable = false;
+
+    /** Owned tags plus all of their parents, so parent tag queries match */
+    FGameplayTagContainer Tags;
+};
+
+/** A watcher interested in one class, optionally narrowed to a gameplay tag */
+struct FNerveQuestTargetWatcher
+{
+    TWeakObjectPtr<UClass> ActorClass;
+    FGameplayTag Tag;
+    FNerveQuestTargetChanged Callback;
+};
+
+/**
+ * Indexes quest target actors of a game world by class, gameplay tag and spatial cell as they spawn,
+ * stream in, get destroyed or stream out. Objectives query it instead of scanning the world
+ * with GetAllActorsOfClass and subscribe to changes instead of binding to individual actors,
+ * so targets spawned after an objective started are counted as well.
+ *
+ * Indexing is opt-in: only classes listed in the runtime settings or passed to RegisterTargetClass are indexed,
+ * so projectiles, effects and level geometry cost one cached class lookup when they spawn.
+ *
+ * Tags come from IGameplayTagAssetInterface and are read when the actor is indexed; call RefreshActor after retagging.
+ * Static and stationary targets are bucketed by the cell they were indexed in, movable targets are distance-checked
+ * on every radius query, so radius queries follow moving targets without any refresh.
+ */
+UCLASS()
+class LAZYNERVEQUESTRUNTIME_API UNerveQuestTargetSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //~ Begin USubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    //~ End USubsystem Interface
+
+    /**
+     * Returns the target registry of the world the context object lives in.
+     * @param WorldContextObject Any object with a valid world.
+     * @return The subsystem, or null for worlds without game play (editor, preview).
+     */
+    UFUNCTION(BlueprintPure, Category = "Quest Targets", meta = (WorldContext = "WorldContextObject"))
+    static UNerveQuestTargetSubsystem* GetQuestTargetSubsystem(const UObject* WorldContextObject);
+
+    /**
+     * Counts the indexed actors of a class, subclasses included.
+     * @param ActorClass Class to count.
+     * @param Tag Optional tag the actors must own; ignored when empty.
+     * @return Number of matching live actors.
+     */
+    UFUNCTION(BlueprintPure, Category = "Quest Targets")
+    int32 CountActorsOfClass(TSubclassOf<AActor> ActorClass, FGameplayTag Tag) const;
+
+    /** Collects the indexed actors of a class, subclasses included, optionally narrowed to a tag */
+    UFUNCTION(BlueprintCallable, Category = "Quest Targets")
+    void GetActorsOfClass(TSubclassOf<AActor> ActorClass, FGameplayTag Tag, TArray<AActor*>& OutActors) const;
+
+    /** Collects the indexed actors owning a tag or one of its children */
+    UFUNCTION(BlueprintCallable, Category = "Quest Targets")
+    void GetActorsWithTag(FGameplayTag Tag, TArray<AActor*>& OutActors) const;
+
+    /**
+     * Collects the indexed actors within a radius, visiting only the cells the sphere overlaps.
+     * @param Center Sphere center.
+     * @param Radius Sphere radius.
+     * @param ActorClass Optional class filter; every class when null.
+     * @param OutActors Matching actors.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Quest Targets")
+    void GetActorsInRadius(const FVector& Center, float Radius, TSubclassOf<AActor> ActorClass, TArray<AActor*>& OutActors) const;
+
+    /** Re-reads the location and tags of an actor, indexing it if its class is a target class */
+    UFUNCTION(BlueprintCallable, Category = "Quest Targets")
+    void RefreshActor(AActor* Actor);
+
+    /**
+     * Starts indexing a class, subclasses included, and indexes its actors already in the world.
+     * Queries only see registered classes; AddWatcher registers its class itself.
+     * @param ActorClass Class to index; does nothing if it is already covered.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Quest Targets")
+    void RegisterTargetClass(TSubclassOf<AActor> ActorClass);
+
+    /** @return True when actors of the class are indexed. */
+    bool IsTargetClass(const UClass* ActorClass) const;
+
+    /**
+     * Calls back whenever a matching actor is added to or leaves the registry.
+     * @param ActorClass Class to watch, subclasses included.
+     * @param Tag Optional tag the actors must own; ignored when empty.
+     * @param Callback Invoked with the actor and the kind of change.
+     * @return Handle for RemoveWatcher, or INDEX_NONE when the class is invalid.
+     */
+    int32 AddWatcher(TSubclassOf<AActor> ActorClass, FGameplayTag Tag, FNerveQuestTargetChanged Callback);
+
+    /** Stops a watcher added with AddWatcher */
+    void RemoveWatcher(int32 WatcherHandle);
+
+    /** Returns true when the actor belongs to the class and owns the tag, if any */
+    bool ActorMatches(const AActor* Actor, const UClass* ActorClass, const FGameplayTag& Tag) const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    void IndexActor(AActor* Actor);
+    void UnindexActor(AActor* Actor, ENerveQuestTargetChange Change);
+    void IndexLevel(const ULevel* Level);
+    void NotifyWatchers(AActor* Actor, const FNerveQuestTargetEntry& Entry, ENerveQuestTargetChange Change);
+
+    FIntVector GetCell(const FVector& Location) const;
+
+    void HandleActorSpawned(AActor* Actor);
+    void HandleActorDestroyed(AActor* Actor);
+    void HandleLevelAdded(ULevel* Level, UWorld* World);
+    void HandleLevelRemoved(ULevel* Level, UWorld* World);
+
+    /** Every indexed actor with what is needed to unindex it */
+    TMap<TWeakObjectPtr<AActor>, FNerveQuestTargetEntry> Entries;
+
+    /** Actors keyed by their exact class; class queries walk the keys for subclasses */
+    TMap<TWeakObjectPtr<UClass>, FNerveQuestTargetSet> ActorsByClass;
+
+    /** Actors keyed by every owned tag and its parents */
+    TMap<FGameplayTag, FNerveQuestTargetSet> ActorsByTag;
+
+    /** Static and stationary actors keyed by spatial cell */
+    TMap<FIntVector, FNerveQuestTargetSet> ActorsByCell;
+
+    /** Movable actors, checked by distance on every radius query */
+    FNerveQuestTargetSet MovableActors;
+
+    /** Registered target classes; their subclasses are indexed too */
+    TArray<TWeakObjectPtr<UClass>> TargetClasses;
+
+    /** Whether each spawned class is a target class, so spawns cost one lookup */
+    mutable TMap<TWeakObjectPtr<const UClass>, bool> TargetClassCache;
+
+    /** Watchers keyed by handle */
+    TMap<int32, FNerveQuestTargetWatcher> Watchers;
+
+    int32 NextWatcherHandle = 0;
+
+    double CellSize = 5000.0;
+
+    FDelegateHandle ActorSpawnedHandle;
+    FDelegateHandle ActorDestroyedHandle;
+    FDelegateHandle LevelAddedHandle;
+    FDelegateHandle LevelRemovedHandle;
+};
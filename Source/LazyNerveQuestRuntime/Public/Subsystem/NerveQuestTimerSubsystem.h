@@ -0,0 +1,111 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/StructsAndEnums/NerveQuestStructsAndEnums.h"
+#include "Data/Timing/NerveQuestTimingWheel.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NerveQuestTimerSubsystem.generated.h"
+
+/** Pause and dilation state of one timer scope; its timers live in the shared wheels */
+struct FNerveQuestTimerScope
+{
+    /** Timers of a paused scope are parked outside the wheels */
+    bool bPaused = false;
+
+    /** Scales the game clock of this scope only */
+    float TimeDilation = 1.0f;
+};
+
+/**
+ * Owns every quest timer of a game world: objective waits, time limits and tracking polls.
+ * Each clock (game, real, paused) is one hierarchical timing wheel shared by every scope and driven
+ * from this single tick, so thousands of pending timers in any number of quests cost a constant
+ * amount per frame. Ticks only while timers are pending.
+ *
+ * Every quest gets its own timer scope. Pausing a scope parks its timers outside the wheels until
+ * resumed, and dilating it reschedules its game clock timers, both without touching the handles
+ * its objectives hold.
+ */
+UCLASS()
+class LAZYNERVEQUESTRUNTIME_API UNerveQuestTimerSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //~ Begin USubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    //~ End USubsystem Interface
+
+    //~ Begin FTickableGameObject Interface
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual bool IsTickableWhenPaused() const override { return true; }
+    virtual TStatId GetStatId() const override;
+    //~ End FTickableGameObject Interface
+
+    /**
+     * Returns the quest timer subsystem of the world the context object lives in.
+     * @param WorldContextObject Any object with a valid world.
+     * @return The subsystem, or null for worlds without game play (editor, preview).
+     */
+    static UNerveQuestTimerSubsystem* GetQuestTimerSubsystem(const UObject* WorldContextObject);
+
+    /**
+     * Schedules a callback, replacing the timer the handle pointed to.
+     * @param InOutHandle Cleared first, then set to the new timer.
+     * @param Callback Called when the timer fires.
+     * @param Delay Seconds until the first call.
+     * @param bLoop Whether to keep calling every Delay seconds.
+     * @param Clock Clock the delay is measured on.
+     * @param Scope Timer scope, usually the one of the objective's quest; zero for the world scope.
+     */
+    void SetTimer(FNerveQuestTimerHandle& InOutHandle, FSimpleDelegate Callback, float Delay, bool bLoop = false, ENerveQuestClock Clock = ENerveQuestClock::GameTime, int32 Scope = 0);
+
+    /** Cancels the timer and invalidates the handle */
+    void ClearTimer(FNerveQuestTimerHandle& InOutHandle);
+
+    /** @return True while the timer is pending. */
+    bool IsTimerActive(const FNerveQuestTimerHandle& Handle) const;
+
+    /** @return Seconds until the timer fires on its clock, or -1 when it is not pending. */
+    float GetTimerRemaining(const FNerveQuestTimerHandle& Handle) const;
+
+    /** @return Number of pending timers on every clock and scope. */
+    int32 GetNumPendingTimers() const;
+
+    // --- Scopes ---
+    /** @return A new timer scope, e.g. for one quest. */
+    int32 CreateTimerScope();
+
+    /** Drops a scope and every timer in it without firing them */
+    void ReleaseTimerScope(int32 Scope);
+
+    /** Pauses or resumes every clock of a scope; timers keep their remaining time */
+    void SetScopePaused(int32 Scope, bool bPaused);
+
+    bool IsScopePaused(int32 Scope) const;
+
+    /** Scales the game clock of a scope; zero freezes it like a pause */
+    void SetScopeTimeDilation(int32 Scope, float TimeDilation);
+
+    float GetScopeTimeDilation(int32 Scope) const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    FNerveQuestTimingWheel& GetWheel(ENerveQuestClock Clock);
+    const FNerveQuestTimingWheel& GetWheel(ENerveQuestClock Clock) const;
+
+    FNerveQuestTimingWheel GameTimeWheel;
+    FNerveQuestTimingWheel RealTimeWheel;
+    FNerveQuestTimingWheel PausedTimeWheel;
+
+    /** Timer scopes by id, zero being the world scope */
+    TMap<int32, FNerveQuestTimerScope> Scopes;
+
+    int32 NextScope = 1;
+};
@@ -0,0 +1,92 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Data/StructsAndEnums/NerveQuestStructsAndEnums.h"
+#include "NerveQuestJournalItem.generated.h"
+
+class UNerveQuestAsset;
+class UNerveQuestRuntimeData;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNerveQuestJournalItemAction, UNerveQuestJournalItem*, JournalItem);
+
+/**
+ * Lightweight list item describing one quest in the journal.
+ * Items are owned and cached by UNerveQuestSubsystem and handed to UListView/UTileView,
+ * so only the rows that are currently visible ever get an entry widget.
+ */
+UCLASS(BlueprintType)
+class LAZYNERVEQUESTRUNTIME_API UNerveQuestJournalItem : public UObject
+{
+    GENERATED_BODY()
+
+    /** Runtime data this item mirrors */
+    UPROPERTY()
+    TWeakObjectPtr<UNerveQuestRuntimeData> QuestRuntimeData;
+
+    /** Serial of the quest when the item was bound, so a pooled and reused instance is not mirrored */
+    int32 QuestSerial = 0;
+
+    UPROPERTY()
+    TObjectPtr<UNerveQuestAsset> QuestAsset;
+
+    FString QuestTitle;
+    ENerveQuestCategory QuestStatus = ENerveQuestCategory::Available;
+    ENerveQuestTypes QuestType = ENerveQuestTypes::MainQuest;
+    bool bIsTracked = false;
+    float OverallProgress = 0.0f;
+    int32 RemainingSteps = 0;
+
+public:
+    /** Broadcast when the cached quest state changes; entry widgets bind to this while visible */
+    UPROPERTY(BlueprintAssignable, Category = "Quest Journal|Events")
+    FNerveQuestJournalItemAction OnJournalItemChanged;
+
+    /** Broadcast after OnJournalItemChanged when the cached quest status changed; category-filtered journals bind to this */
+    UPROPERTY(BlueprintAssignable, Category = "Quest Journal|Events")
+    FNerveQuestJournalItemAction OnJournalItemStatusChanged;
+
+    /**
+     * Binds the item to a quest and caches its display state
+     * @param InQuestRuntimeData The quest runtime data to mirror
+     */
+    void Initialize(UNerveQuestRuntimeData* InQuestRuntimeData);
+
+    /** Unbinds from the quest runtime data */
+    void Uninitialize();
+
+    /** Re-reads the cached state from the quest and notifies listeners if anything changed */
+    UFUNCTION(BlueprintCallable, Category = "Quest Journal")
+    void Refresh();
+
+    /** @return The mirrored quest, or null once its runtime data was released or reused for another quest. */
+    UFUNCTION(BlueprintPure, Category = "Quest Journal")
+    UNerveQuestRuntimeData* GetQuestRuntimeData() const;
+
+    UFUNCTION(BlueprintPure, Category = "Quest Journal")
+    UNerveQuestAsset* GetQuestAsset() const { return QuestAsset; }
+
+    UFUNCTION(BlueprintPure, Category = "Quest Journal")
+    FString GetQuestTitle() const { return QuestTitle; }
+
+    UFUNCTION(BlueprintPure, Category = "Quest Journal")
+    ENerveQuestCategory GetQuestStatus() const { return QuestStatus; }
+
+    UFUNCTION(BlueprintPure, Category = "Quest Journal")
+    ENerveQuestTypes GetQuestType() const { return QuestType; }
+
+    UFUNCTION(BlueprintPure, Category = "Quest Journal")
+    bool GetIsTracked() const { return bIsTracked; }
+
+    UFUNCTION(BlueprintPure, Category = "Quest Journal")
+    float GetOverallProgress() const { return OverallProgress; }
+
+    UFUNCTION(BlueprintPure, Category = "Quest Journal")
+    int32 GetRemainingSteps() const { return RemainingSteps; }
+
+private:
+    UFUNCTION()
+    void OnQuestStateChanged(UNerveQuestRuntimeData* Quest);
+};
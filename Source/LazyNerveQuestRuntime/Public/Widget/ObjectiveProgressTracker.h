@@ -7,7 +7,9 @@
 #include "ObjectiveProgressTracker.generated.h"
 
 /**
- * 
+ * Displays the progress of a single objective.
+ * Progress arrives at most once per frame and only when it visibly changes, so the
+ * displayed value can optionally ease towards the latest target between updates.
  */
 UCLASS(Abstract)
 class LAZYNERVEQUESTRUNTIME_API UObjectiveProgressTracker : public UUserWidget
@@ -17,6 +19,20 @@ class LAZYNERVEQUESTRUNTIME_API UObjectiveProgressTracker : public UUserWidget
 	float Current = 0.0f;
 	float Max = 0.0f;
 
+	/** Value currently shown, eased towards Current when interpolating */
+	float DisplayedCurrent = 0.0f;
+
+protected:
+	/** Whether the displayed value eases towards new progress instead of snapping to it */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Progress")
+	bool bInterpolateProgress = true;
+
+	/** Interpolation speed used when easing the displayed value */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Progress", meta=(EditCondition="bInterpolateProgress", ClampMin="0.0"))
+	float ProgressInterpSpeed = 10.0f;
+
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
 public:
 	UFUNCTION(BlueprintPure, Category="Current")
 	float GetCurrent() const { return Current; }
@@ -24,9 +40,21 @@ public:
 	UFUNCTION(BlueprintPure, Category="Max")
 	float GetMax() const { return Max; }
 
+	/** Value to display this frame; equals GetCurrent() once interpolation settles */
+	UFUNCTION(BlueprintPure, Category="Progress")
+	float GetDisplayedCurrent() const { return DisplayedCurrent; }
+
+	/** Displayed value as a 0-1 fraction of Max */
+	UFUNCTION(BlueprintPure, Category="Progress")
+	float GetDisplayedPercent() const { return Max > 0.0f ? FMath::Clamp(DisplayedCurrent / Max, 0.0f, 1.0f) : 0.0f; }
+
 	UFUNCTION(BlueprintNativeEvent, Category="Current")
 	void SetCurrent(const float NewCurrent);
 
 	UFUNCTION(BlueprintNativeEvent, Category="Max")
 	void SetMax(const float NewMax);
+
+	/** Called whenever the displayed value changes, either on a new update or while interpolating */
+	UFUNCTION(BlueprintImplementableEvent, Category="Progress")
+	void OnDisplayedProgressChanged(float DisplayedValue, float MaxValue);
 };
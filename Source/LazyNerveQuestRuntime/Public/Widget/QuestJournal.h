@@ -0,0 +1,117 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
+#include "Data/StructsAndEnums/NerveQuestStructsAndEnums.h"
+#include "QuestJournal.generated.h"
+
+class UListView;
+class UNerveQuestAsset;
+class UNerveQuestJournalItem;
+class UNerveQuestSubsystem;
+
+/**
+ * Quest journal backed by a virtualized list (UListView or UTileView).
+ * The journal only feeds UNerveQuestJournalItem data to the list; entry widgets are created
+ * for visible rows only and recycled as the list scrolls.
+ */
+UCLASS(Abstract)
+class LAZYNERVEQUESTRUNTIME_API UQuestJournal : public UUserWidget
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TWeakObjectPtr<UNerveQuestSubsystem> QuestSubsystem;
+
+    /** Item of every registered quest, listed or filtered out, so status changes and removals need no list scan */
+    UPROPERTY()
+    TMap<TObjectPtr<UNerveQuestAsset>, TObjectPtr<UNerveQuestJournalItem>> JournalItems;
+
+    /** Items currently handed to the list view */
+    TSet<TObjectPtr<UNerveQuestJournalItem>> ListedItems;
+
+protected:
+    /** Whether only quests of FilterCategory are listed */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest Journal")
+    bool bFilterByCategory = false;
+
+    /** Category shown when bFilterByCategory is set */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest Journal", meta = (EditCondition = "bFilterByCategory"))
+    ENerveQuestCategory FilterCategory = ENerveQuestCategory::InProgress;
+
+    virtual void NativeConstruct() override;
+    virtual void NativeDestruct() override;
+
+public:
+    /** Rebuilds the list items from the quest subsystem */
+    UFUNCTION(BlueprintCallable, Category = "Quest Journal")
+    void RefreshJournal();
+
+    /**
+     * Changes the category filter and rebuilds the list
+     * @param bEnableFilter Whether to filter by category
+     * @param NewCategory The category to show
+     */
+    UFUNCTION(BlueprintCallable, Category = "Quest Journal")
+    void SetCategoryFilter(bool bEnableFilter, ENerveQuestCategory NewCategory);
+
+protected:
+    /** The list or tile view that displays the journal items */
+    UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Quest Journal")
+    UListView* GetJournalListView();
+    virtual UListView* GetJournalListView_Implementation();
+
+    bool PassesFilter(const UNerveQuestJournalItem* Item) const;
+
+    /** Starts following an item's status and adds it to the list if it passes the filter */
+    void AddJournalItem(UNerveQuestJournalItem* Item);
+
+    /** Stops following every item and empties the list */
+    void ClearJournalItems();
+
+    UFUNCTION()
+    void OnQuestAdded(UNerveQuestAsset* Quest);
+
+    UFUNCTION()
+    void OnQuestRemoved(UNerveQuestAsset* Quest);
+
+    UFUNCTION()
+    void OnQuestTrackingChanged(UNerveQuestAsset* Quest);
+
+    /** Adds or drops the item from the list when its status moves in or out of the filter */
+    UFUNCTION()
+    void OnJournalItemStatusChanged(UNerveQuestJournalItem* Item);
+};
+
+/**
+ * Base entry widget for UQuestJournal rows.
+ * Receives a UNerveQuestJournalItem when a row scrolls into view and listens to it only while visible.
+ */
+UCLASS(Abstract)
+class LAZYNERVEQUESTRUNTIME_API UQuestJournalEntry : public UUserWidget, public IUserObjectListEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<UNerveQuestJournalItem> JournalItem;
+
+public:
+    UFUNCTION(BlueprintPure, Category = "Quest Journal")
+    UNerveQuestJournalItem* GetJournalItem() const { return JournalItem; }
+
+protected:
+    virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+    virtual void NativeOnEntryReleased() override;
+
+    /** Called when this row is assigned a quest or the assigned quest changes */
+    UFUNCTION(BlueprintNativeEvent, Category = "Quest Journal")
+    void OnJournalItemUpdated(UNerveQuestJournalItem* Item);
+    virtual void OnJournalItemUpdated_Implementation(UNerveQuestJournalItem* Item);
+
+private:
+    UFUNCTION()
+    void HandleJournalItemChanged(UNerveQuestJournalItem* Item);
+};
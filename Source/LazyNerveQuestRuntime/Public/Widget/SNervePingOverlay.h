@@ -0,0 +1,75 @@
+// Copyright (C) 2024 Job Omondiale - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Fonts/SlateFontInfo.h"
+#include "Widgets/SLeafWidget.h"
+
+struct FSlateBrush;
+
+/** One marker drawn by the ping overlay */
+struct FNervePingOverlayItem
+{
+    /** Marker centre as a fraction of the player viewport (0..1 on both axes) */
+    FVector2D NormalizedPosition = FVector2D::ZeroVector;
+
+    /** Distance text, or the cluster count for merged markers, drawn under the marker; skipped when empty */
+    FString Label;
+
+    /** Off-screen pings use the edge marker brush */
+    bool bOnScreen = true;
+
+    /** Occluded targets are drawn with the occluded tint */
+    bool bOccluded = false;
+};
+
+/**
+ * Draws every world ping of a player in a single paint pass.
+ * Used instead of one widget component per ping when the ping render mode is SingleOverlay.
+ */
+class LAZYNERVEQUESTRUNTIME_API SNervePingOverlay : public SLeafWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SNervePingOverlay)
+        : _MarkerBrush(nullptr)
+        , _EdgeMarkerBrush(nullptr)
+        , _LabelColor(FLinearColor::White)
+        , _OccludedTint(FLinearColor::White)
+    {}
+        SLATE_ARGUMENT(const FSlateBrush*, MarkerBrush)
+        SLATE_ARGUMENT(const FSlateBrush*, EdgeMarkerBrush)
+        SLATE_ARGUMENT(FSlateFontInfo, LabelFont)
+        SLATE_ARGUMENT(FLinearColor, LabelColor)
+        SLATE_ARGUMENT(FLinearColor, OccludedTint)
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs);
+
+    /**
+     * Gives write access to the marker list; call CommitItems once it has been filled.
+     * @return The items drawn on the next paint
+     */
+    TArray<FNervePingOverlayItem>& ModifyItems() { return Items; }
+
+    /** Requests a repaint after ModifyItems */
+    void CommitItems();
+
+    /** Removes every marker */
+    void ClearItems();
+
+    virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+        FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+protected:
+    virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+    TArray<FNervePingOverlayItem> Items;
+
+    const FSlateBrush* MarkerBrush = nullptr;
+    const FSlateBrush* EdgeMarkerBrush = nullptr;
+    FSlateFontInfo LabelFont;
+    FLinearColor LabelColor = FLinearColor::White;
+    FLinearColor OccludedTint = FLinearColor::White;
+};
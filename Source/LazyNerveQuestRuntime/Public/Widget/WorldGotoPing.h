@@ -19,6 +19,12 @@ class LAZYNERVEQUESTRUNTIME_API UWorldGotoPing : public UUserWidget
 private:
 	UPROPERTY()
 	bool bCurrentlyOnScreen = true;
+
+	UPROPERTY()
+	int32 CurrentClusterCount = 1;
+
+	UPROPERTY()
+	bool bCurrentlyOccluded = false;
 	
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category="GoTo Ping")
@@ -28,6 +34,14 @@ protected:
 	UFUNCTION(BlueprintNativeEvent, Category="GoTo Ping")
 	void OnScreenStateChanged(bool bIsOnScreen);
 
+	// Optional: Override this in Blueprint to show how many off-screen pings this marker stands for
+	UFUNCTION(BlueprintNativeEvent, Category="GoTo Ping")
+	void OnClusterCountChanged(int32 ClusterCount);
+
+	// Optional: Override this in Blueprint to restyle the ping while its target is behind geometry
+	UFUNCTION(BlueprintNativeEvent, Category="GoTo Ping")
+	void OnOcclusionChanged(bool bIsOccluded);
+
 public:
 	UFUNCTION(BlueprintCallable, Category="GoTo Ping")
 	void UpdateDistance(float NewDistance, ENerveDistanceConversionMethod ConversionMethod);
@@ -37,4 +51,16 @@ public:
 
 	UFUNCTION(BlueprintPure, Category="GoTo Ping")
 	bool GetIsOnScreen() const { return bCurrentlyOnScreen; }
+
+	UFUNCTION(BlueprintCallable, Category="GoTo Ping")
+	void SetClusterCount(int32 ClusterCount);
+
+	UFUNCTION(BlueprintPure, Category="GoTo Ping")
+	int32 GetClusterCount() const { return CurrentClusterCount; }
+
+	UFUNCTION(BlueprintCallable, Category="GoTo Ping")
+	void SetIsOccluded(bool bIsOccluded);
+
+	UFUNCTION(BlueprintPure, Category="GoTo Ping")
+	bool GetIsOccluded() const { return bCurrentlyOccluded; }
 };